@@ -18,7 +18,7 @@
 #include "xml.h"
 #include "xmlfile.h"
 #include "xmlreader.h"
-#include "xml_tree_browser.h"
+#include "parallel_tree_browser.h"
 
 using namespace std;
 using namespace MusicXML2;
@@ -35,6 +35,7 @@ class countnotes :
 				 countnotes() : fCount(0)	{}
 		virtual ~countnotes() {}
 		void visitStart( S_note& elt )		{ fCount++; }
+		void merge( const countnotes& v )	{ fCount += v.fCount; }
 };
 
 //_______________________________________________________________________________
@@ -55,8 +56,8 @@ static int read(FILE * fd)
 		if (elt) {
 #ifdef use_visitor
 			countnotes v;
-			xml_tree_browser browser(&v);
-			browser.browse(*elt);
+			parallel_tree_browser browser(0, parallel_tree_browser::kMeasures);
+			browser.browse(*elt, v);
 			count = v.fCount;
 #else // use iterator
 			predicate p;
@@ -19,23 +19,29 @@
 #include "xmlreader.h"
 #include "partsummary.h"
 #include "smartlist.h"
-#include "xml_tree_browser.h"
+#include "parallel_tree_browser.h"
 
 using namespace std;
 using namespace MusicXML2;
 
 //_______________________________________________________________________________
+// the parts are summarized concurrently: the summaries are
+// printed when the results are merged, in the parts order
 class mypartsummary : public partsummary
 {
 	public:
-		virtual void visitEnd ( S_part& elt);
+		string	fPartID;
+
+		virtual void visitStart ( S_part& elt)	{ partsummary::visitStart(elt); fPartID = elt->getAttributeValue("id"); }
+		void merge (const mypartsummary& part)	{ part.print(); }
+		void print () const;
 };
 
 
 //_______________________________________________________________________________
-void mypartsummary::visitEnd ( S_part& elt)
+void mypartsummary::print () const
 {
-	cout << "summary for part " << elt->getAttributeValue("id") << endl;
+	cout << "summary for part " << fPartID << endl;
 	cout << "  staves count : " << countStaves() << endl;
 
 	smartlist<int>::ptr voices;
@@ -83,8 +89,8 @@ int main(int argc, char *argv[])
 		Sxmlelement elt = xmlfile->elements();
 		if (elt) {
 			mypartsummary nv;
-			xml_tree_browser browser(&nv);
-			browser.browse(*elt);
+			parallel_tree_browser browser;
+			browser.browse(*elt, nv);
 		}
 	}
 	else cerr << "error reading \"" << file << "\"" << endl;
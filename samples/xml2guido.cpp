@@ -26,6 +26,8 @@ static void usage() {
 	cerr << "usage: xml2guido [options]  <musicxml file>" << endl;
 	cerr << "       reads stdin when <musicxml file> is '-'" << endl;
 	cerr << "       options: --autobars don't generates barlines" << endl;
+	cerr << "                --parts first-last    : convert a range of parts (e.g. 1-2, 0 for the last part)" << endl;
+	cerr << "                --measures first-last : convert a range of measures (e.g. 120-140, 0 for the last measure)" << endl;
 	cerr << "                --version print version and exit" << endl;
 	cerr << "                -o file   : write output to file" << endl;
 	cerr << "                -h --help : print this help" << endl;
@@ -75,6 +77,18 @@ static char* fileOpt(int argc, char *argv[], const string& option)
 	return 0;
 }
 
+//_______________________________________________________________________________
+static bool rangeOpt(int argc, char *argv[], const string& option, int& first, int& last)
+{
+	const char* range = fileOpt (argc, argv, option);
+	if (!range) return false;
+	if (sscanf (range, "%d-%d", &first, &last) != 2) {
+		cerr << "incorrect range " << range << " for option " << option << endl;
+		exit(1);
+	}
+	return true;
+}
+
 //_______________________________________________________________________________
 static void versionInfo()
 {
@@ -108,9 +122,15 @@ int main(int argc, char *argv[])
 		out = &fout;
 	}
 
+	int firstPart = 1, lastPart = 0, firstMeasure = 1, lastMeasure = 0;
+	bool range = rangeOpt (argc, argv, "--parts", firstPart, lastPart);
+	range = rangeOpt (argc, argv, "--measures", firstMeasure, lastMeasure) || range;
+
 	xmlErr err = kNoErr;
 	if (!strcmp(file, "-"))
 		err = musicxmlfd2guido(stdin, generateBars, *out);
+	else if (range)
+		err = musicxmlfile2guidoRange(file, generateBars, firstPart, lastPart, firstMeasure, lastMeasure, *out);
 	else
 		err = musicxmlfile2guido(file, generateBars, *out);
 	if (err == kUnsupported)
@@ -11,6 +11,7 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <stdio.h>
 #include <string.h>
 #include <iostream>
 
@@ -18,6 +19,7 @@
 #include "xmlfile.h"
 #include "xmlreader.h"
 #include "midicontextvisitor.h"
+#include "static_tree_browser.h"
 #include "unrolled_xml_tree_browser.h"
 
 using namespace std;
@@ -65,7 +67,10 @@ int main(int argc, char *argv[]) {
 		if (st) {
 			mymidiwriter writer;
 			midicontextvisitor v(480, &writer);
-			unrolled_xml_tree_browser browser(&v);
+			static_tree_browser<midicontextvisitor, unrolled_xml_tree_browser> browser(&v);
+			int first, last;		// an optional measures range given as 'first-last'
+			if ((argc > 2) && (sscanf (argv[2], "%d-%d", &first, &last) == 2))
+				browser.setRange (scorerange(1, 0, first, last));
 			browser.browse(*st);
 		}
 	}
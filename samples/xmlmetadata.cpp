@@ -0,0 +1,41 @@
+/*
+
+  Copyright (C) 2003-2008  Grame
+  Grame Research Laboratory, 9 rue du Garet, 69001 Lyon - France
+  research@grame.fr
+
+  This file is provided as an example of the MusicXML Library use.
+*/
+
+#ifdef WIN32
+# pragma warning (disable : 4786)
+#endif
+
+#include <iostream>
+
+#include "scoremetadata.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[]) 
+{
+	if (argc == 1) {
+		cerr << "usage: " << argv[0] << " file [file...]" << endl;
+		return 1;
+	}
+	metadatascanner scanner;
+	scoremetadata md;
+	int ret = 0;
+	for (int i = 1; i < argc; i++) {
+		if (argc > 2) cout << argv[i] << ":" << endl;
+		if (scanner.scanfile (argv[i], md))
+			md.print (cout);
+		else {
+			cerr << "can't scan \"" << argv[i] << "\"" << endl;
+			ret = 1;
+		}
+	}
+	return ret;
+}
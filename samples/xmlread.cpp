@@ -40,6 +40,8 @@ static void usage (char* name)
 	cerr << "       read a musicxml file and re-write it" << endl;
 	cerr << "       options:" << endl;
 	cerr << "           	-o <file>: output file name" << endl;
+	cerr << "           	-profile <name>: a pruning profile: playback, analysis or notation" << endl;
+	cerr << "           	-validate: validates the file, the errors are written to the standard error" << endl;
 	cerr << "       writes to standard output when -o option is missing." << endl;
 	exit(1);
 }
@@ -54,6 +56,15 @@ static const char* getOption (int argc, char *argv[], const std::string& option,
 	return defaultValue;
 }
 
+static bool getFlag (int argc, char *argv[], const std::string& option)
+{
+	for (int i = 1; i < argc - 1; i++) {
+		if (option == argv[i])
+			return true;
+	}
+	return false;
+}
+
 static const char* getFile (int argc, char *argv[])
 {
 	return argv[argc-1];
@@ -109,7 +120,9 @@ int main(int argc, char *argv[])
 	catchsigs();
 
 	const char* outfile = getOption (argc, argv, "-o", 0);
-	if ((outfile && (argc != 4)) && (argc != 2))
+	const char* profile = getOption (argc, argv, "-profile", 0);
+	bool validate = getFlag (argc, argv, "-validate");
+	if (argc != (2 + (outfile ? 2 : 0) + (profile ? 2 : 0) + (validate ? 1 : 0)))
 		usage (argv[0]);
 	const char* filename = getFile (argc, argv);
 
@@ -119,7 +132,14 @@ int main(int argc, char *argv[])
 	else out = &cout;
 
 	xmlreader r;
+	if (profile) {
+		Sxmlprofile p = xmlprofile::create (profile);
+		if (!p) usage (argv[0]);
+		r.setProfile (p);
+	}
+	if (validate) r.setValidator (xmlvalidator::create());
 	SXMLFile file = r.read(filename);
+	if (validate) r.getValidator()->print (cerr);
 	if (file) {
 //		Sxmlelement st = file->elements();
 		file->print(*out);
@@ -0,0 +1,168 @@
+/*
+
+  Copyright (C) 2008  Grame
+  Grame Research Laboratory, 9 rue du Garet, 69001 Lyon - France
+  research@grame.fr
+
+  This file is provided as an example of the MusicXML Library use.
+  It checks the concurrent read-only visit of a frozen score: several
+  threads run different visitors on the same tree and the results must
+  be the same as when the visitors run alone.
+  Build the library and the samples with -DTSAN=on to run the check
+  under the thread sanitizer.
+*/
+
+#ifdef WIN32
+# pragma warning (disable : 4786)
+#endif
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "elements.h"
+#include "typedefs.h"
+#include "visitor.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlprofile.h"
+#include "xmlreader.h"
+#include "xml_tree_browser.h"
+#include "unrolled_xml_tree_browser.h"
+#include "partsummary.h"
+#include "xml2guidovisitor.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+class notesvisitor :
+	public visitor<S_note>,
+	public visitor<S_duration>
+{
+	public:
+		long	fNotes, fDuration;
+
+				 notesvisitor() : fNotes(0), fDuration(0) {}
+		virtual ~notesvisitor() {}
+		void visitStart( S_note& elt )		{ fNotes++; }
+		void visitStart( S_duration& elt )	{ fDuration += long(*elt); }
+};
+
+//_______________________________________________________________________________
+// the checks: each one browses the score with its own visitor
+static string unrolled (const Sxmlelement& score)
+{
+	notesvisitor v;
+	unrolled_xml_tree_browser browser(&v);
+	browser.browse (*score);
+	stringstream s;
+	s << v.fNotes << " " << v.fDuration;
+	return s.str();
+}
+
+static string guido (const Sxmlelement& score)
+{
+	xml2guidovisitor v(true, true, true);
+	Sguidoelement gmn = v.convert (score);
+	stringstream s;
+	if (gmn) s << gmn;
+	return s.str();
+}
+
+static string summary (const Sxmlelement& score)
+{
+	stringstream s;
+	for (ctree<xmlelement>::literator i = score->lbegin(); i != score->lend(); i++) {
+		if ((*i)->getType() != k_part) continue;
+		partsummary ps;
+		xml_tree_browser browser(&ps);
+		browser.browse (**i);
+		s << ps.countStaves() << " " << ps.countVoices() << " ";
+	}
+	return s.str();
+}
+
+static string iterate (const Sxmlelement& score)
+{
+	long count = 0, types = 0;
+	for (ctree<xmlelement>::iterator i = score->begin(); i != score->end(); i++) {
+		count++;
+		types += i->getType();
+	}
+	stringstream s;
+	s << count << " " << types;
+	return s.str();
+}
+
+typedef string (*check)(const Sxmlelement&);
+static const check	gChecks[] = { unrolled, guido, summary, iterate };
+static const char*	gNames[]  = { "unrolled", "guido", "summary", "iterate" };
+enum { kChecks = 4 };
+
+//_______________________________________________________________________________
+static int usage (const char* name)
+{
+	cerr << "usage: " << name << " [options] file" << endl;
+	cerr << "       runs concurrent visitors on a frozen score and compares the results" << endl;
+	cerr << "options: -threads n       the number of threads (default is 8)" << endl;
+	cerr << "         -lazy            reads the measures lazily" << endl;
+	cerr << "         -parallel        reads the score using several threads" << endl;
+	cerr << "         -profile name    reads the score using a pruning profile" << endl;
+	return 1;
+}
+
+//_______________________________________________________________________________
+int main(int argc, char *argv[]) {
+	int threads = 8;
+	bool lazy = false, parallel = false;
+	const char* file = 0;
+	Sxmlprofile profile;
+	for (int i = 1; i < argc; i++) {
+		string arg = argv[i];
+		if ((arg == "-threads") && (i < argc-1))	threads = atoi(argv[++i]);
+		else if (arg == "-lazy")					lazy = true;
+		else if (arg == "-parallel")				parallel = true;
+		else if ((arg == "-profile") && (i < argc-1)) {
+			profile = xmlprofile::create (argv[++i]);
+			if (!profile) return usage (argv[0]);
+		}
+		else if (arg[0] == '-') return usage (argv[0]);
+		else file = argv[i];
+	}
+	if (!file || (threads < 1)) return usage (argv[0]);
+
+	xmlreader r;
+	if (profile) r.setProfile (profile);
+	SXMLFile xml = lazy ? r.readlazy (file) : (parallel ? r.readparallel (file, threads) : r.read (file));
+	Sxmlelement score = xml ? xml->elements() : 0;
+	if (!score) {
+		cerr << "can't read " << file << endl;
+		return 1;
+	}
+
+	xml->freeze();
+	vector<string> expected;
+	for (int i = 0; i < kChecks; i++)
+		expected.push_back (gChecks[i](score));
+
+	vector<string> results (threads);
+	vector<thread> pool;
+	for (int i = 0; i < threads; i++)
+		pool.push_back (thread ([&results, &score, i] () { results[i] = gChecks[i % kChecks](score); }));
+	for (int i = 0; i < threads; i++)
+		pool[i].join();
+	xml->unfreeze();
+
+	int errors = 0;
+	for (int i = 0; i < threads; i++) {
+		if (results[i] != expected[i % kChecks]) {
+			cerr << file << ": thread " << i << " " << gNames[i % kChecks] << " result differs" << endl;
+			errors++;
+		}
+	}
+	if (!errors) cout << file << ": " << threads << " threads ok" << endl;
+	return errors ? 1 : 0;
+}
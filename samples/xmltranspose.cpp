@@ -15,7 +15,7 @@
 #include "xml.h"
 #include "xmlfile.h"
 #include "xmlreader.h"
-#include "xml_tree_browser.h"
+#include "static_tree_browser.h"
 #include "transposition.h"
 
 using namespace std;
@@ -47,7 +47,7 @@ int main (int argc, char * argv[])
 	if (file) {
 		Sxmlelement elts = file->elements();
 		transposition t(interval);
-		xml_tree_browser tb(&t);
+		static_tree_browser<transposition> tb(&t);
 		tb.browse (*elts);
 		file->print (cout);
 		cout << endl;
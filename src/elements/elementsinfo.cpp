@@ -0,0 +1,9705 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+//======================================================================
+// DON'T MODIFY THIS FILE!
+// It is automatically generated from the MusicXML DTDs and from 
+// template files (located in the templates folder). 
+//======================================================================
+
+#include <string.h>
+#include "elements.h"
+#include "elementsinfo.h"
+
+namespace MusicXML2 
+{
+
+// the count of 32 bits words in a children set
+#define kChildrenWords	13
+static_assert (kChildrenWords == (kEndElement + 31) / 32, "unexpected elements count");
+
+static const attributeinfo kAttributes_accent[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_accidental[] = {
+	{ "cautionary", "yes|no", 0 },
+	{ "editorial", "yes|no", 0 },
+	{ "parentheses", "yes|no", 0 },
+	{ "bracket", "yes|no", 0 },
+	{ "size", "full|cue|grace-cue|large", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_accidental_mark[] = {
+	{ "parentheses", "yes|no", 0 },
+	{ "bracket", "yes|no", 0 },
+	{ "size", "full|cue|grace-cue|large", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "smufl", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_accidental_text[] = {
+	{ "justify", "left|center|right", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "underline", "0|1|2|3", 0 },
+	{ "overline", "0|1|2|3", 0 },
+	{ "line-through", "0|1|2|3", 0 },
+	{ "rotation", 0, 0 },
+	{ "letter-spacing", 0, 0 },
+	{ "line-height", 0, 0 },
+	{ "xml:lang", 0, 0 },
+	{ "xml:space", "default|preserve", 0 },
+	{ "dir", "ltr|rtl|lro|rlo", 0 },
+	{ "enclosure", "rectangle|square|oval|circle|bracket|triangle|diamond|pentagon|hexagon|heptagon|octagon|nonagon|decagon|none", 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_accord[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000000e
+};
+static const unsigned char kRanks_accord[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,2,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_accord[] = {
+	{ k_tuning_step, 1 },
+	{ k_tuning_alter, 2 },
+	{ k_tuning_octave, 3 },
+	{ k_tuning_octave, 3 },
+};
+static const int kStates_accord[] = { 0, 1, 3, 4, 4 };
+static const char kFinals_accord[] = { 0, 0, 0, 1 };
+static const contentmodel kModel_accord = { 4, kStates_accord, kTransitions_accord, kFinals_accord };
+static const attributeinfo kAttributes_accord[] = {
+	{ "string", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_accordion_registration[] = {
+	0x00000700, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_accordion_registration[kEndElement] = {
+	0,0,0,0,0,0,0,0,1,3,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_accordion_registration[] = {
+	{ k_accordion_high, 1 },
+	{ k_accordion_low, 3 },
+	{ k_accordion_middle, 2 },
+	{ k_accordion_low, 3 },
+	{ k_accordion_middle, 2 },
+	{ k_accordion_low, 3 },
+};
+static const int kStates_accordion_registration[] = { 0, 3, 5, 6, 6 };
+static const char kFinals_accordion_registration[] = { 1, 1, 1, 1 };
+static const contentmodel kModel_accordion_registration = { 4, kStates_accordion_registration, kTransitions_accordion_registration, kFinals_accordion_registration };
+static const attributeinfo kAttributes_accordion_registration[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_appearance[] = {
+	0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00000010, 0x00800000, 0x00000000, 0x00080100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_appearance[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_appearance[] = {
+	{ k_distance, 3 },
+	{ k_glyph, 4 },
+	{ k_line_width, 1 },
+	{ k_note_size, 2 },
+	{ k_other_appearance, 5 },
+	{ k_distance, 3 },
+	{ k_glyph, 4 },
+	{ k_line_width, 1 },
+	{ k_note_size, 2 },
+	{ k_other_appearance, 5 },
+	{ k_distance, 3 },
+	{ k_glyph, 4 },
+	{ k_note_size, 2 },
+	{ k_other_appearance, 5 },
+	{ k_distance, 3 },
+	{ k_glyph, 4 },
+	{ k_other_appearance, 5 },
+	{ k_glyph, 4 },
+	{ k_other_appearance, 5 },
+	{ k_other_appearance, 5 },
+};
+static const int kStates_appearance[] = { 0, 5, 10, 14, 17, 19, 20 };
+static const char kFinals_appearance[] = { 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_appearance = { 6, kStates_appearance, kTransitions_appearance, kFinals_appearance };
+
+static const attributeinfo kAttributes_arpeggiate[] = {
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "direction", "up|down", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "color", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_arrow[] = {
+	0x000e0000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_arrow[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,3,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_arrow[] = {
+	{ k_arrow_direction, 1 },
+	{ k_circular_arrow, 4 },
+	{ k_arrow_style, 2 },
+	{ k_arrowhead, 3 },
+	{ k_arrowhead, 3 },
+};
+static const int kStates_arrow[] = { 0, 2, 4, 5, 5, 5 };
+static const char kFinals_arrow[] = { 0, 1, 1, 1, 1 };
+static const contentmodel kModel_arrow = { 5, kStates_arrow, kTransitions_arrow, kFinals_arrow };
+static const attributeinfo kAttributes_arrow[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_articulations[] = {
+	0x00000008, 0x00006000, 0x00040100, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00100000, 0x00008000, 0x0000e080, 0x00010012, 0x00002000
+};
+static const unsigned char kRanks_articulations[kEndElement] = {
+	0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_articulations[] = {
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+	{ k_accent, 1 },
+	{ k_breath_mark, 12 },
+	{ k_caesura, 13 },
+	{ k_detached_legato, 5 },
+	{ k_doit, 10 },
+	{ k_falloff, 11 },
+	{ k_other_articulation, 17 },
+	{ k_plop, 9 },
+	{ k_scoop, 8 },
+	{ k_soft_accent, 16 },
+	{ k_spiccato, 7 },
+	{ k_staccatissimo, 6 },
+	{ k_staccato, 3 },
+	{ k_stress, 14 },
+	{ k_strong_accent, 2 },
+	{ k_tenuto, 4 },
+	{ k_unstress, 15 },
+};
+static const int kStates_articulations[] = { 0, 17, 34, 51, 68, 85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255, 272, 289, 306 };
+static const char kFinals_articulations[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_articulations = { 18, kStates_articulations, kTransitions_articulations, kFinals_articulations };
+static const attributeinfo kAttributes_articulations[] = {
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_attributes[] = {
+	0x00000000, 0x00100000, 0x00021000, 0x01000000, 0x00000000, 0x00201020, 0x00000002, 0x00000000, 0x00000200, 0x00000000, 0x02020000, 0x20200000, 0x00000000
+};
+static const unsigned char kRanks_attributes[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,8,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
+	0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,6,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,11,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_attributes[] = {
+	{ k_clef, 9 },
+	{ k_directive, 12 },
+	{ k_divisions, 3 },
+	{ k_footnote, 1 },
+	{ k_instruments, 8 },
+	{ k_key, 4 },
+	{ k_level, 2 },
+	{ k_measure_style, 13 },
+	{ k_part_symbol, 7 },
+	{ k_staff_details, 10 },
+	{ k_staves, 6 },
+	{ k_time, 5 },
+	{ k_transpose, 11 },
+	{ k_clef, 9 },
+	{ k_directive, 12 },
+	{ k_divisions, 3 },
+	{ k_instruments, 8 },
+	{ k_key, 4 },
+	{ k_level, 2 },
+	{ k_measure_style, 13 },
+	{ k_part_symbol, 7 },
+	{ k_staff_details, 10 },
+	{ k_staves, 6 },
+	{ k_time, 5 },
+	{ k_transpose, 11 },
+	{ k_clef, 9 },
+	{ k_directive, 12 },
+	{ k_divisions, 3 },
+	{ k_instruments, 8 },
+	{ k_key, 4 },
+	{ k_measure_style, 13 },
+	{ k_part_symbol, 7 },
+	{ k_staff_details, 10 },
+	{ k_staves, 6 },
+	{ k_time, 5 },
+	{ k_transpose, 11 },
+	{ k_clef, 9 },
+	{ k_directive, 12 },
+	{ k_instruments, 8 },
+	{ k_key, 4 },
+	{ k_measure_style, 13 },
+	{ k_part_symbol, 7 },
+	{ k_staff_details, 10 },
+	{ k_staves, 6 },
+	{ k_time, 5 },
+	{ k_transpose, 11 },
+	{ k_clef, 9 },
+	{ k_directive, 12 },
+	{ k_instruments, 8 },
+	{ k_key, 4 },
+	{ k_measure_style, 13 },
+	{ k_part_symbol, 7 },
+	{ k_staff_details, 10 },
+	{ k_staves, 6 },
+	{ k_time, 5 },
+	{ k_transpose, 11 },
+	{ k_clef, 9 },
+	{ k_directive, 12 },
+	{ k_instruments, 8 },
+	{ k_measure_style, 13 },
+	{ k_part_symbol, 7 },
+	{ k_staff_details, 10 },
+	{ k_staves, 6 },
+	{ k_time, 5 },
+	{ k_transpose, 11 },
+	{ k_clef, 9 },
+	{ k_directive, 12 },
+	{ k_instruments, 8 },
+	{ k_measure_style, 13 },
+	{ k_part_symbol, 7 },
+	{ k_staff_details, 10 },
+	{ k_transpose, 11 },
+	{ k_clef, 9 },
+	{ k_directive, 12 },
+	{ k_instruments, 8 },
+	{ k_measure_style, 13 },
+	{ k_staff_details, 10 },
+	{ k_transpose, 11 },
+	{ k_clef, 9 },
+	{ k_directive, 12 },
+	{ k_measure_style, 13 },
+	{ k_staff_details, 10 },
+	{ k_transpose, 11 },
+	{ k_clef, 9 },
+	{ k_directive, 12 },
+	{ k_measure_style, 13 },
+	{ k_staff_details, 10 },
+	{ k_transpose, 11 },
+	{ k_directive, 12 },
+	{ k_measure_style, 13 },
+	{ k_staff_details, 10 },
+	{ k_transpose, 11 },
+	{ k_directive, 12 },
+	{ k_measure_style, 13 },
+	{ k_transpose, 11 },
+	{ k_directive, 12 },
+	{ k_measure_style, 13 },
+	{ k_measure_style, 13 },
+};
+static const int kStates_attributes[] = { 0, 13, 25, 36, 46, 56, 65, 72, 78, 83, 88, 92, 95, 97, 98 };
+static const char kFinals_attributes[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_attributes = { 14, kStates_attributes, kTransitions_attributes, kFinals_attributes };
+
+static const unsigned kChildren_backup[] = {
+	0x00000000, 0x00000000, 0x00800000, 0x01000000, 0x00000000, 0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_backup[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_backup[] = {
+	{ k_duration, 1 },
+	{ k_footnote, 2 },
+	{ k_level, 3 },
+	{ k_level, 3 },
+};
+static const int kStates_backup[] = { 0, 1, 3, 4, 4 };
+static const char kFinals_backup[] = { 0, 1, 1, 1 };
+static const contentmodel kModel_backup = { 4, kStates_backup, kTransitions_backup, kFinals_backup };
+
+static const attributeinfo kAttributes_bar_style[] = {
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_barline[] = {
+	0x01000000, 0x00400000, 0x00000000, 0x01000404, 0x00000000, 0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00200008, 0x00000000, 0x00000000, 0x00200000
+};
+static const unsigned char kRanks_barline[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,8,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_barline[] = {
+	{ k_bar_style, 1 },
+	{ k_coda, 6 },
+	{ k_ending, 9 },
+	{ k_fermata, 7 },
+	{ k_footnote, 2 },
+	{ k_level, 3 },
+	{ k_repeat, 10 },
+	{ k_segno, 5 },
+	{ k_wavy_line, 4 },
+	{ k_coda, 6 },
+	{ k_ending, 9 },
+	{ k_fermata, 7 },
+	{ k_footnote, 2 },
+	{ k_level, 3 },
+	{ k_repeat, 10 },
+	{ k_segno, 5 },
+	{ k_wavy_line, 4 },
+	{ k_coda, 6 },
+	{ k_ending, 9 },
+	{ k_fermata, 7 },
+	{ k_level, 3 },
+	{ k_repeat, 10 },
+	{ k_segno, 5 },
+	{ k_wavy_line, 4 },
+	{ k_coda, 6 },
+	{ k_ending, 9 },
+	{ k_fermata, 7 },
+	{ k_repeat, 10 },
+	{ k_segno, 5 },
+	{ k_wavy_line, 4 },
+	{ k_coda, 6 },
+	{ k_ending, 9 },
+	{ k_fermata, 7 },
+	{ k_repeat, 10 },
+	{ k_segno, 5 },
+	{ k_coda, 6 },
+	{ k_ending, 9 },
+	{ k_fermata, 7 },
+	{ k_repeat, 10 },
+	{ k_ending, 9 },
+	{ k_fermata, 7 },
+	{ k_repeat, 10 },
+	{ k_ending, 9 },
+	{ k_fermata, 8 },
+	{ k_repeat, 10 },
+	{ k_ending, 9 },
+	{ k_repeat, 10 },
+	{ k_repeat, 10 },
+};
+static const int kStates_barline[] = { 0, 9, 17, 24, 30, 35, 39, 42, 45, 47, 48, 48 };
+static const char kFinals_barline[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_barline = { 11, kStates_barline, kTransitions_barline, kFinals_barline };
+static const attributeinfo kAttributes_barline[] = {
+	{ "location", "right|left|middle", 0 },
+	{ "segno", 0, 0 },
+	{ "coda", 0, 0 },
+	{ "divisions", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_barre[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_bass[] = {
+	0x60000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_bass[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_bass[] = {
+	{ k_bass_step, 1 },
+	{ k_bass_alter, 2 },
+};
+static const int kStates_bass[] = { 0, 1, 2, 2 };
+static const char kFinals_bass[] = { 0, 1, 1 };
+static const contentmodel kModel_bass = { 3, kStates_bass, kTransitions_bass, kFinals_bass };
+
+static const attributeinfo kAttributes_bass_alter[] = {
+	{ "print-object", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "location", "left|right", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_bass_step[] = {
+	{ "text", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_beam[] = {
+	{ "number", "1|2|3|4|5|6|7|8", 0 },
+	{ "repeater", "yes|no", 0 },
+	{ "fan", "accel|rit|none", 0 },
+	{ "color", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_beat_repeat[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_beat_repeat[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_beat_repeat[] = {
+	{ k_except_voice, 3 },
+	{ k_slash_type, 1 },
+	{ k_except_voice, 3 },
+	{ k_slash_dot, 2 },
+	{ k_except_voice, 3 },
+	{ k_slash_dot, 2 },
+	{ k_except_voice, 3 },
+};
+static const int kStates_beat_repeat[] = { 0, 2, 4, 6, 7 };
+static const char kFinals_beat_repeat[] = { 1, 1, 1, 1 };
+static const contentmodel kModel_beat_repeat = { 4, kStates_beat_repeat, kTransitions_beat_repeat, kFinals_beat_repeat };
+static const attributeinfo kAttributes_beat_repeat[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "slashes", 0, 0 },
+	{ "use-dots", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_beat_unit_tied[] = {
+	0x00000000, 0x0000000c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_beat_unit_tied[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_beat_unit_tied[] = {
+	{ k_beat_unit, 1 },
+	{ k_beat_unit_dot, 2 },
+	{ k_beat_unit_dot, 2 },
+};
+static const int kStates_beat_unit_tied[] = { 0, 1, 2, 3 };
+static const char kFinals_beat_unit_tied[] = { 0, 1, 1 };
+static const contentmodel kModel_beat_unit_tied = { 3, kStates_beat_unit_tied, kTransitions_beat_unit_tied, kFinals_beat_unit_tied };
+
+static const attributeinfo kAttributes_beater[] = {
+	{ "tip", "up|down|left|right|northwest|northeast|southeast|southwest", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_bend[] = {
+	0x00000000, 0x00000100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000000, 0x00000004, 0x00000000, 0x00000000, 0x00800000
+};
+static const unsigned char kRanks_bend[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,
+	0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0
+};
+static const transition kTransitions_bend[] = {
+	{ k_bend_alter, 1 },
+	{ k_pre_bend, 2 },
+	{ k_release, 3 },
+	{ k_with_bar, 4 },
+	{ k_with_bar, 4 },
+	{ k_with_bar, 4 },
+};
+static const int kStates_bend[] = { 0, 1, 4, 5, 6, 6 };
+static const char kFinals_bend[] = { 0, 1, 1, 1, 1 };
+static const contentmodel kModel_bend = { 5, kStates_bend, kTransitions_bend, kFinals_bend };
+static const attributeinfo kAttributes_bend[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "first-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_bookmark[] = {
+	{ "id", 0, kRequiredAttribute },
+	{ "name", 0, 0 },
+	{ "element", 0, 0 },
+	{ "position", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_bracket[] = {
+	{ "type", "start|stop|continue", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "line-end", "up|down|both|arrow|none", kRequiredAttribute },
+	{ "end-length", 0, 0 },
+	{ "line-type", "solid|dashed|dotted|wavy", 0 },
+	{ "dash-length", 0, 0 },
+	{ "space-length", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "color", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_brass_bend[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_breath_mark[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_caesura[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_cancel[] = {
+	{ "location", "left|right|before-barline", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_clef[] = {
+	0x00000000, 0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00400000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_clef[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_clef[] = {
+	{ k_sign, 1 },
+	{ k_clef_octave_change, 3 },
+	{ k_line, 2 },
+	{ k_clef_octave_change, 3 },
+};
+static const int kStates_clef[] = { 0, 1, 3, 4, 4 };
+static const char kFinals_clef[] = { 0, 1, 1, 1 };
+static const contentmodel kModel_clef = { 4, kStates_clef, kTransitions_clef, kFinals_clef };
+static const attributeinfo kAttributes_clef[] = {
+	{ "number", 0, 0 },
+	{ "additional", "yes|no", 0 },
+	{ "size", "full|cue|grace-cue|large", 0 },
+	{ "after-barline", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "print-object", "yes|no", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_coda[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "id", 0, 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_creator[] = {
+	{ "type", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_credit[] = {
+	0x00000000, 0x1e000200, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_credit[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,1,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_credit[] = {
+	{ k_bookmark, 3 },
+	{ k_credit_image, 4 },
+	{ k_credit_symbol, 6 },
+	{ k_credit_type, 1 },
+	{ k_credit_words, 5 },
+	{ k_link, 2 },
+	{ k_bookmark, 3 },
+	{ k_credit_image, 4 },
+	{ k_credit_symbol, 6 },
+	{ k_credit_type, 1 },
+	{ k_credit_words, 5 },
+	{ k_link, 2 },
+	{ k_bookmark, 3 },
+	{ k_credit_image, 4 },
+	{ k_credit_symbol, 6 },
+	{ k_credit_words, 5 },
+	{ k_link, 2 },
+	{ k_bookmark, 3 },
+	{ k_credit_image, 4 },
+	{ k_credit_symbol, 6 },
+	{ k_credit_words, 5 },
+	{ k_bookmark, 8 },
+	{ k_credit_symbol, 10 },
+	{ k_credit_words, 9 },
+	{ k_link, 7 },
+	{ k_bookmark, 8 },
+	{ k_credit_symbol, 10 },
+	{ k_credit_words, 9 },
+	{ k_link, 7 },
+	{ k_bookmark, 8 },
+	{ k_credit_symbol, 10 },
+	{ k_credit_words, 9 },
+	{ k_link, 7 },
+	{ k_bookmark, 8 },
+	{ k_credit_symbol, 10 },
+	{ k_credit_words, 9 },
+	{ k_bookmark, 8 },
+	{ k_credit_symbol, 10 },
+	{ k_credit_words, 9 },
+	{ k_link, 7 },
+	{ k_bookmark, 8 },
+	{ k_credit_symbol, 10 },
+	{ k_credit_words, 9 },
+	{ k_link, 7 },
+};
+static const int kStates_credit[] = { 0, 6, 12, 17, 21, 21, 25, 29, 33, 36, 40, 44 };
+static const char kFinals_credit[] = { 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1 };
+static const contentmodel kModel_credit = { 11, kStates_credit, kTransitions_credit, kFinals_credit };
+static const attributeinfo kAttributes_credit[] = {
+	{ "page", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_credit_image[] = {
+	{ "source", 0, kRequiredAttribute },
+	{ "type", 0, kRequiredAttribute },
+	{ "height", 0, 0 },
+	{ "width", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_credit_symbol[] = {
+	{ "justify", "left|center|right", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "underline", "0|1|2|3", 0 },
+	{ "overline", "0|1|2|3", 0 },
+	{ "line-through", "0|1|2|3", 0 },
+	{ "rotation", 0, 0 },
+	{ "letter-spacing", 0, 0 },
+	{ "line-height", 0, 0 },
+	{ "dir", "ltr|rtl|lro|rlo", 0 },
+	{ "enclosure", "rectangle|square|oval|circle|bracket|triangle|diamond|pentagon|hexagon|heptagon|octagon|nonagon|decagon|none", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_credit_words[] = {
+	{ "justify", "left|center|right", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "underline", "0|1|2|3", 0 },
+	{ "overline", "0|1|2|3", 0 },
+	{ "line-through", "0|1|2|3", 0 },
+	{ "rotation", 0, 0 },
+	{ "letter-spacing", 0, 0 },
+	{ "line-height", 0, 0 },
+	{ "xml:lang", 0, 0 },
+	{ "xml:space", "default|preserve", 0 },
+	{ "dir", "ltr|rtl|lro|rlo", 0 },
+	{ "enclosure", "rectangle|square|oval|circle|bracket|triangle|diamond|pentagon|hexagon|heptagon|octagon|nonagon|decagon|none", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_damp[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_damp_all[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_dashes[] = {
+	{ "type", "start|stop|continue", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "dash-length", 0, 0 },
+	{ "space-length", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "color", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_defaults[] = {
+	0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0c000000, 0x40000000, 0x40000000, 0x00000000, 0x00002000, 0x00100000, 0x00000800, 0x02000000
+};
+static const unsigned char kRanks_defaults[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,9,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0
+};
+static const transition kTransitions_defaults[] = {
+	{ k_appearance, 5 },
+	{ k_lyric_font, 8 },
+	{ k_lyric_language, 9 },
+	{ k_music_font, 6 },
+	{ k_page_layout, 2 },
+	{ k_scaling, 1 },
+	{ k_staff_layout, 4 },
+	{ k_system_layout, 3 },
+	{ k_word_font, 7 },
+	{ k_appearance, 5 },
+	{ k_lyric_font, 8 },
+	{ k_lyric_language, 9 },
+	{ k_music_font, 6 },
+	{ k_page_layout, 2 },
+	{ k_staff_layout, 4 },
+	{ k_system_layout, 3 },
+	{ k_word_font, 7 },
+	{ k_appearance, 5 },
+	{ k_lyric_font, 8 },
+	{ k_lyric_language, 9 },
+	{ k_music_font, 6 },
+	{ k_staff_layout, 4 },
+	{ k_system_layout, 3 },
+	{ k_word_font, 7 },
+	{ k_appearance, 5 },
+	{ k_lyric_font, 8 },
+	{ k_lyric_language, 9 },
+	{ k_music_font, 6 },
+	{ k_staff_layout, 4 },
+	{ k_word_font, 7 },
+	{ k_appearance, 5 },
+	{ k_lyric_font, 8 },
+	{ k_lyric_language, 9 },
+	{ k_music_font, 6 },
+	{ k_staff_layout, 4 },
+	{ k_word_font, 7 },
+	{ k_lyric_font, 8 },
+	{ k_lyric_language, 9 },
+	{ k_music_font, 6 },
+	{ k_word_font, 7 },
+	{ k_lyric_font, 8 },
+	{ k_lyric_language, 9 },
+	{ k_word_font, 7 },
+	{ k_lyric_font, 8 },
+	{ k_lyric_language, 9 },
+	{ k_lyric_font, 8 },
+	{ k_lyric_language, 9 },
+	{ k_lyric_language, 9 },
+};
+static const int kStates_defaults[] = { 0, 9, 17, 24, 30, 36, 40, 43, 45, 47, 48 };
+static const char kFinals_defaults[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_defaults = { 10, kStates_defaults, kTransitions_defaults, kFinals_defaults };
+
+static const unsigned kChildren_degree[] = {
+	0x00000000, 0x00000000, 0x00000038, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_degree[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,2,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_degree[] = {
+	{ k_degree_value, 1 },
+	{ k_degree_alter, 2 },
+	{ k_degree_type, 3 },
+};
+static const int kStates_degree[] = { 0, 1, 2, 3, 3 };
+static const char kFinals_degree[] = { 0, 0, 0, 1 };
+static const contentmodel kModel_degree = { 4, kStates_degree, kTransitions_degree, kFinals_degree };
+static const attributeinfo kAttributes_degree[] = {
+	{ "print-object", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_degree_alter[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "plus-minus", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_degree_type[] = {
+	{ "text", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_degree_value[] = {
+	{ "symbol", "major|minor|augmented|diminished|half-diminished", 0 },
+	{ "text", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_delayed_inverted_turn[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "start-note", "upper|main|below", 0 },
+	{ "trill-step", "whole|half|unison", 0 },
+	{ "two-note-turn", "whole|half|none", 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "second-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ "slash", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_delayed_turn[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "start-note", "upper|main|below", 0 },
+	{ "trill-step", "whole|half|unison", 0 },
+	{ "two-note-turn", "whole|half|none", 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "second-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ "slash", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_detached_legato[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_direction[] = {
+	0x00000000, 0x00000000, 0x00000800, 0x01000000, 0x00000000, 0x00200000, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00010400, 0x00000000, 0x00080000
+};
+static const unsigned char kRanks_direction[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_direction[] = {
+	{ k_direction_type, 1 },
+	{ k_direction_type, 1 },
+	{ k_footnote, 3 },
+	{ k_level, 4 },
+	{ k_offset, 2 },
+	{ k_sound, 7 },
+	{ k_staff, 6 },
+	{ k_voice, 5 },
+	{ k_footnote, 3 },
+	{ k_level, 4 },
+	{ k_sound, 7 },
+	{ k_staff, 6 },
+	{ k_voice, 5 },
+	{ k_level, 4 },
+	{ k_sound, 7 },
+	{ k_staff, 6 },
+	{ k_voice, 5 },
+	{ k_sound, 7 },
+	{ k_staff, 6 },
+	{ k_voice, 5 },
+	{ k_sound, 7 },
+	{ k_staff, 6 },
+	{ k_sound, 7 },
+};
+static const int kStates_direction[] = { 0, 1, 8, 13, 17, 20, 22, 23, 23 };
+static const char kFinals_direction[] = { 0, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_direction = { 8, kStates_direction, kTransitions_direction, kFinals_direction };
+static const attributeinfo kAttributes_direction[] = {
+	{ "placement", "above|below", 0 },
+	{ "directive", "yes|no", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_direction_type[] = {
+	0x00000800, 0xc0400800, 0x01000001, 0x00000040, 0x00800000, 0x00000001, 0x00000010, 0x00202000, 0x20008400, 0x00210001, 0x00080000, 0x00000108, 0x04400000
+};
+static const unsigned char kRanks_direction_type[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,1,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0
+};
+static const transition kTransitions_direction_type[] = {
+	{ k_accordion_registration, 22 },
+	{ k_bracket, 9 },
+	{ k_coda, 3 },
+	{ k_damp, 14 },
+	{ k_damp_all, 15 },
+	{ k_dashes, 8 },
+	{ k_dynamics, 7 },
+	{ k_eyeglasses, 16 },
+	{ k_harp_pedals, 13 },
+	{ k_image, 19 },
+	{ k_metronome, 11 },
+	{ k_octave_shift, 12 },
+	{ k_other_direction, 24 },
+	{ k_pedal, 10 },
+	{ k_percussion, 21 },
+	{ k_principal_voice, 20 },
+	{ k_rehearsal, 1 },
+	{ k_scordatura, 18 },
+	{ k_segno, 2 },
+	{ k_staff_divide, 23 },
+	{ k_string_mute, 17 },
+	{ k_symbol, 5 },
+	{ k_wedge, 6 },
+	{ k_words, 4 },
+	{ k_rehearsal, 1 },
+	{ k_segno, 2 },
+	{ k_coda, 3 },
+	{ k_symbol, 5 },
+	{ k_words, 4 },
+	{ k_symbol, 5 },
+	{ k_words, 4 },
+	{ k_dynamics, 7 },
+	{ k_percussion, 21 },
+};
+static const int kStates_direction_type[] = { 0, 24, 25, 26, 27, 29, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 33, 33 };
+static const char kFinals_direction_type[] = { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_direction_type = { 25, kStates_direction_type, kTransitions_direction_type, kFinals_direction_type };
+static const attributeinfo kAttributes_direction_type[] = {
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_directive[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "xml:lang", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_display_text[] = {
+	{ "justify", "left|center|right", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "underline", "0|1|2|3", 0 },
+	{ "overline", "0|1|2|3", 0 },
+	{ "line-through", "0|1|2|3", 0 },
+	{ "rotation", 0, 0 },
+	{ "letter-spacing", 0, 0 },
+	{ "line-height", 0, 0 },
+	{ "xml:lang", 0, 0 },
+	{ "xml:space", "default|preserve", 0 },
+	{ "dir", "ltr|rtl|lro|rlo", 0 },
+	{ "enclosure", "rectangle|square|oval|circle|bracket|triangle|diamond|pentagon|hexagon|heptagon|octagon|nonagon|decagon|none", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_distance[] = {
+	{ "type", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_doit[] = {
+	{ "line-shape", "straight|curved", 0 },
+	{ "line-type", "solid|dashed|dotted|wavy", 0 },
+	{ "line-length", "short|medium|long", 0 },
+	{ "dash-length", 0, 0 },
+	{ "space-length", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_dot[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_double_tongue[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_down_bow[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_dynamics[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x0400f880, 0x00000002, 0x00000000, 0x10002000, 0x10400001, 0x07c10000, 0x3f000060, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_dynamics[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,0,0,0,
+	0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_dynamics[] = {
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+	{ k_f, 7 },
+	{ k_ff, 8 },
+	{ k_fff, 9 },
+	{ k_ffff, 10 },
+	{ k_fffff, 11 },
+	{ k_ffffff, 12 },
+	{ k_fp, 18 },
+	{ k_fz, 23 },
+	{ k_mf, 14 },
+	{ k_mp, 13 },
+	{ k_n, 24 },
+	{ k_other_dynamics, 27 },
+	{ k_p, 1 },
+	{ k_pf, 25 },
+	{ k_pp, 2 },
+	{ k_ppp, 3 },
+	{ k_pppp, 4 },
+	{ k_ppppp, 5 },
+	{ k_pppppp, 6 },
+	{ k_rf, 19 },
+	{ k_rfz, 20 },
+	{ k_sf, 15 },
+	{ k_sffz, 22 },
+	{ k_sfp, 16 },
+	{ k_sfpp, 17 },
+	{ k_sfz, 21 },
+	{ k_sfzp, 26 },
+};
+static const int kStates_dynamics[] = { 0, 27, 54, 81, 108, 135, 162, 189, 216, 243, 270, 297, 324, 351, 378, 405, 432, 459, 486, 513, 540, 567, 594, 621, 648, 675, 702, 729, 756 };
+static const char kFinals_dynamics[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_dynamics = { 28, kStates_dynamics, kTransitions_dynamics, kFinals_dynamics };
+static const attributeinfo kAttributes_dynamics[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "placement", "above|below", 0 },
+	{ "underline", "0|1|2|3", 0 },
+	{ "overline", "0|1|2|3", 0 },
+	{ "line-through", "0|1|2|3", 0 },
+	{ "enclosure", "rectangle|square|oval|circle|bracket|triangle|diamond|pentagon|hexagon|heptagon|octagon|nonagon|decagon|none", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_elision[] = {
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_encoder[] = {
+	{ "type", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_encoding[] = {
+	0x00000000, 0x00000000, 0xd0000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000040, 0x00000000
+};
+static const unsigned char kRanks_encoding[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_encoding[] = {
+	{ k_encoder, 2 },
+	{ k_encoding_date, 1 },
+	{ k_encoding_description, 4 },
+	{ k_software, 3 },
+	{ k_supports, 5 },
+	{ k_encoder, 2 },
+	{ k_encoding_date, 1 },
+	{ k_encoding_description, 4 },
+	{ k_software, 3 },
+	{ k_supports, 5 },
+	{ k_encoder, 2 },
+	{ k_encoding_date, 1 },
+	{ k_encoding_description, 4 },
+	{ k_software, 3 },
+	{ k_supports, 5 },
+	{ k_encoder, 2 },
+	{ k_encoding_date, 1 },
+	{ k_encoding_description, 4 },
+	{ k_software, 3 },
+	{ k_supports, 5 },
+	{ k_encoder, 2 },
+	{ k_encoding_date, 1 },
+	{ k_encoding_description, 4 },
+	{ k_software, 3 },
+	{ k_supports, 5 },
+	{ k_encoder, 2 },
+	{ k_encoding_date, 1 },
+	{ k_encoding_description, 4 },
+	{ k_software, 3 },
+	{ k_supports, 5 },
+};
+static const int kStates_encoding[] = { 0, 5, 10, 15, 20, 25, 30 };
+static const char kFinals_encoding[] = { 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_encoding = { 6, kStates_encoding, kTransitions_encoding, kFinals_encoding };
+
+static const attributeinfo kAttributes_ending[] = {
+	{ "number", 0, kRequiredAttribute },
+	{ "type", "start|stop|discontinue", kRequiredAttribute },
+	{ "print-object", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "end-length", 0, 0 },
+	{ "text-x", 0, 0 },
+	{ "text-y", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_extend[] = {
+	{ "type", "start|stop|continue", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_eyeglasses[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_falloff[] = {
+	{ "line-shape", "straight|curved", 0 },
+	{ "line-type", "solid|dashed|dotted|wavy", 0 },
+	{ "line-length", "short|medium|long", 0 },
+	{ "dash-length", 0, 0 },
+	{ "space-length", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_feature[] = {
+	{ "type", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_fermata[] = {
+	{ "type", "upright|inverted", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_figure[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x01040020, 0x00000000, 0x00200000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000020, 0x00000000
+};
+static const unsigned char kRanks_figure[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,5,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_figure[] = {
+	{ k_extend, 4 },
+	{ k_figure_number, 2 },
+	{ k_footnote, 5 },
+	{ k_level, 6 },
+	{ k_prefix, 1 },
+	{ k_suffix, 3 },
+	{ k_extend, 4 },
+	{ k_figure_number, 2 },
+	{ k_footnote, 5 },
+	{ k_level, 6 },
+	{ k_suffix, 3 },
+	{ k_extend, 4 },
+	{ k_footnote, 5 },
+	{ k_level, 6 },
+	{ k_suffix, 3 },
+	{ k_extend, 4 },
+	{ k_footnote, 5 },
+	{ k_level, 6 },
+	{ k_footnote, 5 },
+	{ k_level, 6 },
+	{ k_level, 6 },
+};
+static const int kStates_figure[] = { 0, 6, 11, 15, 18, 20, 21, 21 };
+static const char kFinals_figure[] = { 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_figure = { 7, kStates_figure, kTransitions_figure, kFinals_figure };
+
+static const attributeinfo kAttributes_figure_number[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_figured_bass[] = {
+	0x00000000, 0x00000000, 0x00800000, 0x01020000, 0x00000000, 0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_figured_bass[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_figured_bass[] = {
+	{ k_figure, 1 },
+	{ k_duration, 2 },
+	{ k_figure, 1 },
+	{ k_footnote, 3 },
+	{ k_level, 4 },
+	{ k_footnote, 3 },
+	{ k_level, 4 },
+	{ k_level, 4 },
+};
+static const int kStates_figured_bass[] = { 0, 1, 5, 7, 8, 8 };
+static const char kFinals_figured_bass[] = { 0, 1, 1, 1, 1 };
+static const contentmodel kModel_figured_bass = { 5, kStates_figured_bass, kTransitions_figured_bass, kFinals_figured_bass };
+static const attributeinfo kAttributes_figured_bass[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "print-object", "yes|no", 0 },
+	{ "print-dot", "yes|no", 0 },
+	{ "print-spacing", "yes|no", 0 },
+	{ "print-lyric", "yes|no", 0 },
+	{ "parentheses", "yes|no", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_fingering[] = {
+	{ "substitution", "yes|no", 0 },
+	{ "alternate", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_fingernails[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_first_fret[] = {
+	{ "text", 0, 0 },
+	{ "location", "left|right", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_flip[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_footnote[] = {
+	{ "justify", "left|center|right", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "underline", "0|1|2|3", 0 },
+	{ "overline", "0|1|2|3", 0 },
+	{ "line-through", "0|1|2|3", 0 },
+	{ "rotation", 0, 0 },
+	{ "letter-spacing", 0, 0 },
+	{ "line-height", 0, 0 },
+	{ "xml:lang", 0, 0 },
+	{ "xml:space", "default|preserve", 0 },
+	{ "dir", "ltr|rtl|lro|rlo", 0 },
+	{ "enclosure", "rectangle|square|oval|circle|bracket|triangle|diamond|pentagon|hexagon|heptagon|octagon|nonagon|decagon|none", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_forward[] = {
+	0x00000000, 0x00000000, 0x00800000, 0x01000000, 0x00000000, 0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x00080000
+};
+static const unsigned char kRanks_forward[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_forward[] = {
+	{ k_duration, 1 },
+	{ k_footnote, 2 },
+	{ k_level, 3 },
+	{ k_staff, 5 },
+	{ k_voice, 4 },
+	{ k_level, 3 },
+	{ k_staff, 5 },
+	{ k_voice, 4 },
+	{ k_staff, 5 },
+	{ k_voice, 4 },
+	{ k_staff, 5 },
+};
+static const int kStates_forward[] = { 0, 1, 5, 8, 10, 11, 11 };
+static const char kFinals_forward[] = { 0, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_forward = { 6, kStates_forward, kTransitions_forward, kFinals_forward };
+
+static const unsigned kChildren_frame[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x70400000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_frame[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,2,4,1,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_frame[] = {
+	{ k_frame_strings, 1 },
+	{ k_frame_frets, 2 },
+	{ k_first_fret, 3 },
+	{ k_frame_note, 4 },
+	{ k_frame_note, 4 },
+	{ k_frame_note, 4 },
+};
+static const int kStates_frame[] = { 0, 1, 2, 4, 5, 6 };
+static const char kFinals_frame[] = { 0, 0, 0, 0, 1 };
+static const contentmodel kModel_frame = { 5, kStates_frame, kTransitions_frame, kFinals_frame };
+static const attributeinfo kAttributes_frame[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom", 0 },
+	{ "height", 0, 0 },
+	{ "width", 0, 0 },
+	{ "unplayed", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_frame_note[] = {
+	0x04000000, 0x00000000, 0x00000000, 0x80100000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000004, 0x00000000
+};
+static const unsigned char kRanks_frame_note[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_frame_note[] = {
+	{ k_string, 1 },
+	{ k_fret, 2 },
+	{ k_barre, 4 },
+	{ k_fingering, 3 },
+	{ k_barre, 4 },
+};
+static const int kStates_frame_note[] = { 0, 1, 2, 4, 5, 5 };
+static const char kFinals_frame_note[] = { 0, 0, 1, 1, 1 };
+static const contentmodel kModel_frame_note = { 5, kStates_frame_note, kTransitions_frame_note, kFinals_frame_note };
+
+static const attributeinfo kAttributes_fret[] = {
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_function[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_glass[] = {
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_glissando[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "line-type", "solid|dashed|dotted|wavy", 0 },
+	{ "dash-length", 0, 0 },
+	{ "space-length", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_glyph[] = {
+	{ "type", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_golpe[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_grace[] = {
+	{ "steal-time-previous", 0, 0 },
+	{ "steal-time-following", 0, 0 },
+	{ "make-time", 0, 0 },
+	{ "slash", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_group_abbreviation[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "justify", "left|center|right", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_group_abbreviation_display[] = {
+	0x00000040, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_group_abbreviation_display[kEndElement] = {
+	0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_group_abbreviation_display[] = {
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+};
+static const int kStates_group_abbreviation_display[] = { 0, 2, 4, 6 };
+static const char kFinals_group_abbreviation_display[] = { 1, 1, 1 };
+static const contentmodel kModel_group_abbreviation_display = { 3, kStates_group_abbreviation_display, kTransitions_group_abbreviation_display, kFinals_group_abbreviation_display };
+static const attributeinfo kAttributes_group_abbreviation_display[] = {
+	{ "print-object", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_group_barline[] = {
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_group_name[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "justify", "left|center|right", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_group_name_display[] = {
+	0x00000040, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_group_name_display[kEndElement] = {
+	0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_group_name_display[] = {
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+};
+static const int kStates_group_name_display[] = { 0, 2, 4, 6 };
+static const char kFinals_group_name_display[] = { 1, 1, 1 };
+static const contentmodel kModel_group_name_display = { 3, kStates_group_name_display, kTransitions_group_name_display, kFinals_group_name_display };
+static const attributeinfo kAttributes_group_name_display[] = {
+	{ "print-object", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_group_symbol[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_grouping[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_grouping[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_grouping[] = {
+	{ k_feature, 1 },
+	{ k_feature, 1 },
+};
+static const int kStates_grouping[] = { 0, 1, 2 };
+static const char kFinals_grouping[] = { 1, 1 };
+static const contentmodel kModel_grouping = { 2, kStates_grouping, kTransitions_grouping, kFinals_grouping };
+static const attributeinfo kAttributes_grouping[] = {
+	{ "type", "start|stop|single", kRequiredAttribute },
+	{ "number", 0, 0 },
+	{ "member-of", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_half_muted[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_hammer_on[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_handbell[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_harmon_closed[] = {
+	{ "location", "right|bottom|left|top", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_harmon_mute[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_harmon_mute[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_harmon_mute[] = {
+	{ k_harmon_closed, 1 },
+};
+static const int kStates_harmon_mute[] = { 0, 1, 1 };
+static const char kFinals_harmon_mute[] = { 0, 1 };
+static const contentmodel kModel_harmon_mute = { 2, kStates_harmon_mute, kTransitions_harmon_mute, kFinals_harmon_mute };
+static const attributeinfo kAttributes_harmon_mute[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_harmonic[] = {
+	0x08200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000800, 0x10000000, 0x00000000
+};
+static const unsigned char kRanks_harmonic[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,2,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_harmonic[] = {
+	{ k_artificial, 2 },
+	{ k_base_pitch, 3 },
+	{ k_natural, 1 },
+	{ k_sounding_pitch, 5 },
+	{ k_touching_pitch, 4 },
+	{ k_base_pitch, 3 },
+	{ k_sounding_pitch, 5 },
+	{ k_touching_pitch, 4 },
+	{ k_base_pitch, 3 },
+	{ k_sounding_pitch, 5 },
+	{ k_touching_pitch, 4 },
+};
+static const int kStates_harmonic[] = { 0, 5, 8, 11, 11, 11, 11 };
+static const char kFinals_harmonic[] = { 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_harmonic = { 6, kStates_harmonic, kTransitions_harmonic, kFinals_harmonic };
+static const attributeinfo kAttributes_harmonic[] = {
+	{ "print-object", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_harmony[] = {
+	0x10000000, 0x00000000, 0x00000004, 0x09000000, 0x00000001, 0x00220080, 0x00000000, 0x00004000, 0x00000000, 0x00000400, 0x00010000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_harmony[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,2,0,0,0,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,5,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_harmony[] = {
+	{ k_function, 2 },
+	{ k_root, 1 },
+	{ k_kind, 3 },
+	{ k_kind, 3 },
+	{ k_bass, 5 },
+	{ k_degree, 6 },
+	{ k_footnote, 9 },
+	{ k_frame, 7 },
+	{ k_function, 2 },
+	{ k_inversion, 4 },
+	{ k_level, 10 },
+	{ k_offset, 8 },
+	{ k_root, 1 },
+	{ k_staff, 11 },
+	{ k_bass, 5 },
+	{ k_degree, 6 },
+	{ k_footnote, 9 },
+	{ k_frame, 7 },
+	{ k_function, 2 },
+	{ k_level, 10 },
+	{ k_offset, 8 },
+	{ k_root, 1 },
+	{ k_staff, 11 },
+	{ k_degree, 6 },
+	{ k_footnote, 9 },
+	{ k_frame, 7 },
+	{ k_function, 2 },
+	{ k_level, 10 },
+	{ k_offset, 8 },
+	{ k_root, 1 },
+	{ k_staff, 11 },
+	{ k_degree, 6 },
+	{ k_footnote, 9 },
+	{ k_frame, 7 },
+	{ k_function, 2 },
+	{ k_level, 10 },
+	{ k_offset, 8 },
+	{ k_root, 1 },
+	{ k_staff, 11 },
+	{ k_footnote, 9 },
+	{ k_level, 10 },
+	{ k_offset, 8 },
+	{ k_staff, 11 },
+	{ k_footnote, 9 },
+	{ k_level, 10 },
+	{ k_staff, 11 },
+	{ k_level, 10 },
+	{ k_staff, 11 },
+	{ k_staff, 11 },
+};
+static const int kStates_harmony[] = { 0, 2, 3, 4, 14, 23, 31, 39, 43, 46, 48, 49, 49 };
+static const char kFinals_harmony[] = { 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_harmony = { 12, kStates_harmony, kTransitions_harmony, kFinals_harmony };
+static const attributeinfo kAttributes_harmony[] = {
+	{ "type", "explicit|implied|alternate", 0 },
+	{ "print-object", "yes|no", 0 },
+	{ "print-frame", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_harp_pedals[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_harp_pedals[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_harp_pedals[] = {
+	{ k_pedal_tuning, 1 },
+	{ k_pedal_tuning, 1 },
+};
+static const int kStates_harp_pedals[] = { 0, 1, 2 };
+static const char kFinals_harp_pedals[] = { 0, 1 };
+static const contentmodel kModel_harp_pedals = { 2, kStates_harp_pedals, kTransitions_harp_pedals, kFinals_harp_pedals };
+static const attributeinfo kAttributes_harp_pedals[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_haydn[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "start-note", "upper|main|below", 0 },
+	{ "trill-step", "whole|half|unison", 0 },
+	{ "two-note-turn", "whole|half|none", 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "second-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_heel[] = {
+	{ "substitution", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_hole[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x38000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_hole[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,1,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_hole[] = {
+	{ k_hole_closed, 2 },
+	{ k_hole_type, 1 },
+	{ k_hole_closed, 2 },
+	{ k_hole_shape, 3 },
+};
+static const int kStates_hole[] = { 0, 2, 3, 4, 4 };
+static const char kFinals_hole[] = { 0, 0, 1, 1 };
+static const contentmodel kModel_hole = { 4, kStates_hole, kTransitions_hole, kFinals_hole };
+static const attributeinfo kAttributes_hole[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_hole_closed[] = {
+	{ "location", "right|bottom|left|top", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_identification[] = {
+	0x00000000, 0x00800000, 0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x00400000, 0x00000000, 0x00000000, 0x00000202, 0x00001000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_identification[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,5,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_identification[] = {
+	{ k_creator, 1 },
+	{ k_encoding, 3 },
+	{ k_miscellaneous, 6 },
+	{ k_relation, 5 },
+	{ k_rights, 2 },
+	{ k_source, 4 },
+	{ k_creator, 1 },
+	{ k_encoding, 3 },
+	{ k_miscellaneous, 6 },
+	{ k_relation, 5 },
+	{ k_rights, 2 },
+	{ k_source, 4 },
+	{ k_encoding, 3 },
+	{ k_miscellaneous, 6 },
+	{ k_relation, 5 },
+	{ k_rights, 2 },
+	{ k_source, 4 },
+	{ k_miscellaneous, 6 },
+	{ k_relation, 5 },
+	{ k_source, 4 },
+	{ k_miscellaneous, 6 },
+	{ k_relation, 5 },
+	{ k_miscellaneous, 6 },
+	{ k_relation, 5 },
+};
+static const int kStates_identification[] = { 0, 6, 12, 17, 20, 22, 24, 24 };
+static const char kFinals_identification[] = { 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_identification = { 7, kStates_identification, kTransitions_identification, kFinals_identification };
+
+static const attributeinfo kAttributes_image[] = {
+	{ "source", 0, kRequiredAttribute },
+	{ "type", 0, kRequiredAttribute },
+	{ "height", 0, 0 },
+	{ "width", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_instrument[] = {
+	{ "id", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_interchangeable[] = {
+	0x00000000, 0x00000042, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000
+};
+static const unsigned char kRanks_interchangeable[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,2,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_interchangeable[] = {
+	{ k_beats, 2 },
+	{ k_time_relation, 1 },
+	{ k_beats, 2 },
+	{ k_beat_type, 3 },
+	{ k_beats, 2 },
+};
+static const int kStates_interchangeable[] = { 0, 2, 3, 4, 5 };
+static const char kFinals_interchangeable[] = { 0, 0, 0, 1 };
+static const contentmodel kModel_interchangeable = { 4, kStates_interchangeable, kTransitions_interchangeable, kFinals_interchangeable };
+static const attributeinfo kAttributes_interchangeable[] = {
+	{ "symbol", "common|cut|single-number|note|dotted-note|normal", 0 },
+	{ "separator", "none|horizontal|diagonal|vertical|adjacent", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_inversion[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_inverted_mordent[] = {
+	{ "long", "yes|no", 0 },
+	{ "approach", "above|below", 0 },
+	{ "departure", "above|below", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "start-note", "upper|main|below", 0 },
+	{ "trill-step", "whole|half|unison", 0 },
+	{ "two-note-turn", "whole|half|none", 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "second-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_inverted_turn[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "start-note", "upper|main|below", 0 },
+	{ "trill-step", "whole|half|unison", 0 },
+	{ "two-note-turn", "whole|half|none", 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "second-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ "slash", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_inverted_vertical_turn[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "start-note", "upper|main|below", 0 },
+	{ "trill-step", "whole|half|unison", 0 },
+	{ "two-note-turn", "whole|half|none", 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "second-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_key[] = {
+	0x00000000, 0x00008000, 0x00000000, 0x00010000, 0x00000000, 0x0001e000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_key[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_key[] = {
+	{ k_cancel, 1 },
+	{ k_fifths, 2 },
+	{ k_key_octave, 7 },
+	{ k_key_step, 4 },
+	{ k_fifths, 2 },
+	{ k_key_octave, 7 },
+	{ k_mode, 3 },
+	{ k_key_octave, 7 },
+	{ k_key_alter, 5 },
+	{ k_key_accidental, 6 },
+	{ k_key_octave, 7 },
+	{ k_key_step, 4 },
+	{ k_key_octave, 7 },
+	{ k_key_step, 4 },
+	{ k_key_octave, 7 },
+};
+static const int kStates_key[] = { 0, 4, 5, 7, 8, 9, 12, 14, 15 };
+static const char kFinals_key[] = { 1, 0, 1, 1, 0, 1, 1, 1 };
+static const contentmodel kModel_key = { 8, kStates_key, kTransitions_key, kFinals_key };
+static const attributeinfo kAttributes_key[] = {
+	{ "number", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "print-object", "yes|no", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_key_accidental[] = {
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_key_octave[] = {
+	{ "number", 0, kRequiredAttribute },
+	{ "cancel", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_kind[] = {
+	{ "use-symbols", "yes|no", 0 },
+	{ "text", 0, 0 },
+	{ "stack-degrees", "yes|no", 0 },
+	{ "parentheses-degrees", "yes|no", 0 },
+	{ "bracket-degrees", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_left_divider[] = {
+	{ "print-object", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_level[] = {
+	{ "reference", "yes|no", 0 },
+	{ "parentheses", "yes|no", 0 },
+	{ "bracket", "yes|no", 0 },
+	{ "size", "full|cue|grace-cue|large", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_line_width[] = {
+	{ "type", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_link[] = {
+	{ "xmlns:xlink", 0, 0 },
+	{ "xlink:href", 0, kRequiredAttribute },
+	{ "xlink:type", "simple", 0 },
+	{ "xlink:role", 0, 0 },
+	{ "xlink:title", 0, 0 },
+	{ "xlink:show", "new|replace|embed|other|none", 0 },
+	{ "xlink:actuate", "onRequest|onLoad|other|none", 0 },
+	{ "name", 0, 0 },
+	{ "element", 0, 0 },
+	{ "position", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_lyric[] = {
+	0x00000000, 0x00000000, 0x08000000, 0x01000023, 0x40000000, 0x00240000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020080, 0x00000000
+};
+static const unsigned char kRanks_lyric[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+	3,4,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,6,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_lyric[] = {
+	{ k_extend, 7 },
+	{ k_humming, 9 },
+	{ k_laughing, 8 },
+	{ k_syllabic, 1 },
+	{ k_text, 2 },
+	{ k_text, 2 },
+	{ k_elision, 3 },
+	{ k_end_line, 10 },
+	{ k_end_paragraph, 11 },
+	{ k_extend, 6 },
+	{ k_footnote, 12 },
+	{ k_level, 13 },
+	{ k_syllabic, 4 },
+	{ k_text, 5 },
+	{ k_syllabic, 4 },
+	{ k_text, 5 },
+	{ k_text, 5 },
+	{ k_elision, 3 },
+	{ k_end_line, 10 },
+	{ k_end_paragraph, 11 },
+	{ k_extend, 6 },
+	{ k_footnote, 12 },
+	{ k_level, 13 },
+	{ k_syllabic, 4 },
+	{ k_text, 5 },
+	{ k_end_line, 10 },
+	{ k_end_paragraph, 11 },
+	{ k_footnote, 12 },
+	{ k_level, 13 },
+	{ k_end_line, 10 },
+	{ k_end_paragraph, 11 },
+	{ k_footnote, 12 },
+	{ k_level, 13 },
+	{ k_end_line, 10 },
+	{ k_end_paragraph, 11 },
+	{ k_footnote, 12 },
+	{ k_level, 13 },
+	{ k_end_line, 10 },
+	{ k_end_paragraph, 11 },
+	{ k_footnote, 12 },
+	{ k_level, 13 },
+	{ k_end_paragraph, 11 },
+	{ k_footnote, 12 },
+	{ k_level, 13 },
+	{ k_footnote, 12 },
+	{ k_level, 13 },
+	{ k_level, 13 },
+};
+static const int kStates_lyric[] = { 0, 5, 6, 14, 16, 17, 25, 29, 33, 37, 41, 44, 46, 47, 47 };
+static const char kFinals_lyric[] = { 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_lyric = { 14, kStates_lyric, kTransitions_lyric, kFinals_lyric };
+static const attributeinfo kAttributes_lyric[] = {
+	{ "number", 0, 0 },
+	{ "name", 0, 0 },
+	{ "justify", "left|center|right", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "color", 0, 0 },
+	{ "print-object", "yes|no", 0 },
+	{ "time-only", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_lyric_font[] = {
+	{ "number", 0, 0 },
+	{ "name", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_lyric_language[] = {
+	{ "number", 0, 0 },
+	{ "name", 0, 0 },
+	{ "xml:lang", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_measure[] = {
+	0x02c00000, 0x00000200, 0x00000400, 0x02080000, 0x00408000, 0x01000000, 0x00000000, 0x00000080, 0x40000000, 0x00000000, 0x00000400, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_measure[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_measure[] = {
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+	{ k_attributes, 5 },
+	{ k_backup, 2 },
+	{ k_barline, 10 },
+	{ k_bookmark, 13 },
+	{ k_direction, 4 },
+	{ k_figured_bass, 7 },
+	{ k_forward, 3 },
+	{ k_grouping, 11 },
+	{ k_harmony, 6 },
+	{ k_link, 12 },
+	{ k_note, 1 },
+	{ k_print, 8 },
+	{ k_sound, 9 },
+};
+static const int kStates_measure[] = { 0, 13, 26, 39, 52, 65, 78, 91, 104, 117, 130, 143, 156, 169, 182 };
+static const char kFinals_measure[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_measure = { 14, kStates_measure, kTransitions_measure, kFinals_measure };
+static const attributeinfo kAttributes_measure[] = {
+	{ "number", 0, kRequiredAttribute },
+	{ "text", 0, 0 },
+	{ "implicit", "yes|no", 0 },
+	{ "non-controlling", "yes|no", 0 },
+	{ "width", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_measure_layout[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_measure_layout[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_measure_layout[] = {
+	{ k_measure_distance, 1 },
+};
+static const int kStates_measure_layout[] = { 0, 1, 1 };
+static const char kFinals_measure_layout[] = { 1, 1 };
+static const contentmodel kModel_measure_layout = { 2, kStates_measure_layout, kTransitions_measure_layout, kFinals_measure_layout };
+
+static const attributeinfo kAttributes_measure_numbering[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_measure_repeat[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "slashes", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_measure_style[] = {
+	0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_measure_style[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_measure_style[] = {
+	{ k_beat_repeat, 3 },
+	{ k_measure_repeat, 2 },
+	{ k_multiple_rest, 1 },
+	{ k_slash, 4 },
+};
+static const int kStates_measure_style[] = { 0, 4, 4, 4, 4, 4 };
+static const char kFinals_measure_style[] = { 0, 1, 1, 1, 1 };
+static const contentmodel kModel_measure_style = { 5, kStates_measure_style, kTransitions_measure_style, kFinals_measure_style };
+static const attributeinfo kAttributes_measure_style[] = {
+	{ "number", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_metronome[] = {
+	0x00000000, 0x0000001c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000320, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_metronome[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,1,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_metronome[] = {
+	{ k_beat_unit, 1 },
+	{ k_metronome_arrows, 8 },
+	{ k_metronome_note, 9 },
+	{ k_beat_unit, 5 },
+	{ k_beat_unit_dot, 2 },
+	{ k_beat_unit_tied, 3 },
+	{ k_per_minute, 4 },
+	{ k_beat_unit, 5 },
+	{ k_beat_unit_dot, 2 },
+	{ k_beat_unit_tied, 3 },
+	{ k_per_minute, 4 },
+	{ k_beat_unit, 5 },
+	{ k_beat_unit_tied, 3 },
+	{ k_per_minute, 4 },
+	{ k_beat_unit_dot, 6 },
+	{ k_beat_unit_tied, 7 },
+	{ k_beat_unit_dot, 6 },
+	{ k_beat_unit_tied, 7 },
+	{ k_beat_unit_tied, 7 },
+	{ k_metronome_note, 9 },
+	{ k_metronome_note, 9 },
+	{ k_metronome_relation, 10 },
+	{ k_metronome_note, 11 },
+	{ k_metronome_note, 11 },
+};
+static const int kStates_metronome[] = { 0, 3, 7, 11, 14, 14, 16, 18, 19, 20, 22, 23, 24 };
+static const char kFinals_metronome[] = { 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 0, 1 };
+static const contentmodel kModel_metronome = { 12, kStates_metronome, kTransitions_metronome, kFinals_metronome };
+static const attributeinfo kAttributes_metronome[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "justify", "left|center|right", 0 },
+	{ "parentheses", "yes|no", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_metronome_beam[] = {
+	{ "number", "1|2|3|4|5|6|7|8", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_metronome_note[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001cc0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_metronome_note[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,3,2,0,0,4,5,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_metronome_note[] = {
+	{ k_metronome_type, 1 },
+	{ k_metronome_beam, 3 },
+	{ k_metronome_dot, 2 },
+	{ k_metronome_tied, 4 },
+	{ k_metronome_tuplet, 5 },
+	{ k_metronome_beam, 3 },
+	{ k_metronome_dot, 2 },
+	{ k_metronome_tied, 4 },
+	{ k_metronome_tuplet, 5 },
+	{ k_metronome_beam, 3 },
+	{ k_metronome_tied, 4 },
+	{ k_metronome_tuplet, 5 },
+	{ k_metronome_tuplet, 5 },
+};
+static const int kStates_metronome_note[] = { 0, 1, 5, 9, 12, 13, 13 };
+static const char kFinals_metronome_note[] = { 0, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_metronome_note = { 6, kStates_metronome_note, kTransitions_metronome_note, kFinals_metronome_note };
+
+static const attributeinfo kAttributes_metronome_tied[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_metronome_tuplet[] = {
+	0x00001000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000038, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_metronome_tuplet[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_metronome_tuplet[] = {
+	{ k_actual_notes, 1 },
+	{ k_normal_notes, 2 },
+	{ k_normal_type, 3 },
+	{ k_normal_dot, 4 },
+	{ k_normal_dot, 4 },
+};
+static const int kStates_metronome_tuplet[] = { 0, 1, 2, 3, 4, 5 };
+static const char kFinals_metronome_tuplet[] = { 0, 0, 1, 1, 1 };
+static const contentmodel kModel_metronome_tuplet = { 5, kStates_metronome_tuplet, kTransitions_metronome_tuplet, kFinals_metronome_tuplet };
+static const attributeinfo kAttributes_metronome_tuplet[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "bracket", "yes|no", 0 },
+	{ "show-number", "actual|both|none", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_midi_device[] = {
+	{ "port", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_midi_instrument[] = {
+	0x00000000, 0x00000000, 0x04000000, 0x00000000, 0x00000000, 0x00000000, 0x001cc000, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00100000
+};
+static const unsigned char kRanks_midi_instrument[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,1,0,0,2,4,5,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_midi_instrument[] = {
+	{ k_elevation, 8 },
+	{ k_midi_bank, 3 },
+	{ k_midi_channel, 1 },
+	{ k_midi_name, 2 },
+	{ k_midi_program, 4 },
+	{ k_midi_unpitched, 5 },
+	{ k_pan, 7 },
+	{ k_volume, 6 },
+	{ k_elevation, 8 },
+	{ k_midi_bank, 3 },
+	{ k_midi_name, 2 },
+	{ k_midi_program, 4 },
+	{ k_midi_unpitched, 5 },
+	{ k_pan, 7 },
+	{ k_volume, 6 },
+	{ k_elevation, 8 },
+	{ k_midi_bank, 3 },
+	{ k_midi_program, 4 },
+	{ k_midi_unpitched, 5 },
+	{ k_pan, 7 },
+	{ k_volume, 6 },
+	{ k_elevation, 8 },
+	{ k_midi_program, 4 },
+	{ k_midi_unpitched, 5 },
+	{ k_pan, 7 },
+	{ k_volume, 6 },
+	{ k_elevation, 8 },
+	{ k_midi_unpitched, 5 },
+	{ k_pan, 7 },
+	{ k_volume, 6 },
+	{ k_elevation, 8 },
+	{ k_pan, 7 },
+	{ k_volume, 6 },
+	{ k_elevation, 8 },
+	{ k_pan, 7 },
+	{ k_elevation, 8 },
+};
+static const int kStates_midi_instrument[] = { 0, 8, 15, 21, 26, 30, 33, 35, 36, 36 };
+static const char kFinals_midi_instrument[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_midi_instrument = { 9, kStates_midi_instrument, kTransitions_midi_instrument, kFinals_midi_instrument };
+static const attributeinfo kAttributes_midi_instrument[] = {
+	{ "id", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_miscellaneous[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_miscellaneous[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_miscellaneous[] = {
+	{ k_miscellaneous_field, 1 },
+	{ k_miscellaneous_field, 1 },
+};
+static const int kStates_miscellaneous[] = { 0, 1, 2 };
+static const char kFinals_miscellaneous[] = { 1, 1 };
+static const contentmodel kModel_miscellaneous = { 2, kStates_miscellaneous, kTransitions_miscellaneous, kFinals_miscellaneous };
+
+static const attributeinfo kAttributes_miscellaneous_field[] = {
+	{ "name", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_mordent[] = {
+	{ "long", "yes|no", 0 },
+	{ "approach", "above|below", 0 },
+	{ "departure", "above|below", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "start-note", "upper|main|below", 0 },
+	{ "trill-step", "whole|half|unison", 0 },
+	{ "two-note-turn", "whole|half|none", 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "second-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_multiple_rest[] = {
+	{ "use-symbols", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_music_font[] = {
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_non_arpeggiate[] = {
+	{ "type", "top|bottom", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "color", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_notations[] = {
+	0x00108020, 0x00000000, 0x01000000, 0x01000400, 0x00000008, 0x00200000, 0x00000000, 0x00840004, 0x00000000, 0x00000000, 0x00000018, 0x00104000, 0x00000010
+};
+static const unsigned char kRanks_notations[kEndElement] = {
+	0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,3,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+	0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,3,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_notations[] = {
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_footnote, 1 },
+	{ k_glissando, 6 },
+	{ k_level, 2 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_level, 2 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+	{ k_accidental_mark, 15 },
+	{ k_arpeggiate, 13 },
+	{ k_articulations, 10 },
+	{ k_dynamics, 11 },
+	{ k_fermata, 12 },
+	{ k_glissando, 6 },
+	{ k_non_arpeggiate, 14 },
+	{ k_ornaments, 8 },
+	{ k_other_notation, 16 },
+	{ k_slide, 7 },
+	{ k_slur, 4 },
+	{ k_technical, 9 },
+	{ k_tied, 3 },
+	{ k_tuplet, 5 },
+};
+static const int kStates_notations[] = { 0, 16, 31, 45, 59, 73, 87, 101, 115, 129, 143, 157, 171, 185, 199, 213, 227, 241 };
+static const char kFinals_notations[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_notations = { 17, kStates_notations, kTransitions_notations, kFinals_notations };
+static const attributeinfo kAttributes_notations[] = {
+	{ "print-object", "yes|no", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_note[] = {
+	0x80000010, 0x20020000, 0x00880000, 0x01000000, 0x00000040, 0x02200002, 0x00000000, 0x00000640, 0x000a0000, 0x00000010, 0x04010000, 0x00480000, 0x00081800
+};
+static const unsigned char kRanks_note[kEndElement] = {
+	0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,5,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,21,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,20,0,0,16,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,22,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,0,0,15,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,14,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,11,4,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_note[] = {
+	{ k_chord, 19 },
+	{ k_cue, 13 },
+	{ k_grace, 1 },
+	{ k_pitch, 20 },
+	{ k_rest, 22 },
+	{ k_unpitched, 21 },
+	{ k_chord, 2 },
+	{ k_cue, 8 },
+	{ k_pitch, 3 },
+	{ k_rest, 5 },
+	{ k_unpitched, 4 },
+	{ k_pitch, 3 },
+	{ k_rest, 5 },
+	{ k_unpitched, 4 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_instrument, 26 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_tie, 6 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_instrument, 26 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_tie, 6 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_instrument, 26 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_tie, 6 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_instrument, 26 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_tie, 7 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_instrument, 26 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_chord, 9 },
+	{ k_pitch, 10 },
+	{ k_rest, 12 },
+	{ k_unpitched, 11 },
+	{ k_pitch, 10 },
+	{ k_rest, 12 },
+	{ k_unpitched, 11 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_instrument, 26 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_instrument, 26 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_instrument, 26 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_chord, 14 },
+	{ k_pitch, 15 },
+	{ k_rest, 17 },
+	{ k_unpitched, 16 },
+	{ k_pitch, 15 },
+	{ k_rest, 17 },
+	{ k_unpitched, 16 },
+	{ k_duration, 18 },
+	{ k_duration, 18 },
+	{ k_duration, 18 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_instrument, 26 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_pitch, 20 },
+	{ k_rest, 22 },
+	{ k_unpitched, 21 },
+	{ k_duration, 23 },
+	{ k_duration, 23 },
+	{ k_duration, 23 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_instrument, 26 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_tie, 24 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_instrument, 26 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_tie, 25 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_instrument, 26 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_footnote, 27 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_level, 28 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_voice, 29 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_type, 30 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_accidental, 32 },
+	{ k_beam, 38 },
+	{ k_dot, 31 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_beam, 38 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_time_modification, 33 },
+	{ k_beam, 38 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_stem, 34 },
+	{ k_beam, 38 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead, 35 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_beam, 38 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_notehead_text, 36 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_beam, 38 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_play, 41 },
+	{ k_staff, 37 },
+	{ k_beam, 38 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_play, 41 },
+	{ k_beam, 38 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_play, 41 },
+	{ k_lyric, 40 },
+	{ k_notations, 39 },
+	{ k_play, 41 },
+	{ k_lyric, 40 },
+	{ k_play, 41 },
+};
+static const int kStates_note[] = { 0, 6, 11, 14, 31, 48, 65, 82, 98, 102, 105, 121, 137, 153, 157, 160, 161, 162, 163, 179, 182, 183, 184, 185, 202, 219, 235, 250, 264, 277, 289, 300, 311, 320, 328, 335, 341, 346, 350, 354, 357, 359, 359 };
+static const char kFinals_note[] = { 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_note = { 42, kStates_note, kTransitions_note, kFinals_note };
+static const attributeinfo kAttributes_note[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "print-object", "yes|no", 0 },
+	{ "print-dot", "yes|no", 0 },
+	{ "print-spacing", "yes|no", 0 },
+	{ "print-lyric", "yes|no", 0 },
+	{ "print-leger", "yes|no", 0 },
+	{ "dynamics", 0, 0 },
+	{ "end-dynamics", 0, 0 },
+	{ "attack", 0, 0 },
+	{ "release", 0, 0 },
+	{ "time-only", 0, 0 },
+	{ "pizzicato", "yes|no", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_note_size[] = {
+	{ "type", "cue|grace|grace-cue|large", kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_notehead[] = {
+	{ "filled", "yes|no", 0 },
+	{ "parentheses", "yes|no", 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_notehead_text[] = {
+	0x00000040, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_notehead_text[kEndElement] = {
+	0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_notehead_text[] = {
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+};
+static const int kStates_notehead_text[] = { 0, 2, 4, 6 };
+static const char kFinals_notehead_text[] = { 0, 1, 1 };
+static const contentmodel kModel_notehead_text = { 3, kStates_notehead_text, kTransitions_notehead_text, kFinals_notehead_text };
+
+static const attributeinfo kAttributes_octave_shift[] = {
+	{ "type", "up|down|stop|continue", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "size", 0, 0 },
+	{ "dash-length", 0, 0 },
+	{ "space-length", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_offset[] = {
+	{ "sound", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_open[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_open_string[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_opus[] = {
+	{ "xmlns:xlink", 0, 0 },
+	{ "xlink:href", 0, kRequiredAttribute },
+	{ "xlink:type", "simple", 0 },
+	{ "xlink:role", 0, 0 },
+	{ "xlink:title", 0, 0 },
+	{ "xlink:show", "new|replace|embed|other|none", 0 },
+	{ "xlink:actuate", "onRequest|onLoad|other|none", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_ornaments[] = {
+	0x00000020, 0x00000000, 0x000000c0, 0x00000000, 0x01000000, 0x00000700, 0x02000000, 0x01000000, 0x00000000, 0x40004000, 0x00000000, 0xc0000000, 0x00208400
+};
+static const unsigned char kRanks_ornaments[kEndElement] = {
+	0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,
+	0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_ornaments[] = {
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+	{ k_accidental_mark, 16 },
+	{ k_delayed_inverted_turn, 5 },
+	{ k_delayed_turn, 3 },
+	{ k_haydn, 14 },
+	{ k_inverted_mordent, 11 },
+	{ k_inverted_turn, 4 },
+	{ k_inverted_vertical_turn, 7 },
+	{ k_mordent, 10 },
+	{ k_other_ornament, 15 },
+	{ k_schleifer, 12 },
+	{ k_shake, 8 },
+	{ k_tremolo, 13 },
+	{ k_trill_mark, 1 },
+	{ k_turn, 2 },
+	{ k_vertical_turn, 6 },
+	{ k_wavy_line, 9 },
+};
+static const int kStates_ornaments[] = { 0, 15, 31, 47, 63, 79, 95, 111, 127, 143, 159, 175, 191, 207, 223, 239, 255, 271 };
+static const char kFinals_ornaments[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_ornaments = { 17, kStates_ornaments, kTransitions_ornaments, kFinals_ornaments };
+static const attributeinfo kAttributes_ornaments[] = {
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_other_appearance[] = {
+	{ "type", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_other_articulation[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_other_direction[] = {
+	{ "print-object", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "smufl", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_other_dynamics[] = {
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_other_notation[] = {
+	{ "type", "start|stop|single", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "print-object", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "smufl", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_other_ornament[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_other_percussion[] = {
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_other_play[] = {
+	{ "type", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_other_technical[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_page_layout[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa0000000, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_page_layout[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,3,
+	2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_page_layout[] = {
+	{ k_page_height, 1 },
+	{ k_page_margins, 3 },
+	{ k_page_width, 2 },
+	{ k_page_margins, 3 },
+	{ k_page_margins, 4 },
+};
+static const int kStates_page_layout[] = { 0, 2, 3, 4, 5, 5 };
+static const char kFinals_page_layout[] = { 1, 0, 1, 1, 1 };
+static const contentmodel kModel_page_layout = { 5, kStates_page_layout, kTransitions_page_layout, kFinals_page_layout };
+
+static const unsigned kChildren_page_margins[] = {
+	0x00000000, 0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000000, 0x04000000, 0x00000000
+};
+static const unsigned char kRanks_page_margins[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_page_margins[] = {
+	{ k_left_margin, 1 },
+	{ k_right_margin, 2 },
+	{ k_top_margin, 3 },
+	{ k_bottom_margin, 4 },
+};
+static const int kStates_page_margins[] = { 0, 1, 2, 3, 4, 4 };
+static const char kFinals_page_margins[] = { 0, 0, 0, 0, 1 };
+static const contentmodel kModel_page_margins = { 5, kStates_page_margins, kTransitions_page_margins, kFinals_page_margins };
+static const attributeinfo kAttributes_page_margins[] = {
+	{ "type", "odd|even|both", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_part[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_part[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_part[] = {
+	{ k_measure, 1 },
+	{ k_measure, 1 },
+};
+static const int kStates_part[] = { 0, 1, 2 };
+static const char kFinals_part[] = { 0, 1 };
+static const contentmodel kModel_part = { 2, kStates_part, kTransitions_part, kFinals_part };
+static const attributeinfo kAttributes_part[] = {
+	{ "id", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_part_abbreviation[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "print-object", "yes|no", 0 },
+	{ "justify", "left|center|right", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_part_abbreviation_display[] = {
+	0x00000040, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_part_abbreviation_display[kEndElement] = {
+	0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_part_abbreviation_display[] = {
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+};
+static const int kStates_part_abbreviation_display[] = { 0, 2, 4, 6 };
+static const char kFinals_part_abbreviation_display[] = { 1, 1, 1 };
+static const contentmodel kModel_part_abbreviation_display = { 3, kStates_part_abbreviation_display, kTransitions_part_abbreviation_display, kFinals_part_abbreviation_display };
+static const attributeinfo kAttributes_part_abbreviation_display[] = {
+	{ "print-object", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_part_group[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x00007f00, 0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_part_group[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,3,4,6,1,2,5,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_part_group[] = {
+	{ k_footnote, 8 },
+	{ k_group_abbreviation, 3 },
+	{ k_group_abbreviation_display, 4 },
+	{ k_group_barline, 6 },
+	{ k_group_name, 1 },
+	{ k_group_name_display, 2 },
+	{ k_group_symbol, 5 },
+	{ k_group_time, 7 },
+	{ k_level, 9 },
+	{ k_footnote, 8 },
+	{ k_group_abbreviation, 3 },
+	{ k_group_abbreviation_display, 4 },
+	{ k_group_barline, 6 },
+	{ k_group_name_display, 2 },
+	{ k_group_symbol, 5 },
+	{ k_group_time, 7 },
+	{ k_level, 9 },
+	{ k_footnote, 8 },
+	{ k_group_abbreviation, 3 },
+	{ k_group_abbreviation_display, 4 },
+	{ k_group_barline, 6 },
+	{ k_group_symbol, 5 },
+	{ k_group_time, 7 },
+	{ k_level, 9 },
+	{ k_footnote, 8 },
+	{ k_group_abbreviation_display, 4 },
+	{ k_group_barline, 6 },
+	{ k_group_symbol, 5 },
+	{ k_group_time, 7 },
+	{ k_level, 9 },
+	{ k_footnote, 8 },
+	{ k_group_barline, 6 },
+	{ k_group_symbol, 5 },
+	{ k_group_time, 7 },
+	{ k_level, 9 },
+	{ k_footnote, 8 },
+	{ k_group_barline, 6 },
+	{ k_group_time, 7 },
+	{ k_level, 9 },
+	{ k_footnote, 8 },
+	{ k_group_time, 7 },
+	{ k_level, 9 },
+	{ k_footnote, 8 },
+	{ k_level, 9 },
+	{ k_level, 9 },
+};
+static const int kStates_part_group[] = { 0, 9, 17, 24, 30, 35, 39, 42, 44, 45, 45 };
+static const char kFinals_part_group[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_part_group = { 10, kStates_part_group, kTransitions_part_group, kFinals_part_group };
+static const attributeinfo kAttributes_part_group[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "number", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_part_list[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000020, 0x00040000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_part_list[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_part_list[] = {
+	{ k_part_group, 1 },
+	{ k_score_part, 2 },
+	{ k_part_group, 1 },
+	{ k_score_part, 2 },
+	{ k_part_group, 3 },
+	{ k_score_part, 4 },
+	{ k_part_group, 3 },
+	{ k_score_part, 4 },
+	{ k_part_group, 3 },
+	{ k_score_part, 4 },
+};
+static const int kStates_part_list[] = { 0, 2, 4, 6, 8, 10 };
+static const char kFinals_part_list[] = { 0, 0, 1, 1, 1 };
+static const contentmodel kModel_part_list = { 5, kStates_part_list, kTransitions_part_list, kFinals_part_list };
+
+static const attributeinfo kAttributes_part_name[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "print-object", "yes|no", 0 },
+	{ "justify", "left|center|right", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_part_name_display[] = {
+	0x00000040, 0x00000000, 0x00008000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_part_name_display[kEndElement] = {
+	0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_part_name_display[] = {
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+	{ k_accidental_text, 2 },
+	{ k_display_text, 1 },
+};
+static const int kStates_part_name_display[] = { 0, 2, 4, 6 };
+static const char kFinals_part_name_display[] = { 1, 1, 1 };
+static const contentmodel kModel_part_name_display = { 3, kStates_part_name_display, kTransitions_part_name_display, kFinals_part_name_display };
+static const attributeinfo kAttributes_part_name_display[] = {
+	{ "print-object", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_part_symbol[] = {
+	{ "top-staff", 0, 0 },
+	{ "bottom-staff", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_pedal[] = {
+	{ "type", "start|stop|sostenuto|continue|change", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "line", "yes|no", 0 },
+	{ "sign", "yes|no", 0 },
+	{ "abbreviated", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_pedal_tuning[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001800, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_pedal_tuning[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_pedal_tuning[] = {
+	{ k_pedal_step, 1 },
+	{ k_pedal_alter, 2 },
+};
+static const int kStates_pedal_tuning[] = { 0, 1, 2, 2 };
+static const char kFinals_pedal_tuning[] = { 0, 0, 1 };
+static const contentmodel kModel_pedal_tuning = { 3, kStates_pedal_tuning, kTransitions_pedal_tuning, kFinals_pedal_tuning };
+
+static const attributeinfo kAttributes_per_minute[] = {
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_percussion[] = {
+	0x00000000, 0x00000020, 0x02000000, 0x00000000, 0x00000004, 0x00000000, 0x0000000c, 0x02000000, 0x00040000, 0x00000000, 0x30000000, 0x01000000, 0x01000000
+};
+static const unsigned char kRanks_percussion[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0
+};
+static const transition kTransitions_percussion[] = {
+	{ k_beater, 8 },
+	{ k_effect, 6 },
+	{ k_glass, 1 },
+	{ k_membrane, 5 },
+	{ k_metal, 2 },
+	{ k_other_percussion, 11 },
+	{ k_pitched, 4 },
+	{ k_stick, 9 },
+	{ k_stick_location, 10 },
+	{ k_timpani, 7 },
+	{ k_wood, 3 },
+};
+static const int kStates_percussion[] = { 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11 };
+static const char kFinals_percussion[] = { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_percussion = { 12, kStates_percussion, kTransitions_percussion, kFinals_percussion };
+static const attributeinfo kAttributes_percussion[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "enclosure", "rectangle|square|oval|circle|bracket|triangle|diamond|pentagon|hexagon|heptagon|octagon|nonagon|decagon|none", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_pitch[] = {
+	0x00002000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x00000000, 0x00000000, 0x08000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_pitch[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_pitch[] = {
+	{ k_step, 1 },
+	{ k_alter, 2 },
+	{ k_octave, 3 },
+	{ k_octave, 3 },
+};
+static const int kStates_pitch[] = { 0, 1, 3, 4, 4 };
+static const char kFinals_pitch[] = { 0, 0, 0, 1 };
+static const contentmodel kModel_pitch = { 4, kStates_pitch, kTransitions_pitch, kFinals_pitch };
+
+static const attributeinfo kAttributes_pitched[] = {
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_play[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000800, 0x80000000, 0x04000000, 0x00000000, 0x00400000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_play[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_play[] = {
+	{ k_ipa, 1 },
+	{ k_mute, 2 },
+	{ k_other_play, 4 },
+	{ k_semi_pitched, 3 },
+	{ k_ipa, 1 },
+	{ k_mute, 2 },
+	{ k_other_play, 4 },
+	{ k_semi_pitched, 3 },
+	{ k_ipa, 1 },
+	{ k_mute, 2 },
+	{ k_other_play, 4 },
+	{ k_semi_pitched, 3 },
+	{ k_ipa, 1 },
+	{ k_mute, 2 },
+	{ k_other_play, 4 },
+	{ k_semi_pitched, 3 },
+	{ k_ipa, 1 },
+	{ k_mute, 2 },
+	{ k_other_play, 4 },
+	{ k_semi_pitched, 3 },
+};
+static const int kStates_play[] = { 0, 4, 8, 12, 16, 20 };
+static const char kFinals_play[] = { 1, 1, 1, 1, 1 };
+static const contentmodel kModel_play = { 5, kStates_play, kTransitions_play, kFinals_play };
+static const attributeinfo kAttributes_play[] = {
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_plop[] = {
+	{ "line-shape", "straight|curved", 0 },
+	{ "line-type", "solid|dashed|dotted|wavy", 0 },
+	{ "line-length", "short|medium|long", 0 },
+	{ "dash-length", 0, 0 },
+	{ "space-length", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_pluck[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_prefix[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_principal_voice[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "symbol", "Hauptstimme|Nebenstimme|plain|none", kRequiredAttribute },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_print[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x40000000, 0x00000110, 0x00000000, 0x00100000, 0x00000800, 0x00000000
+};
+static const unsigned char kRanks_print[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+	0,0,0,0,7,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_print[] = {
+	{ k_measure_layout, 4 },
+	{ k_measure_numbering, 5 },
+	{ k_page_layout, 1 },
+	{ k_part_abbreviation_display, 7 },
+	{ k_part_name_display, 6 },
+	{ k_staff_layout, 3 },
+	{ k_system_layout, 2 },
+	{ k_measure_layout, 4 },
+	{ k_measure_numbering, 5 },
+	{ k_part_abbreviation_display, 7 },
+	{ k_part_name_display, 6 },
+	{ k_staff_layout, 3 },
+	{ k_system_layout, 2 },
+	{ k_measure_layout, 4 },
+	{ k_measure_numbering, 5 },
+	{ k_part_abbreviation_display, 7 },
+	{ k_part_name_display, 6 },
+	{ k_staff_layout, 3 },
+	{ k_measure_layout, 4 },
+	{ k_measure_numbering, 5 },
+	{ k_part_abbreviation_display, 7 },
+	{ k_part_name_display, 6 },
+	{ k_staff_layout, 3 },
+	{ k_measure_numbering, 5 },
+	{ k_part_abbreviation_display, 7 },
+	{ k_part_name_display, 6 },
+	{ k_part_abbreviation_display, 7 },
+	{ k_part_name_display, 6 },
+	{ k_part_abbreviation_display, 7 },
+};
+static const int kStates_print[] = { 0, 7, 13, 18, 23, 26, 28, 29, 29 };
+static const char kFinals_print[] = { 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_print = { 8, kStates_print, kTransitions_print, kFinals_print };
+static const attributeinfo kAttributes_print[] = {
+	{ "staff-spacing", 0, 0 },
+	{ "new-system", "yes|no", 0 },
+	{ "new-page", "yes|no", 0 },
+	{ "blank-page", 0, 0 },
+	{ "page-number", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_pull_off[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_rehearsal[] = {
+	{ "justify", "left|center|right", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "underline", "0|1|2|3", 0 },
+	{ "overline", "0|1|2|3", 0 },
+	{ "line-through", "0|1|2|3", 0 },
+	{ "rotation", 0, 0 },
+	{ "letter-spacing", 0, 0 },
+	{ "line-height", 0, 0 },
+	{ "xml:lang", 0, 0 },
+	{ "xml:space", "default|preserve", 0 },
+	{ "dir", "ltr|rtl|lro|rlo", 0 },
+	{ "enclosure", "rectangle|square|oval|circle|bracket|triangle|diamond|pentagon|hexagon|heptagon|octagon|nonagon|decagon|none", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_relation[] = {
+	{ "type", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_repeat[] = {
+	{ "direction", "backward|forward", kRequiredAttribute },
+	{ "times", 0, 0 },
+	{ "winged", "none|straight|curved|double-straight|double-curved", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_rest[] = {
+	0x00000000, 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_rest[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_rest[] = {
+	{ k_display_step, 1 },
+	{ k_display_octave, 2 },
+};
+static const int kStates_rest[] = { 0, 1, 2, 2 };
+static const char kFinals_rest[] = { 1, 0, 1 };
+static const contentmodel kModel_rest = { 3, kStates_rest, kTransitions_rest, kFinals_rest };
+static const attributeinfo kAttributes_rest[] = {
+	{ "measure", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_right_divider[] = {
+	{ "print-object", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_rights[] = {
+	{ "type", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_root[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001800, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_root[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_root[] = {
+	{ k_root_step, 1 },
+	{ k_root_alter, 2 },
+};
+static const int kStates_root[] = { 0, 1, 2, 2 };
+static const char kFinals_root[] = { 0, 1, 1 };
+static const contentmodel kModel_root = { 3, kStates_root, kTransitions_root, kFinals_root };
+
+static const attributeinfo kAttributes_root_alter[] = {
+	{ "print-object", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "location", "left|right", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_root_step[] = {
+	{ "text", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_scaling[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00200000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008000, 0x00000000
+};
+static const unsigned char kRanks_scaling[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_scaling[] = {
+	{ k_millimeters, 1 },
+	{ k_tenths, 2 },
+};
+static const int kStates_scaling[] = { 0, 1, 2, 2 };
+static const char kFinals_scaling[] = { 0, 0, 1 };
+static const contentmodel kModel_scaling = { 3, kStates_scaling, kTransitions_scaling, kFinals_scaling };
+
+static const attributeinfo kAttributes_schleifer[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_scoop[] = {
+	{ "line-shape", "straight|curved", 0 },
+	{ "line-type", "solid|dashed|dotted|wavy", 0 },
+	{ "line-length", "short|medium|long", 0 },
+	{ "dash-length", 0, 0 },
+	{ "space-length", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_scordatura[] = {
+	0x00000080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_scordatura[kEndElement] = {
+	0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_scordatura[] = {
+	{ k_accord, 1 },
+	{ k_accord, 1 },
+};
+static const int kStates_scordatura[] = { 0, 1, 2 };
+static const char kFinals_scordatura[] = { 0, 1 };
+static const contentmodel kModel_scordatura = { 2, kStates_scordatura, kTransitions_scordatura, kFinals_scordatura };
+static const attributeinfo kAttributes_scordatura[] = {
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_score_instrument[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000008, 0x00000000, 0x0000001c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000, 0x00010000
+};
+static const unsigned char kRanks_score_instrument[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,2,1,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_score_instrument[] = {
+	{ k_instrument_name, 1 },
+	{ k_ensemble, 5 },
+	{ k_instrument_abbreviation, 2 },
+	{ k_instrument_sound, 3 },
+	{ k_solo, 4 },
+	{ k_virtual_instrument, 6 },
+	{ k_ensemble, 5 },
+	{ k_instrument_sound, 3 },
+	{ k_solo, 4 },
+	{ k_virtual_instrument, 6 },
+	{ k_ensemble, 5 },
+	{ k_solo, 4 },
+	{ k_virtual_instrument, 6 },
+	{ k_virtual_instrument, 6 },
+	{ k_virtual_instrument, 6 },
+};
+static const int kStates_score_instrument[] = { 0, 1, 6, 10, 13, 14, 15, 15 };
+static const char kFinals_score_instrument[] = { 0, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_score_instrument = { 7, kStates_score_instrument, kTransitions_score_instrument, kFinals_score_instrument };
+static const attributeinfo kAttributes_score_instrument[] = {
+	{ "id", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_score_part[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000080, 0x00000000, 0x00030000, 0x00000000, 0x00000198, 0x00020000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_score_part[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,5,0,0,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_score_part[] = {
+	{ k_identification, 1 },
+	{ k_part_name, 2 },
+	{ k_part_name, 2 },
+	{ k_group, 6 },
+	{ k_midi_device, 8 },
+	{ k_midi_instrument, 9 },
+	{ k_part_abbreviation, 4 },
+	{ k_part_abbreviation_display, 5 },
+	{ k_part_name_display, 3 },
+	{ k_score_instrument, 7 },
+	{ k_group, 6 },
+	{ k_midi_device, 8 },
+	{ k_midi_instrument, 9 },
+	{ k_part_abbreviation, 4 },
+	{ k_part_abbreviation_display, 5 },
+	{ k_score_instrument, 7 },
+	{ k_group, 6 },
+	{ k_midi_device, 8 },
+	{ k_midi_instrument, 9 },
+	{ k_part_abbreviation_display, 5 },
+	{ k_score_instrument, 7 },
+	{ k_group, 6 },
+	{ k_midi_device, 8 },
+	{ k_midi_instrument, 9 },
+	{ k_score_instrument, 7 },
+	{ k_group, 6 },
+	{ k_midi_device, 8 },
+	{ k_midi_instrument, 9 },
+	{ k_score_instrument, 7 },
+	{ k_midi_device, 8 },
+	{ k_midi_instrument, 9 },
+	{ k_score_instrument, 7 },
+	{ k_midi_device, 8 },
+	{ k_midi_instrument, 9 },
+	{ k_midi_device, 8 },
+	{ k_midi_instrument, 9 },
+};
+static const int kStates_score_part[] = { 0, 2, 3, 10, 16, 21, 25, 29, 32, 34, 36 };
+static const char kFinals_score_part[] = { 0, 0, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_score_part = { 10, kStates_score_part, kTransitions_score_part, kFinals_score_part };
+static const attributeinfo kAttributes_score_part[] = {
+	{ "id", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_score_partwise[] = {
+	0x00000000, 0x01000000, 0x00000002, 0x00000000, 0x80000000, 0x00000000, 0x0c000000, 0x00000000, 0x00000044, 0x00000000, 0x00000000, 0x00000000, 0x08000000
+};
+static const unsigned char kRanks_score_partwise[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+	0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,8,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0
+};
+static const transition kTransitions_score_partwise[] = {
+	{ k_credit, 6 },
+	{ k_defaults, 5 },
+	{ k_identification, 4 },
+	{ k_movement_number, 2 },
+	{ k_movement_title, 3 },
+	{ k_part_list, 7 },
+	{ k_work, 1 },
+	{ k_credit, 6 },
+	{ k_defaults, 5 },
+	{ k_identification, 4 },
+	{ k_movement_number, 2 },
+	{ k_movement_title, 3 },
+	{ k_part_list, 7 },
+	{ k_credit, 6 },
+	{ k_defaults, 5 },
+	{ k_identification, 4 },
+	{ k_movement_title, 3 },
+	{ k_part_list, 7 },
+	{ k_credit, 6 },
+	{ k_defaults, 5 },
+	{ k_identification, 4 },
+	{ k_part_list, 7 },
+	{ k_credit, 6 },
+	{ k_defaults, 5 },
+	{ k_part_list, 7 },
+	{ k_credit, 6 },
+	{ k_part_list, 7 },
+	{ k_credit, 6 },
+	{ k_part_list, 7 },
+	{ k_part, 8 },
+	{ k_part, 8 },
+};
+static const int kStates_score_partwise[] = { 0, 7, 13, 18, 22, 25, 27, 29, 30, 31 };
+static const char kFinals_score_partwise[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+static const contentmodel kModel_score_partwise = { 9, kStates_score_partwise, kTransitions_score_partwise, kFinals_score_partwise };
+static const attributeinfo kAttributes_score_partwise[] = {
+	{ "version", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_segno[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "id", 0, 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_shake[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "start-note", "upper|main|below", 0 },
+	{ "trill-step", "whole|half|unison", 0 },
+	{ "two-note-turn", "whole|half|none", 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "second-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_slash[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_slash[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_slash[] = {
+	{ k_except_voice, 3 },
+	{ k_slash_type, 1 },
+	{ k_except_voice, 3 },
+	{ k_slash_dot, 2 },
+	{ k_except_voice, 3 },
+	{ k_slash_dot, 2 },
+	{ k_except_voice, 3 },
+};
+static const int kStates_slash[] = { 0, 2, 4, 6, 7 };
+static const char kFinals_slash[] = { 1, 1, 1, 1 };
+static const contentmodel kModel_slash = { 4, kStates_slash, kTransitions_slash, kFinals_slash };
+static const attributeinfo kAttributes_slash[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "use-dots", "yes|no", 0 },
+	{ "use-stems", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_slide[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "line-type", "solid|dashed|dotted|wavy", 0 },
+	{ "dash-length", 0, 0 },
+	{ "space-length", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "first-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_slur[] = {
+	{ "type", "start|stop|continue", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "line-type", "solid|dashed|dotted|wavy", 0 },
+	{ "dash-length", 0, 0 },
+	{ "space-length", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "orientation", "over|under", 0 },
+	{ "bezier-x", 0, 0 },
+	{ "bezier-y", 0, 0 },
+	{ "bezier-x2", 0, 0 },
+	{ "bezier-y2", 0, 0 },
+	{ "bezier-offset", 0, 0 },
+	{ "bezier-offset2", 0, 0 },
+	{ "color", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_smear[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_snap_pizzicato[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_soft_accent[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_sound[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00030000, 0x00004000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_sound[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_sound[] = {
+	{ k_midi_device, 1 },
+	{ k_midi_instrument, 2 },
+	{ k_offset, 4 },
+	{ k_play, 3 },
+	{ k_midi_device, 1 },
+	{ k_midi_instrument, 2 },
+	{ k_offset, 4 },
+	{ k_play, 3 },
+	{ k_midi_device, 1 },
+	{ k_midi_instrument, 2 },
+	{ k_offset, 4 },
+	{ k_play, 3 },
+	{ k_midi_device, 1 },
+	{ k_midi_instrument, 2 },
+	{ k_offset, 4 },
+	{ k_play, 3 },
+};
+static const int kStates_sound[] = { 0, 4, 8, 12, 16, 16 };
+static const char kFinals_sound[] = { 1, 1, 1, 1, 1 };
+static const contentmodel kModel_sound = { 5, kStates_sound, kTransitions_sound, kFinals_sound };
+static const attributeinfo kAttributes_sound[] = {
+	{ "tempo", 0, 0 },
+	{ "dynamics", 0, 0 },
+	{ "dacapo", "yes|no", 0 },
+	{ "segno", 0, 0 },
+	{ "dalsegno", 0, 0 },
+	{ "coda", 0, 0 },
+	{ "tocoda", 0, 0 },
+	{ "divisions", 0, 0 },
+	{ "forward-repeat", "yes|no", 0 },
+	{ "fine", 0, 0 },
+	{ "time-only", 0, 0 },
+	{ "pizzicato", "yes|no", 0 },
+	{ "pan", 0, 0 },
+	{ "elevation", 0, 0 },
+	{ "damper-pedal", 0, 0 },
+	{ "soft-pedal", 0, 0 },
+	{ "sostenuto-pedal", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_spiccato[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_staccatissimo[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_staccato[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_staff_details[] = {
+	0x00000000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01e00000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_staff_details[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,5,3,1,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_staff_details[] = {
+	{ k_capo, 4 },
+	{ k_staff_lines, 2 },
+	{ k_staff_size, 5 },
+	{ k_staff_tuning, 3 },
+	{ k_staff_type, 1 },
+	{ k_capo, 4 },
+	{ k_staff_lines, 2 },
+	{ k_staff_size, 5 },
+	{ k_staff_tuning, 3 },
+	{ k_capo, 4 },
+	{ k_staff_size, 5 },
+	{ k_staff_tuning, 3 },
+	{ k_capo, 4 },
+	{ k_staff_size, 5 },
+	{ k_staff_tuning, 3 },
+	{ k_staff_size, 5 },
+};
+static const int kStates_staff_details[] = { 0, 5, 9, 12, 15, 16, 16 };
+static const char kFinals_staff_details[] = { 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_staff_details = { 6, kStates_staff_details, kTransitions_staff_details, kFinals_staff_details };
+static const attributeinfo kAttributes_staff_details[] = {
+	{ "number", 0, 0 },
+	{ "show-frets", "numbers|letters", 0 },
+	{ "print-object", "yes|no", 0 },
+	{ "print-spacing", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_staff_divide[] = {
+	{ "type", "down|up|up-down", kRequiredAttribute },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_staff_layout[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00040000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_staff_layout[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_staff_layout[] = {
+	{ k_staff_distance, 1 },
+};
+static const int kStates_staff_layout[] = { 0, 1, 1 };
+static const char kFinals_staff_layout[] = { 1, 1 };
+static const contentmodel kModel_staff_layout = { 2, kStates_staff_layout, kTransitions_staff_layout, kFinals_staff_layout };
+static const attributeinfo kAttributes_staff_layout[] = {
+	{ "number", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_staff_tuning[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000000e
+};
+static const unsigned char kRanks_staff_tuning[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,2,3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_staff_tuning[] = {
+	{ k_tuning_step, 1 },
+	{ k_tuning_alter, 2 },
+	{ k_tuning_octave, 3 },
+	{ k_tuning_octave, 3 },
+};
+static const int kStates_staff_tuning[] = { 0, 1, 3, 4, 4 };
+static const char kFinals_staff_tuning[] = { 0, 0, 0, 1 };
+static const contentmodel kModel_staff_tuning = { 4, kStates_staff_tuning, kTransitions_staff_tuning, kFinals_staff_tuning };
+static const attributeinfo kAttributes_staff_tuning[] = {
+	{ "line", 0, kRequiredAttribute },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_stem[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_stick[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_stick[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_stick[] = {
+	{ k_stick_type, 1 },
+	{ k_stick_material, 2 },
+};
+static const int kStates_stick[] = { 0, 1, 2, 2 };
+static const char kFinals_stick[] = { 0, 0, 1 };
+static const contentmodel kModel_stick = { 3, kStates_stick, kTransitions_stick, kFinals_stick };
+static const attributeinfo kAttributes_stick[] = {
+	{ "tip", "up|down|left|right|northwest|northeast|southeast|southwest", 0 },
+	{ "parentheses", "yes|no", 0 },
+	{ "dashed-circle", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_stopped[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_stress[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_string[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_string_mute[] = {
+	{ "type", "on|off", kRequiredAttribute },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_strong_accent[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "type", "up|down", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_suffix[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_supports[] = {
+	{ "type", "yes|no", kRequiredAttribute },
+	{ "element", 0, kRequiredAttribute },
+	{ "attribute", 0, 0 },
+	{ "value", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_symbol[] = {
+	{ "justify", "left|center|right", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "underline", "0|1|2|3", 0 },
+	{ "overline", "0|1|2|3", 0 },
+	{ "line-through", "0|1|2|3", 0 },
+	{ "rotation", 0, 0 },
+	{ "letter-spacing", 0, 0 },
+	{ "line-height", 0, 0 },
+	{ "dir", "ltr|rtl|lro|rlo", 0 },
+	{ "enclosure", "rectangle|square|oval|circle|bracket|triangle|diamond|pentagon|hexagon|heptagon|octagon|nonagon|decagon|none", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_system_dividers[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00000080, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_system_dividers[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_system_dividers[] = {
+	{ k_left_divider, 1 },
+	{ k_right_divider, 2 },
+};
+static const int kStates_system_dividers[] = { 0, 1, 2, 2 };
+static const char kFinals_system_dividers[] = { 0, 0, 1 };
+static const contentmodel kModel_system_dividers = { 3, kStates_system_dividers, kTransitions_system_dividers, kFinals_system_dividers };
+
+static const unsigned kChildren_system_layout[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08001600, 0x00000000
+};
+static const unsigned char kRanks_system_layout[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,2,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_system_layout[] = {
+	{ k_system_distance, 2 },
+	{ k_system_dividers, 4 },
+	{ k_system_margins, 1 },
+	{ k_top_system_distance, 3 },
+	{ k_system_distance, 2 },
+	{ k_system_dividers, 4 },
+	{ k_top_system_distance, 3 },
+	{ k_system_dividers, 4 },
+	{ k_top_system_distance, 3 },
+	{ k_system_dividers, 4 },
+};
+static const int kStates_system_layout[] = { 0, 4, 7, 9, 10, 10 };
+static const char kFinals_system_layout[] = { 1, 1, 1, 1, 1 };
+static const contentmodel kModel_system_layout = { 5, kStates_system_layout, kTransitions_system_layout, kFinals_system_layout };
+
+static const unsigned kChildren_system_margins[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00100000, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_system_margins[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_system_margins[] = {
+	{ k_left_margin, 1 },
+	{ k_right_margin, 2 },
+};
+static const int kStates_system_margins[] = { 0, 1, 2, 2 };
+static const char kFinals_system_margins[] = { 0, 0, 1 };
+static const contentmodel kModel_system_margins = { 3, kStates_system_margins, kTransitions_system_margins, kFinals_system_margins };
+
+static const attributeinfo kAttributes_tap[] = {
+	{ "hand", "left|right", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_technical[] = {
+	0x00010000, 0x00001080, 0x00600000, 0x80b00000, 0x06370020, 0x00000000, 0x00000000, 0x08018000, 0x80200000, 0x00000000, 0x00000060, 0x02042005, 0x00004001
+};
+static const unsigned char kRanks_technical[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,0,0,0,0,1,
+	0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,1,1,0,1,1,0,0,0,1,1,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,1,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	1,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_technical[] = {
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+	{ k_arrow, 22 },
+	{ k_bend, 16 },
+	{ k_brass_bend, 24 },
+	{ k_double_tongue, 8 },
+	{ k_down_bow, 2 },
+	{ k_fingering, 6 },
+	{ k_fingernails, 20 },
+	{ k_flip, 25 },
+	{ k_fret, 12 },
+	{ k_golpe, 30 },
+	{ k_half_muted, 28 },
+	{ k_hammer_on, 14 },
+	{ k_handbell, 23 },
+	{ k_harmon_mute, 29 },
+	{ k_harmonic, 3 },
+	{ k_heel, 18 },
+	{ k_hole, 21 },
+	{ k_open, 27 },
+	{ k_open_string, 4 },
+	{ k_other_technical, 31 },
+	{ k_pluck, 7 },
+	{ k_pull_off, 15 },
+	{ k_smear, 26 },
+	{ k_snap_pizzicato, 11 },
+	{ k_stopped, 10 },
+	{ k_string, 13 },
+	{ k_tap, 17 },
+	{ k_thumb_position, 5 },
+	{ k_toe, 19 },
+	{ k_triple_tongue, 9 },
+	{ k_up_bow, 1 },
+};
+static const int kStates_technical[] = { 0, 31, 62, 93, 124, 155, 186, 217, 248, 279, 310, 341, 372, 403, 434, 465, 496, 527, 558, 589, 620, 651, 682, 713, 744, 775, 806, 837, 868, 899, 930, 961, 992 };
+static const char kFinals_technical[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+static const contentmodel kModel_technical = { 32, kStates_technical, kTransitions_technical, kFinals_technical };
+static const attributeinfo kAttributes_technical[] = {
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_tenuto[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_text[] = {
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "underline", "0|1|2|3", 0 },
+	{ "overline", "0|1|2|3", 0 },
+	{ "line-through", "0|1|2|3", 0 },
+	{ "rotation", 0, 0 },
+	{ "letter-spacing", 0, 0 },
+	{ "xml:lang", 0, 0 },
+	{ "dir", "ltr|rtl|lro|rlo", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_thumb_position[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_tie[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "time-only", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_tied[] = {
+	{ "type", "start|stop|continue|let-ring", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "line-type", "solid|dashed|dotted|wavy", 0 },
+	{ "dash-length", 0, 0 },
+	{ "space-length", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "orientation", "over|under", 0 },
+	{ "bezier-x", 0, 0 },
+	{ "bezier-y", 0, 0 },
+	{ "bezier-x2", 0, 0 },
+	{ "bezier-y2", 0, 0 },
+	{ "bezier-offset", 0, 0 },
+	{ "bezier-offset2", 0, 0 },
+	{ "color", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_time[] = {
+	0x00000000, 0x00000042, 0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_time[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_time[] = {
+	{ k_beats, 1 },
+	{ k_senza_misura, 4 },
+	{ k_beat_type, 2 },
+	{ k_beats, 1 },
+	{ k_interchangeable, 3 },
+};
+static const int kStates_time[] = { 0, 2, 3, 5, 5, 5 };
+static const char kFinals_time[] = { 0, 0, 1, 1, 1 };
+static const contentmodel kModel_time = { 5, kStates_time, kTransitions_time, kFinals_time };
+static const attributeinfo kAttributes_time[] = {
+	{ "number", 0, 0 },
+	{ "symbol", "common|cut|single-number|note|dotted-note|normal", 0 },
+	{ "separator", "none|horizontal|diagonal|vertical|adjacent", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "print-object", "yes|no", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_time_modification[] = {
+	0x00001000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000038, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_time_modification[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,2,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_time_modification[] = {
+	{ k_actual_notes, 1 },
+	{ k_normal_notes, 2 },
+	{ k_normal_type, 3 },
+	{ k_normal_dot, 4 },
+	{ k_normal_dot, 4 },
+};
+static const int kStates_time_modification[] = { 0, 1, 2, 3, 4, 5 };
+static const char kFinals_time_modification[] = { 0, 0, 1, 1, 1 };
+static const contentmodel kModel_time_modification = { 5, kStates_time_modification, kTransitions_time_modification, kFinals_time_modification };
+
+static const attributeinfo kAttributes_toe[] = {
+	{ "substitution", "yes|no", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_transpose[] = {
+	0x00000000, 0x00040000, 0x00100200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00001000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_transpose[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_transpose[] = {
+	{ k_chromatic, 2 },
+	{ k_diatonic, 1 },
+	{ k_chromatic, 2 },
+	{ k_double, 4 },
+	{ k_octave_change, 3 },
+	{ k_double, 4 },
+};
+static const int kStates_transpose[] = { 0, 2, 3, 5, 6, 6 };
+static const char kFinals_transpose[] = { 0, 0, 1, 1, 1 };
+static const contentmodel kModel_transpose = { 5, kStates_transpose, kTransitions_transpose, kFinals_transpose };
+static const attributeinfo kAttributes_transpose[] = {
+	{ "number", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_tremolo[] = {
+	{ "type", "start|stop|single|unmeasured", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "smufl", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_trill_mark[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "start-note", "upper|main|below", 0 },
+	{ "trill-step", "whole|half|unison", 0 },
+	{ "two-note-turn", "whole|half|none", 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "second-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_triple_tongue[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_tuplet[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000a0
+};
+static const unsigned char kRanks_tuplet[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_tuplet[] = {
+	{ k_tuplet_actual, 1 },
+	{ k_tuplet_normal, 2 },
+	{ k_tuplet_normal, 2 },
+};
+static const int kStates_tuplet[] = { 0, 2, 3, 3 };
+static const char kFinals_tuplet[] = { 1, 1, 1 };
+static const contentmodel kModel_tuplet = { 3, kStates_tuplet, kTransitions_tuplet, kFinals_tuplet };
+static const attributeinfo kAttributes_tuplet[] = {
+	{ "type", "start|stop", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "bracket", "yes|no", 0 },
+	{ "show-number", "actual|both|none", 0 },
+	{ "show-type", "actual|both|none", 0 },
+	{ "line-shape", "straight|curved", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_tuplet_actual[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000340
+};
+static const unsigned char kRanks_tuplet_actual[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,3,0,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_tuplet_actual[] = {
+	{ k_tuplet_dot, 3 },
+	{ k_tuplet_number, 1 },
+	{ k_tuplet_type, 2 },
+	{ k_tuplet_dot, 3 },
+	{ k_tuplet_type, 2 },
+	{ k_tuplet_dot, 3 },
+	{ k_tuplet_dot, 3 },
+};
+static const int kStates_tuplet_actual[] = { 0, 3, 5, 6, 7 };
+static const char kFinals_tuplet_actual[] = { 1, 1, 1, 1 };
+static const contentmodel kModel_tuplet_actual = { 4, kStates_tuplet_actual, kTransitions_tuplet_actual, kFinals_tuplet_actual };
+
+static const attributeinfo kAttributes_tuplet_dot[] = {
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_tuplet_normal[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000340
+};
+static const unsigned char kRanks_tuplet_normal[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,3,0,1,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_tuplet_normal[] = {
+	{ k_tuplet_dot, 3 },
+	{ k_tuplet_number, 1 },
+	{ k_tuplet_type, 2 },
+	{ k_tuplet_dot, 3 },
+	{ k_tuplet_type, 2 },
+	{ k_tuplet_dot, 3 },
+	{ k_tuplet_dot, 3 },
+};
+static const int kStates_tuplet_normal[] = { 0, 3, 5, 6, 7 };
+static const char kFinals_tuplet_normal[] = { 1, 1, 1, 1 };
+static const contentmodel kModel_tuplet_normal = { 4, kStates_tuplet_normal, kTransitions_tuplet_normal, kFinals_tuplet_normal };
+
+static const attributeinfo kAttributes_tuplet_number[] = {
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_tuplet_type[] = {
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_turn[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "start-note", "upper|main|below", 0 },
+	{ "trill-step", "whole|half|unison", 0 },
+	{ "two-note-turn", "whole|half|none", 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "second-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ "slash", "yes|no", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_type[] = {
+	{ "size", "full|cue|grace-cue|large", 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_unpitched[] = {
+	0x00000000, 0x00000000, 0x00006000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+static const unsigned char kRanks_unpitched[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,2,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_unpitched[] = {
+	{ k_display_step, 1 },
+	{ k_display_octave, 2 },
+};
+static const int kStates_unpitched[] = { 0, 1, 2, 2 };
+static const char kFinals_unpitched[] = { 1, 0, 1 };
+static const contentmodel kModel_unpitched = { 3, kStates_unpitched, kTransitions_unpitched, kFinals_unpitched };
+
+static const attributeinfo kAttributes_unstress[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_up_bow[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_vertical_turn[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "start-note", "upper|main|below", 0 },
+	{ "trill-step", "whole|half|unison", 0 },
+	{ "two-note-turn", "whole|half|none", 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "second-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_virtual_instrument[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00060000
+};
+static const unsigned char kRanks_virtual_instrument[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2,0,0,0,0,0,0,0,0,0,0,0
+};
+static const transition kTransitions_virtual_instrument[] = {
+	{ k_virtual_library, 1 },
+	{ k_virtual_name, 2 },
+	{ k_virtual_name, 2 },
+};
+static const int kStates_virtual_instrument[] = { 0, 2, 3, 3 };
+static const char kFinals_virtual_instrument[] = { 1, 1, 1 };
+static const contentmodel kModel_virtual_instrument = { 3, kStates_virtual_instrument, kTransitions_virtual_instrument, kFinals_virtual_instrument };
+
+static const attributeinfo kAttributes_wavy_line[] = {
+	{ "type", "start|stop|continue", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ "color", 0, 0 },
+	{ "start-note", "upper|main|below", 0 },
+	{ "trill-step", "whole|half|unison", 0 },
+	{ "two-note-turn", "whole|half|none", 0 },
+	{ "accelerate", "yes|no", 0 },
+	{ "beats", 0, 0 },
+	{ "second-beat", 0, 0 },
+	{ "last-beat", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_wedge[] = {
+	{ "type", "crescendo|diminuendo|stop|continue", kRequiredAttribute },
+	{ "number", "1|2|3|4|5|6", 0 },
+	{ "spread", 0, 0 },
+	{ "niente", "yes|no", 0 },
+	{ "line-type", "solid|dashed|dotted|wavy", 0 },
+	{ "dash-length", 0, 0 },
+	{ "space-length", 0, 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "color", 0, 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_with_bar[] = {
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "placement", "above|below", 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_word_font[] = {
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const attributeinfo kAttributes_words[] = {
+	{ "justify", "left|center|right", 0 },
+	{ "default-x", 0, 0 },
+	{ "default-y", 0, 0 },
+	{ "relative-x", 0, 0 },
+	{ "relative-y", 0, 0 },
+	{ "font-family", 0, 0 },
+	{ "font-style", 0, 0 },
+	{ "font-size", 0, 0 },
+	{ "font-weight", 0, 0 },
+	{ "color", 0, 0 },
+	{ "halign", "left|center|right", 0 },
+	{ "valign", "top|middle|bottom|baseline", 0 },
+	{ "underline", "0|1|2|3", 0 },
+	{ "overline", "0|1|2|3", 0 },
+	{ "line-through", "0|1|2|3", 0 },
+	{ "rotation", 0, 0 },
+	{ "letter-spacing", 0, 0 },
+	{ "line-height", 0, 0 },
+	{ "xml:lang", 0, 0 },
+	{ "xml:space", "default|preserve", 0 },
+	{ "dir", "ltr|rtl|lro|rlo", 0 },
+	{ "enclosure", "rectangle|square|oval|circle|bracket|triangle|diamond|pentagon|hexagon|heptagon|octagon|nonagon|decagon|none", 0 },
+	{ "id", 0, 0 },
+	{ 0, 0, 0 }
+};
+
+static const unsigned kChildren_work[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x30000000
+};
+static const unsigned char kRanks_work[kEndElement] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,2
+};
+static const transition kTransitions_work[] = {
+	{ k_opus, 3 },
+	{ k_work_number, 1 },
+	{ k_work_title, 2 },
+	{ k_opus, 3 },
+	{ k_work_title, 2 },
+	{ k_opus, 3 },
+};
+static const int kStates_work[] = { 0, 3, 5, 6, 6 };
+static const char kFinals_work[] = { 1, 1, 1, 1 };
+static const contentmodel kModel_work = { 4, kStates_work, kTransitions_work, kFinals_work };
+
+// the numeric attributes names, sorted for a binary search
+static const char* kNumericAttributes[] = {
+	"attack",
+	"beats",
+	"bezier-offset",
+	"bezier-offset2",
+	"bezier-x",
+	"bezier-x2",
+	"bezier-y",
+	"bezier-y2",
+	"blank-page",
+	"bottom-staff",
+	"dash-length",
+	"default-x",
+	"default-y",
+	"divisions",
+	"dynamics",
+	"elevation",
+	"end-dynamics",
+	"end-length",
+	"first-beat",
+	"height",
+	"last-beat",
+	"line",
+	"line-through",
+	"make-time",
+	"number",
+	"overline",
+	"page",
+	"pan",
+	"port",
+	"position",
+	"relative-x",
+	"relative-y",
+	"release",
+	"rotation",
+	"second-beat",
+	"size",
+	"slashes",
+	"space-length",
+	"spread",
+	"staff-spacing",
+	"steal-time-following",
+	"steal-time-previous",
+	"string",
+	"tempo",
+	"text-x",
+	"text-y",
+	"times",
+	"top-staff",
+	"underline",
+	"width",
+};
+static const int kNumericAttributesCount = sizeof(kNumericAttributes) / sizeof(kNumericAttributes[0]);
+
+// the elements metadata, indexed by type
+static const elementinfo kInfos[] = {
+	{ "", kUndeclared, kNoValue, 0, 0, 0, 0 },
+	{ "comment", kUndeclared, kStringValue, 0, 0, 0, 0 },
+	{ "pi", kUndeclared, kStringValue, 0, 0, 0, 0 },
+	{ "accent", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_accent },
+	{ "accidental", kTextContent, kEnumValue, 0, 0, 0, kAttributes_accidental },
+	{ "accidental-mark", kTextContent, kEnumValue, 0, 0, 0, kAttributes_accidental_mark },
+	{ "accidental-text", kTextContent, kEnumValue, 0, 0, 0, kAttributes_accidental_text },
+	{ "accord", kElementsContent, kNoValue, kChildren_accord, kRanks_accord, &kModel_accord, kAttributes_accord },
+	{ "accordion-high", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "accordion-low", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "accordion-middle", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "accordion-registration", kElementsContent, kNoValue, kChildren_accordion_registration, kRanks_accordion_registration, &kModel_accordion_registration, kAttributes_accordion_registration },
+	{ "actual-notes", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "alter", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "appearance", kElementsContent, kNoValue, kChildren_appearance, kRanks_appearance, &kModel_appearance, 0 },
+	{ "arpeggiate", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_arpeggiate },
+	{ "arrow", kElementsContent, kNoValue, kChildren_arrow, kRanks_arrow, &kModel_arrow, kAttributes_arrow },
+	{ "arrow-direction", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "arrow-style", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "arrowhead", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "articulations", kElementsContent, kNoValue, kChildren_articulations, kRanks_articulations, &kModel_articulations, kAttributes_articulations },
+	{ "artificial", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "attributes", kElementsContent, kNoValue, kChildren_attributes, kRanks_attributes, &kModel_attributes, 0 },
+	{ "backup", kElementsContent, kNoValue, kChildren_backup, kRanks_backup, &kModel_backup, 0 },
+	{ "bar-style", kTextContent, kEnumValue, 0, 0, 0, kAttributes_bar_style },
+	{ "barline", kElementsContent, kNoValue, kChildren_barline, kRanks_barline, &kModel_barline, kAttributes_barline },
+	{ "barre", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_barre },
+	{ "base-pitch", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "bass", kElementsContent, kNoValue, kChildren_bass, kRanks_bass, &kModel_bass, 0 },
+	{ "bass-alter", kTextContent, kNumericValue, 0, 0, 0, kAttributes_bass_alter },
+	{ "bass-step", kTextContent, kEnumValue, 0, 0, 0, kAttributes_bass_step },
+	{ "beam", kTextContent, kEnumValue, 0, 0, 0, kAttributes_beam },
+	{ "beat-repeat", kElementsContent, kNoValue, kChildren_beat_repeat, kRanks_beat_repeat, &kModel_beat_repeat, kAttributes_beat_repeat },
+	{ "beat-type", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "beat-unit", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "beat-unit-dot", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "beat-unit-tied", kElementsContent, kNoValue, kChildren_beat_unit_tied, kRanks_beat_unit_tied, &kModel_beat_unit_tied, 0 },
+	{ "beater", kTextContent, kEnumValue, 0, 0, 0, kAttributes_beater },
+	{ "beats", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "bend", kElementsContent, kNoValue, kChildren_bend, kRanks_bend, &kModel_bend, kAttributes_bend },
+	{ "bend-alter", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "bookmark", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_bookmark },
+	{ "bottom-margin", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "bracket", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_bracket },
+	{ "brass-bend", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_brass_bend },
+	{ "breath-mark", kTextContent, kEnumValue, 0, 0, 0, kAttributes_breath_mark },
+	{ "caesura", kTextContent, kEnumValue, 0, 0, 0, kAttributes_caesura },
+	{ "cancel", kTextContent, kNumericValue, 0, 0, 0, kAttributes_cancel },
+	{ "capo", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "chord", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "chromatic", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "circular-arrow", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "clef", kElementsContent, kNoValue, kChildren_clef, kRanks_clef, &kModel_clef, kAttributes_clef },
+	{ "clef-octave-change", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "coda", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_coda },
+	{ "creator", kTextContent, kStringValue, 0, 0, 0, kAttributes_creator },
+	{ "credit", kElementsContent, kNoValue, kChildren_credit, kRanks_credit, &kModel_credit, kAttributes_credit },
+	{ "credit-image", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_credit_image },
+	{ "credit-symbol", kTextContent, kStringValue, 0, 0, 0, kAttributes_credit_symbol },
+	{ "credit-type", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "credit-words", kTextContent, kStringValue, 0, 0, 0, kAttributes_credit_words },
+	{ "cue", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "damp", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_damp },
+	{ "damp-all", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_damp_all },
+	{ "dashes", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_dashes },
+	{ "defaults", kElementsContent, kNoValue, kChildren_defaults, kRanks_defaults, &kModel_defaults, 0 },
+	{ "degree", kElementsContent, kNoValue, kChildren_degree, kRanks_degree, &kModel_degree, kAttributes_degree },
+	{ "degree-alter", kTextContent, kNumericValue, 0, 0, 0, kAttributes_degree_alter },
+	{ "degree-type", kTextContent, kEnumValue, 0, 0, 0, kAttributes_degree_type },
+	{ "degree-value", kTextContent, kNumericValue, 0, 0, 0, kAttributes_degree_value },
+	{ "delayed-inverted-turn", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_delayed_inverted_turn },
+	{ "delayed-turn", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_delayed_turn },
+	{ "detached-legato", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_detached_legato },
+	{ "diatonic", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "direction", kElementsContent, kNoValue, kChildren_direction, kRanks_direction, &kModel_direction, kAttributes_direction },
+	{ "direction-type", kElementsContent, kNoValue, kChildren_direction_type, kRanks_direction_type, &kModel_direction_type, kAttributes_direction_type },
+	{ "directive", kTextContent, kNoValue, 0, 0, 0, kAttributes_directive },
+	{ "display-octave", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "display-step", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "display-text", kTextContent, kStringValue, 0, 0, 0, kAttributes_display_text },
+	{ "distance", kTextContent, kNumericValue, 0, 0, 0, kAttributes_distance },
+	{ "divisions", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "doit", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_doit },
+	{ "dot", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_dot },
+	{ "double", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "double-tongue", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_double_tongue },
+	{ "down-bow", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_down_bow },
+	{ "duration", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "dynamics", kElementsContent, kNoValue, kChildren_dynamics, kRanks_dynamics, &kModel_dynamics, kAttributes_dynamics },
+	{ "effect", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "elevation", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "elision", kTextContent, kStringValue, 0, 0, 0, kAttributes_elision },
+	{ "encoder", kTextContent, kStringValue, 0, 0, 0, kAttributes_encoder },
+	{ "encoding", kElementsContent, kNoValue, kChildren_encoding, kRanks_encoding, &kModel_encoding, 0 },
+	{ "encoding-date", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "encoding-description", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "end-line", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "end-paragraph", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "ending", kTextContent, kStringValue, 0, 0, 0, kAttributes_ending },
+	{ "ensemble", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "except-voice", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "extend", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_extend },
+	{ "eyeglasses", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_eyeglasses },
+	{ "f", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "falloff", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_falloff },
+	{ "feature", kTextContent, kStringValue, 0, 0, 0, kAttributes_feature },
+	{ "fermata", kTextContent, kEnumValue, 0, 0, 0, kAttributes_fermata },
+	{ "ff", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "fff", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "ffff", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "fffff", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "ffffff", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "fifths", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "figure", kElementsContent, kNoValue, kChildren_figure, kRanks_figure, &kModel_figure, 0 },
+	{ "figure-number", kTextContent, kStringValue, 0, 0, 0, kAttributes_figure_number },
+	{ "figured-bass", kElementsContent, kNoValue, kChildren_figured_bass, kRanks_figured_bass, &kModel_figured_bass, kAttributes_figured_bass },
+	{ "fingering", kTextContent, kStringValue, 0, 0, 0, kAttributes_fingering },
+	{ "fingernails", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_fingernails },
+	{ "first-fret", kTextContent, kNumericValue, 0, 0, 0, kAttributes_first_fret },
+	{ "flip", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_flip },
+	{ "footnote", kTextContent, kStringValue, 0, 0, 0, kAttributes_footnote },
+	{ "forward", kElementsContent, kNoValue, kChildren_forward, kRanks_forward, &kModel_forward, 0 },
+	{ "fp", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "frame", kElementsContent, kNoValue, kChildren_frame, kRanks_frame, &kModel_frame, kAttributes_frame },
+	{ "frame-frets", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "frame-note", kElementsContent, kNoValue, kChildren_frame_note, kRanks_frame_note, &kModel_frame_note, 0 },
+	{ "frame-strings", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "fret", kTextContent, kNumericValue, 0, 0, 0, kAttributes_fret },
+	{ "function", kTextContent, kStringValue, 0, 0, 0, kAttributes_function },
+	{ "fz", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "glass", kTextContent, kEnumValue, 0, 0, 0, kAttributes_glass },
+	{ "glissando", kTextContent, kStringValue, 0, 0, 0, kAttributes_glissando },
+	{ "glyph", kTextContent, kStringValue, 0, 0, 0, kAttributes_glyph },
+	{ "golpe", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_golpe },
+	{ "grace", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_grace },
+	{ "group", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "group-abbreviation", kTextContent, kStringValue, 0, 0, 0, kAttributes_group_abbreviation },
+	{ "group-abbreviation-display", kElementsContent, kNoValue, kChildren_group_abbreviation_display, kRanks_group_abbreviation_display, &kModel_group_abbreviation_display, kAttributes_group_abbreviation_display },
+	{ "group-barline", kTextContent, kEnumValue, 0, 0, 0, kAttributes_group_barline },
+	{ "group-name", kTextContent, kStringValue, 0, 0, 0, kAttributes_group_name },
+	{ "group-name-display", kElementsContent, kNoValue, kChildren_group_name_display, kRanks_group_name_display, &kModel_group_name_display, kAttributes_group_name_display },
+	{ "group-symbol", kTextContent, kEnumValue, 0, 0, 0, kAttributes_group_symbol },
+	{ "group-time", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "grouping", kElementsContent, kNoValue, kChildren_grouping, kRanks_grouping, &kModel_grouping, kAttributes_grouping },
+	{ "half-muted", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_half_muted },
+	{ "hammer-on", kTextContent, kStringValue, 0, 0, 0, kAttributes_hammer_on },
+	{ "handbell", kTextContent, kEnumValue, 0, 0, 0, kAttributes_handbell },
+	{ "harmon-closed", kTextContent, kEnumValue, 0, 0, 0, kAttributes_harmon_closed },
+	{ "harmon-mute", kElementsContent, kNoValue, kChildren_harmon_mute, kRanks_harmon_mute, &kModel_harmon_mute, kAttributes_harmon_mute },
+	{ "harmonic", kElementsContent, kNoValue, kChildren_harmonic, kRanks_harmonic, &kModel_harmonic, kAttributes_harmonic },
+	{ "harmony", kElementsContent, kNoValue, kChildren_harmony, kRanks_harmony, &kModel_harmony, kAttributes_harmony },
+	{ "harp-pedals", kElementsContent, kNoValue, kChildren_harp_pedals, kRanks_harp_pedals, &kModel_harp_pedals, kAttributes_harp_pedals },
+	{ "haydn", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_haydn },
+	{ "heel", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_heel },
+	{ "hole", kElementsContent, kNoValue, kChildren_hole, kRanks_hole, &kModel_hole, kAttributes_hole },
+	{ "hole-closed", kTextContent, kEnumValue, 0, 0, 0, kAttributes_hole_closed },
+	{ "hole-shape", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "hole-type", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "humming", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "identification", kElementsContent, kNoValue, kChildren_identification, kRanks_identification, &kModel_identification, 0 },
+	{ "image", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_image },
+	{ "instrument", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_instrument },
+	{ "instrument-abbreviation", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "instrument-name", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "instrument-sound", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "instruments", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "interchangeable", kElementsContent, kNoValue, kChildren_interchangeable, kRanks_interchangeable, &kModel_interchangeable, kAttributes_interchangeable },
+	{ "inversion", kTextContent, kNumericValue, 0, 0, 0, kAttributes_inversion },
+	{ "inverted-mordent", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_inverted_mordent },
+	{ "inverted-turn", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_inverted_turn },
+	{ "inverted-vertical-turn", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_inverted_vertical_turn },
+	{ "ipa", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "key", kElementsContent, kNoValue, kChildren_key, kRanks_key, &kModel_key, kAttributes_key },
+	{ "key-accidental", kTextContent, kEnumValue, 0, 0, 0, kAttributes_key_accidental },
+	{ "key-alter", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "key-octave", kTextContent, kNumericValue, 0, 0, 0, kAttributes_key_octave },
+	{ "key-step", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "kind", kTextContent, kEnumValue, 0, 0, 0, kAttributes_kind },
+	{ "laughing", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "left-divider", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_left_divider },
+	{ "left-margin", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "level", kTextContent, kStringValue, 0, 0, 0, kAttributes_level },
+	{ "line", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "line-width", kTextContent, kNumericValue, 0, 0, 0, kAttributes_line_width },
+	{ "link", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_link },
+	{ "lyric", kElementsContent, kNoValue, kChildren_lyric, kRanks_lyric, &kModel_lyric, kAttributes_lyric },
+	{ "lyric-font", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_lyric_font },
+	{ "lyric-language", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_lyric_language },
+	{ "measure", kElementsContent, kNoValue, kChildren_measure, kRanks_measure, &kModel_measure, kAttributes_measure },
+	{ "measure-distance", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "measure-layout", kElementsContent, kNoValue, kChildren_measure_layout, kRanks_measure_layout, &kModel_measure_layout, 0 },
+	{ "measure-numbering", kTextContent, kEnumValue, 0, 0, 0, kAttributes_measure_numbering },
+	{ "measure-repeat", kTextContent, kEnumValue, 0, 0, 0, kAttributes_measure_repeat },
+	{ "measure-style", kElementsContent, kNoValue, kChildren_measure_style, kRanks_measure_style, &kModel_measure_style, kAttributes_measure_style },
+	{ "membrane", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "metal", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "metronome", kElementsContent, kNoValue, kChildren_metronome, kRanks_metronome, &kModel_metronome, kAttributes_metronome },
+	{ "metronome-arrows", kUndeclared, kNoValue, 0, 0, 0, 0 },
+	{ "metronome-beam", kTextContent, kEnumValue, 0, 0, 0, kAttributes_metronome_beam },
+	{ "metronome-dot", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "metronome-note", kElementsContent, kNoValue, kChildren_metronome_note, kRanks_metronome_note, &kModel_metronome_note, 0 },
+	{ "metronome-relation", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "metronome-tied", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_metronome_tied },
+	{ "metronome-tuplet", kElementsContent, kNoValue, kChildren_metronome_tuplet, kRanks_metronome_tuplet, &kModel_metronome_tuplet, kAttributes_metronome_tuplet },
+	{ "metronome-type", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "mf", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "midi-bank", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "midi-channel", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "midi-device", kTextContent, kStringValue, 0, 0, 0, kAttributes_midi_device },
+	{ "midi-instrument", kElementsContent, kNoValue, kChildren_midi_instrument, kRanks_midi_instrument, &kModel_midi_instrument, kAttributes_midi_instrument },
+	{ "midi-name", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "midi-program", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "midi-unpitched", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "millimeters", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "miscellaneous", kElementsContent, kNoValue, kChildren_miscellaneous, kRanks_miscellaneous, &kModel_miscellaneous, 0 },
+	{ "miscellaneous-field", kTextContent, kStringValue, 0, 0, 0, kAttributes_miscellaneous_field },
+	{ "mode", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "mordent", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_mordent },
+	{ "movement-number", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "movement-title", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "mp", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "multiple-rest", kTextContent, kEnumValue, 0, 0, 0, kAttributes_multiple_rest },
+	{ "music-font", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_music_font },
+	{ "mute", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "n", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "natural", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "non-arpeggiate", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_non_arpeggiate },
+	{ "normal-dot", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "normal-notes", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "normal-type", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "notations", kElementsContent, kNoValue, kChildren_notations, kRanks_notations, &kModel_notations, kAttributes_notations },
+	{ "note", kElementsContent, kNoValue, kChildren_note, kRanks_note, &kModel_note, kAttributes_note },
+	{ "note-size", kTextContent, kNumericValue, 0, 0, 0, kAttributes_note_size },
+	{ "notehead", kTextContent, kEnumValue, 0, 0, 0, kAttributes_notehead },
+	{ "notehead-text", kElementsContent, kNoValue, kChildren_notehead_text, kRanks_notehead_text, &kModel_notehead_text, 0 },
+	{ "octave", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "octave-change", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "octave-shift", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_octave_shift },
+	{ "offset", kTextContent, kNumericValue, 0, 0, 0, kAttributes_offset },
+	{ "open", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_open },
+	{ "open-string", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_open_string },
+	{ "opus", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_opus },
+	{ "ornaments", kElementsContent, kNoValue, kChildren_ornaments, kRanks_ornaments, &kModel_ornaments, kAttributes_ornaments },
+	{ "other-appearance", kTextContent, kStringValue, 0, 0, 0, kAttributes_other_appearance },
+	{ "other-articulation", kTextContent, kStringValue, 0, 0, 0, kAttributes_other_articulation },
+	{ "other-direction", kTextContent, kStringValue, 0, 0, 0, kAttributes_other_direction },
+	{ "other-dynamics", kTextContent, kStringValue, 0, 0, 0, kAttributes_other_dynamics },
+	{ "other-notation", kTextContent, kStringValue, 0, 0, 0, kAttributes_other_notation },
+	{ "other-ornament", kTextContent, kStringValue, 0, 0, 0, kAttributes_other_ornament },
+	{ "other-percussion", kTextContent, kStringValue, 0, 0, 0, kAttributes_other_percussion },
+	{ "other-play", kTextContent, kStringValue, 0, 0, 0, kAttributes_other_play },
+	{ "other-technical", kTextContent, kStringValue, 0, 0, 0, kAttributes_other_technical },
+	{ "p", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "page-height", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "page-layout", kElementsContent, kNoValue, kChildren_page_layout, kRanks_page_layout, &kModel_page_layout, 0 },
+	{ "page-margins", kElementsContent, kNoValue, kChildren_page_margins, kRanks_page_margins, &kModel_page_margins, kAttributes_page_margins },
+	{ "page-width", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "pan", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "part", kElementsContent, kNoValue, kChildren_part, kRanks_part, &kModel_part, kAttributes_part },
+	{ "part-abbreviation", kTextContent, kStringValue, 0, 0, 0, kAttributes_part_abbreviation },
+	{ "part-abbreviation-display", kElementsContent, kNoValue, kChildren_part_abbreviation_display, kRanks_part_abbreviation_display, &kModel_part_abbreviation_display, kAttributes_part_abbreviation_display },
+	{ "part-group", kElementsContent, kNoValue, kChildren_part_group, kRanks_part_group, &kModel_part_group, kAttributes_part_group },
+	{ "part-list", kElementsContent, kNoValue, kChildren_part_list, kRanks_part_list, &kModel_part_list, 0 },
+	{ "part-name", kTextContent, kStringValue, 0, 0, 0, kAttributes_part_name },
+	{ "part-name-display", kElementsContent, kNoValue, kChildren_part_name_display, kRanks_part_name_display, &kModel_part_name_display, kAttributes_part_name_display },
+	{ "part-symbol", kTextContent, kEnumValue, 0, 0, 0, kAttributes_part_symbol },
+	{ "pedal", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_pedal },
+	{ "pedal-alter", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "pedal-step", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "pedal-tuning", kElementsContent, kNoValue, kChildren_pedal_tuning, kRanks_pedal_tuning, &kModel_pedal_tuning, 0 },
+	{ "per-minute", kTextContent, kStringValue, 0, 0, 0, kAttributes_per_minute },
+	{ "percussion", kElementsContent, kNoValue, kChildren_percussion, kRanks_percussion, &kModel_percussion, kAttributes_percussion },
+	{ "pf", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "pitch", kElementsContent, kNoValue, kChildren_pitch, kRanks_pitch, &kModel_pitch, 0 },
+	{ "pitched", kTextContent, kEnumValue, 0, 0, 0, kAttributes_pitched },
+	{ "play", kElementsContent, kNoValue, kChildren_play, kRanks_play, &kModel_play, kAttributes_play },
+	{ "plop", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_plop },
+	{ "pluck", kTextContent, kStringValue, 0, 0, 0, kAttributes_pluck },
+	{ "pp", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "ppp", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "pppp", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "ppppp", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "pppppp", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "pre-bend", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "prefix", kTextContent, kStringValue, 0, 0, 0, kAttributes_prefix },
+	{ "principal-voice", kTextContent, kStringValue, 0, 0, 0, kAttributes_principal_voice },
+	{ "print", kElementsContent, kNoValue, kChildren_print, kRanks_print, &kModel_print, kAttributes_print },
+	{ "pull-off", kTextContent, kStringValue, 0, 0, 0, kAttributes_pull_off },
+	{ "rehearsal", kTextContent, kStringValue, 0, 0, 0, kAttributes_rehearsal },
+	{ "relation", kTextContent, kStringValue, 0, 0, 0, kAttributes_relation },
+	{ "release", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "repeat", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_repeat },
+	{ "rest", kElementsContent, kNoValue, kChildren_rest, kRanks_rest, &kModel_rest, kAttributes_rest },
+	{ "rf", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "rfz", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "right-divider", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_right_divider },
+	{ "right-margin", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "rights", kTextContent, kStringValue, 0, 0, 0, kAttributes_rights },
+	{ "root", kElementsContent, kNoValue, kChildren_root, kRanks_root, &kModel_root, 0 },
+	{ "root-alter", kTextContent, kNumericValue, 0, 0, 0, kAttributes_root_alter },
+	{ "root-step", kTextContent, kEnumValue, 0, 0, 0, kAttributes_root_step },
+	{ "scaling", kElementsContent, kNoValue, kChildren_scaling, kRanks_scaling, &kModel_scaling, 0 },
+	{ "schleifer", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_schleifer },
+	{ "scoop", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_scoop },
+	{ "scordatura", kElementsContent, kNoValue, kChildren_scordatura, kRanks_scordatura, &kModel_scordatura, kAttributes_scordatura },
+	{ "score-instrument", kElementsContent, kNoValue, kChildren_score_instrument, kRanks_score_instrument, &kModel_score_instrument, kAttributes_score_instrument },
+	{ "score-part", kElementsContent, kNoValue, kChildren_score_part, kRanks_score_part, &kModel_score_part, kAttributes_score_part },
+	{ "score-partwise", kElementsContent, kNoValue, kChildren_score_partwise, kRanks_score_partwise, &kModel_score_partwise, kAttributes_score_partwise },
+	{ "score-timewise", kUndeclared, kNoValue, 0, 0, 0, 0 },
+	{ "segno", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_segno },
+	{ "semi-pitched", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "senza-misura", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "sf", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "sffz", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "sfp", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "sfpp", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "sfz", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "sfzp", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "shake", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_shake },
+	{ "sign", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "slash", kElementsContent, kNoValue, kChildren_slash, kRanks_slash, &kModel_slash, kAttributes_slash },
+	{ "slash-dot", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "slash-type", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "slide", kTextContent, kStringValue, 0, 0, 0, kAttributes_slide },
+	{ "slur", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_slur },
+	{ "smear", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_smear },
+	{ "snap-pizzicato", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_snap_pizzicato },
+	{ "soft-accent", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_soft_accent },
+	{ "software", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "solo", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "sound", kElementsContent, kNoValue, kChildren_sound, kRanks_sound, &kModel_sound, kAttributes_sound },
+	{ "sounding-pitch", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "source", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "spiccato", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_spiccato },
+	{ "staccatissimo", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_staccatissimo },
+	{ "staccato", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_staccato },
+	{ "staff", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "staff-details", kElementsContent, kNoValue, kChildren_staff_details, kRanks_staff_details, &kModel_staff_details, kAttributes_staff_details },
+	{ "staff-distance", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "staff-divide", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_staff_divide },
+	{ "staff-layout", kElementsContent, kNoValue, kChildren_staff_layout, kRanks_staff_layout, &kModel_staff_layout, kAttributes_staff_layout },
+	{ "staff-lines", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "staff-size", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "staff-tuning", kElementsContent, kNoValue, kChildren_staff_tuning, kRanks_staff_tuning, &kModel_staff_tuning, kAttributes_staff_tuning },
+	{ "staff-type", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "staves", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "stem", kTextContent, kEnumValue, 0, 0, 0, kAttributes_stem },
+	{ "step", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "stick", kElementsContent, kNoValue, kChildren_stick, kRanks_stick, &kModel_stick, kAttributes_stick },
+	{ "stick-location", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "stick-material", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "stick-type", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "stopped", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_stopped },
+	{ "stress", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_stress },
+	{ "string", kTextContent, kNumericValue, 0, 0, 0, kAttributes_string },
+	{ "string-mute", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_string_mute },
+	{ "strong-accent", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_strong_accent },
+	{ "suffix", kTextContent, kStringValue, 0, 0, 0, kAttributes_suffix },
+	{ "supports", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_supports },
+	{ "syllabic", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "symbol", kTextContent, kStringValue, 0, 0, 0, kAttributes_symbol },
+	{ "system-distance", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "system-dividers", kElementsContent, kNoValue, kChildren_system_dividers, kRanks_system_dividers, &kModel_system_dividers, 0 },
+	{ "system-layout", kElementsContent, kNoValue, kChildren_system_layout, kRanks_system_layout, &kModel_system_layout, 0 },
+	{ "system-margins", kElementsContent, kNoValue, kChildren_system_margins, kRanks_system_margins, &kModel_system_margins, 0 },
+	{ "tap", kTextContent, kStringValue, 0, 0, 0, kAttributes_tap },
+	{ "technical", kElementsContent, kNoValue, kChildren_technical, kRanks_technical, &kModel_technical, kAttributes_technical },
+	{ "tenths", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "tenuto", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_tenuto },
+	{ "text", kTextContent, kStringValue, 0, 0, 0, kAttributes_text },
+	{ "thumb-position", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_thumb_position },
+	{ "tie", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_tie },
+	{ "tied", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_tied },
+	{ "time", kElementsContent, kNoValue, kChildren_time, kRanks_time, &kModel_time, kAttributes_time },
+	{ "time-modification", kElementsContent, kNoValue, kChildren_time_modification, kRanks_time_modification, &kModel_time_modification, 0 },
+	{ "time-relation", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "timpani", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "toe", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_toe },
+	{ "top-margin", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "top-system-distance", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "touching-pitch", kEmptyContent, kNoValue, 0, 0, 0, 0 },
+	{ "transpose", kElementsContent, kNoValue, kChildren_transpose, kRanks_transpose, &kModel_transpose, kAttributes_transpose },
+	{ "tremolo", kTextContent, kNumericValue, 0, 0, 0, kAttributes_tremolo },
+	{ "trill-mark", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_trill_mark },
+	{ "triple-tongue", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_triple_tongue },
+	{ "tuning-alter", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "tuning-octave", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "tuning-step", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "tuplet", kElementsContent, kNoValue, kChildren_tuplet, kRanks_tuplet, &kModel_tuplet, kAttributes_tuplet },
+	{ "tuplet-actual", kElementsContent, kNoValue, kChildren_tuplet_actual, kRanks_tuplet_actual, &kModel_tuplet_actual, 0 },
+	{ "tuplet-dot", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_tuplet_dot },
+	{ "tuplet-normal", kElementsContent, kNoValue, kChildren_tuplet_normal, kRanks_tuplet_normal, &kModel_tuplet_normal, 0 },
+	{ "tuplet-number", kTextContent, kNumericValue, 0, 0, 0, kAttributes_tuplet_number },
+	{ "tuplet-type", kTextContent, kEnumValue, 0, 0, 0, kAttributes_tuplet_type },
+	{ "turn", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_turn },
+	{ "type", kTextContent, kEnumValue, 0, 0, 0, kAttributes_type },
+	{ "unpitched", kElementsContent, kNoValue, kChildren_unpitched, kRanks_unpitched, &kModel_unpitched, 0 },
+	{ "unstress", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_unstress },
+	{ "up-bow", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_up_bow },
+	{ "vertical-turn", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_vertical_turn },
+	{ "virtual-instrument", kElementsContent, kNoValue, kChildren_virtual_instrument, kRanks_virtual_instrument, &kModel_virtual_instrument, 0 },
+	{ "virtual-library", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "virtual-name", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "voice", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "volume", kTextContent, kNumericValue, 0, 0, 0, 0 },
+	{ "wavy-line", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_wavy_line },
+	{ "wedge", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_wedge },
+	{ "with-bar", kTextContent, kStringValue, 0, 0, 0, kAttributes_with_bar },
+	{ "wood", kTextContent, kEnumValue, 0, 0, 0, 0 },
+	{ "word-font", kEmptyContent, kNoValue, 0, 0, 0, kAttributes_word_font },
+	{ "words", kTextContent, kStringValue, 0, 0, 0, kAttributes_words },
+	{ "work", kElementsContent, kNoValue, kChildren_work, kRanks_work, &kModel_work, 0 },
+	{ "work-number", kTextContent, kStringValue, 0, 0, 0, 0 },
+	{ "work-title", kTextContent, kStringValue, 0, 0, 0, 0 },
+};
+static_assert (sizeof(kInfos) / sizeof(kInfos[0]) == kEndElement, "elements types and metadata mismatch");
+
+//______________________________________________________________________________
+const elementinfo& elementinfo::get (int type)
+{
+	return ((type > kNoElement) && (type < kEndElement)) ? kInfos[type] : kInfos[kNoElement];
+}
+
+bool elementinfo::allows (int type) const
+{
+	if ((content == kUndeclared) || (content == kAnyContent)) return true;
+	if ((type == kComment) || (type == kProcessingInstruction)) return content != kEmptyContent;
+	if (!children || (type <= kNoElement) || (type >= kEndElement)) return false;
+	return (children[type >> 5] & (1u << (type & 31))) != 0;
+}
+
+int elementinfo::rank (int type) const
+{
+	return (ranks && (type > kNoElement) && (type < kEndElement)) ? ranks[type] : 0;
+}
+
+static int bitcount (unsigned v)
+{
+	v = v - ((v >> 1) & 0x55555555);
+	v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
+	return int((((v + (v >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24);
+}
+
+int elementinfo::index (int type) const
+{
+	if (!children || (type <= kNoElement) || (type >= kEndElement)) return -1;
+	int word = type >> 5;
+	unsigned bit = 1u << (type & 31);
+	if (!(children[word] & bit)) return -1;
+	int n = bitcount (children[word] & (bit - 1));
+	for (int i = 0; i < word; i++)
+		n += bitcount (children[i]);
+	return n;
+}
+
+const attributeinfo* elementinfo::attribute (const char* name) const
+{
+	for (const attributeinfo* a = attributes; a && a->name; a++)
+		if (!strcmp (a->name, name)) return a;
+	return 0;
+}
+
+//______________________________________________________________________________
+int contentmodel::next (int s, int type) const
+{
+	for (int i = offsets[s]; i < offsets[s+1]; i++) {
+		if (transitions[i].type == type) return transitions[i].target;
+		if (transitions[i].type > type) break;
+	}
+	return -1;
+}
+
+int contentmodel::resync (int type) const
+{
+	for (int i = 0; i < offsets[states]; i++)
+		if (transitions[i].type == type) return transitions[i].target;
+	return -1;
+}
+
+//______________________________________________________________________________
+bool attributeinfo::accepts (const char* value) const
+{
+	if (!values) return true;
+	size_t n = strlen (value);
+	for (const char* v = values; *v; ) {
+		const char* end = strchr (v, '|');
+		size_t len = end ? size_t(end - v) : strlen (v);
+		if ((len == n) && !strncmp (v, value, n)) return true;
+		if (!end) break;
+		v = end + 1;
+	}
+	return false;
+}
+
+bool attributeinfo::numeric (const char* name)
+{
+	int lo = 0, hi = kNumericAttributesCount - 1;
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+		int cmp = strcmp (name, kNumericAttributes[mid]);
+		if (cmp == 0) return true;
+		if (cmp < 0) hi = mid - 1;
+		else lo = mid + 1;
+	}
+	return false;
+}
+
+}
@@ -0,0 +1,121 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __elementsinfo__
+#define __elementsinfo__
+
+#include "exports.h"
+
+namespace MusicXML2
+{
+
+/*!
+\addtogroup MusicXML
+@{
+*/
+
+//! the elements content kinds, as declared by the DTD
+enum contentkind { kUndeclared, kEmptyContent, kTextContent, kMixedContent, kElementsContent, kAnyContent };
+//! the elements values types, as declared by the schema
+enum valuekind { kNoValue, kStringValue, kNumericValue, kEnumValue };
+//! the attributes flags
+enum { kRequiredAttribute = 1 };
+
+//______________________________________________________________________________
+/*!
+\brief An attribute declaration.
+*/
+struct EXP attributeinfo {
+	const char*	name;
+	const char*	values;		//!< the enumerated values separated by '|', 0 when the values are not enumerated
+	int			flags;
+
+	//! checks if a value is allowed (any value is allowed when the values are not enumerated)
+	bool	accepts (const char* value) const;
+	//! checks if an attribute may have a numeric value according to the schema (the attributes are identified by their name)
+	static bool numeric (const char* name);
+};
+
+//! a content model transition
+struct transition {
+	int		type;
+	int		target;
+};
+
+//______________________________________________________________________________
+/*!
+\brief A content model compiled into a deterministic automaton.
+
+	The state 0 is the initial state. The transitions are ordered by state
+	and by type for each state.
+*/
+struct EXP contentmodel {
+	int					states;			//!< the count of states
+	const int*			offsets;		//!< the transitions of the state s are in [offsets[s], offsets[s+1][
+	const transition*	transitions;
+	const char*			finals;			//!< the accepting states
+
+	//! gives the next state, -1 when an element type is not accepted in the state s
+	int		next (int s, int type) const;
+	//! gives the first state reached by an element type from any state, -1 when the type is not in the model
+	int		resync (int type) const;
+	bool	final (int s) const		{ return finals[s] != 0; }
+};
+
+//______________________________________________________________________________
+/*!
+\brief The elements metadata.
+
+	The metadata are constant tables indexed by the element type. They are generated
+	from the MusicXML DTD and schema by the elements.bash script, like the elements
+	constants and the factory.
+	The content models are those of the partwise DTD: the elements that are not
+	declared by the DTD (e.g. score-timewise) have a kUndeclared content and
+	any child is allowed.
+*/
+struct EXP elementinfo {
+	const char*				name;
+	int						content;	//!< the content kind (see contentkind)
+	int						value;		//!< the type of the element value (see valuekind)
+	const unsigned*			children;	//!< the allowed children types as a bitset, 0 when no child is allowed
+	const unsigned char*	ranks;		//!< the children ranks indexed by type, 0 when no child is allowed
+	const contentmodel*		model;		//!< the content model automaton, 0 when no child is allowed
+	const attributeinfo*	attributes;	//!< the declared attributes, terminated by a null name
+
+	//! gives the metadata of an element type
+	static const elementinfo& get (int type);
+
+	//! checks if an element type is allowed as a child (comments and processing instructions are allowed in non empty elements)
+	bool	allows (int type) const;
+	/*! \brief gives the rank of a child in the content model
+
+		The children of an element must appear in increasing ranks order,
+		the elements that have the same rank may appear in any order.
+		The ranks are in [1, 255] and are given by a constant table lookup.
+		\return the rank or 0 when the element is not allowed
+	*/
+	int		rank (int type) const;
+	/*! \brief gives the index of a child type in the allowed children set
+
+		The allowed children are numbered in the types order, from 0.
+		\return the index or -1 when the element is not allowed
+	*/
+	int		index (int type) const;
+	//! gives an attribute declaration, 0 when the attribute is not declared
+	const attributeinfo* attribute (const char* name) const;
+};
+
+/*! @} */
+
+}
+
+#endif
@@ -0,0 +1,442 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+//======================================================================
+// DON'T MODIFY THIS FILE!
+// It is automatically generated from the MusicXML DTDs and from 
+// template files (located in the templates folder). 
+//======================================================================
+#ifndef __elementslist__
+#define __elementslist__
+
+/*
+	MUSICXML_ELEMENTS(M) expands M(type, S_type) for each element type
+	e.g. to generate a switch on the elements type:
+	#define CASE(t, S_t)	case t: ... break;
+	switch (type) { MUSICXML_ELEMENTS(CASE) }
+*/
+#define MUSICXML_ELEMENTS(M) \
+	M(kComment, S_comment) \
+	M(kProcessingInstruction, S_processing_instruction) \
+	M(k_accent, S_accent) \
+	M(k_accidental, S_accidental) \
+	M(k_accidental_mark, S_accidental_mark) \
+	M(k_accidental_text, S_accidental_text) \
+	M(k_accord, S_accord) \
+	M(k_accordion_high, S_accordion_high) \
+	M(k_accordion_low, S_accordion_low) \
+	M(k_accordion_middle, S_accordion_middle) \
+	M(k_accordion_registration, S_accordion_registration) \
+	M(k_actual_notes, S_actual_notes) \
+	M(k_alter, S_alter) \
+	M(k_appearance, S_appearance) \
+	M(k_arpeggiate, S_arpeggiate) \
+	M(k_arrow, S_arrow) \
+	M(k_arrow_direction, S_arrow_direction) \
+	M(k_arrow_style, S_arrow_style) \
+	M(k_arrowhead, S_arrowhead) \
+	M(k_articulations, S_articulations) \
+	M(k_artificial, S_artificial) \
+	M(k_attributes, S_attributes) \
+	M(k_backup, S_backup) \
+	M(k_bar_style, S_bar_style) \
+	M(k_barline, S_barline) \
+	M(k_barre, S_barre) \
+	M(k_base_pitch, S_base_pitch) \
+	M(k_bass, S_bass) \
+	M(k_bass_alter, S_bass_alter) \
+	M(k_bass_step, S_bass_step) \
+	M(k_beam, S_beam) \
+	M(k_beat_repeat, S_beat_repeat) \
+	M(k_beat_type, S_beat_type) \
+	M(k_beat_unit, S_beat_unit) \
+	M(k_beat_unit_dot, S_beat_unit_dot) \
+	M(k_beat_unit_tied, S_beat_unit_tied) \
+	M(k_beater, S_beater) \
+	M(k_beats, S_beats) \
+	M(k_bend, S_bend) \
+	M(k_bend_alter, S_bend_alter) \
+	M(k_bookmark, S_bookmark) \
+	M(k_bottom_margin, S_bottom_margin) \
+	M(k_bracket, S_bracket) \
+	M(k_brass_bend, S_brass_bend) \
+	M(k_breath_mark, S_breath_mark) \
+	M(k_caesura, S_caesura) \
+	M(k_cancel, S_cancel) \
+	M(k_capo, S_capo) \
+	M(k_chord, S_chord) \
+	M(k_chromatic, S_chromatic) \
+	M(k_circular_arrow, S_circular_arrow) \
+	M(k_clef, S_clef) \
+	M(k_clef_octave_change, S_clef_octave_change) \
+	M(k_coda, S_coda) \
+	M(k_creator, S_creator) \
+	M(k_credit, S_credit) \
+	M(k_credit_image, S_credit_image) \
+	M(k_credit_symbol, S_credit_symbol) \
+	M(k_credit_type, S_credit_type) \
+	M(k_credit_words, S_credit_words) \
+	M(k_cue, S_cue) \
+	M(k_damp, S_damp) \
+	M(k_damp_all, S_damp_all) \
+	M(k_dashes, S_dashes) \
+	M(k_defaults, S_defaults) \
+	M(k_degree, S_degree) \
+	M(k_degree_alter, S_degree_alter) \
+	M(k_degree_type, S_degree_type) \
+	M(k_degree_value, S_degree_value) \
+	M(k_delayed_inverted_turn, S_delayed_inverted_turn) \
+	M(k_delayed_turn, S_delayed_turn) \
+	M(k_detached_legato, S_detached_legato) \
+	M(k_diatonic, S_diatonic) \
+	M(k_direction, S_direction) \
+	M(k_direction_type, S_direction_type) \
+	M(k_directive, S_directive) \
+	M(k_display_octave, S_display_octave) \
+	M(k_display_step, S_display_step) \
+	M(k_display_text, S_display_text) \
+	M(k_distance, S_distance) \
+	M(k_divisions, S_divisions) \
+	M(k_doit, S_doit) \
+	M(k_dot, S_dot) \
+	M(k_double, S_double) \
+	M(k_double_tongue, S_double_tongue) \
+	M(k_down_bow, S_down_bow) \
+	M(k_duration, S_duration) \
+	M(k_dynamics, S_dynamics) \
+	M(k_effect, S_effect) \
+	M(k_elevation, S_elevation) \
+	M(k_elision, S_elision) \
+	M(k_encoder, S_encoder) \
+	M(k_encoding, S_encoding) \
+	M(k_encoding_date, S_encoding_date) \
+	M(k_encoding_description, S_encoding_description) \
+	M(k_end_line, S_end_line) \
+	M(k_end_paragraph, S_end_paragraph) \
+	M(k_ending, S_ending) \
+	M(k_ensemble, S_ensemble) \
+	M(k_except_voice, S_except_voice) \
+	M(k_extend, S_extend) \
+	M(k_eyeglasses, S_eyeglasses) \
+	M(k_f, S_f) \
+	M(k_falloff, S_falloff) \
+	M(k_feature, S_feature) \
+	M(k_fermata, S_fermata) \
+	M(k_ff, S_ff) \
+	M(k_fff, S_fff) \
+	M(k_ffff, S_ffff) \
+	M(k_fffff, S_fffff) \
+	M(k_ffffff, S_ffffff) \
+	M(k_fifths, S_fifths) \
+	M(k_figure, S_figure) \
+	M(k_figure_number, S_figure_number) \
+	M(k_figured_bass, S_figured_bass) \
+	M(k_fingering, S_fingering) \
+	M(k_fingernails, S_fingernails) \
+	M(k_first_fret, S_first_fret) \
+	M(k_flip, S_flip) \
+	M(k_footnote, S_footnote) \
+	M(k_forward, S_forward) \
+	M(k_fp, S_fp) \
+	M(k_frame, S_frame) \
+	M(k_frame_frets, S_frame_frets) \
+	M(k_frame_note, S_frame_note) \
+	M(k_frame_strings, S_frame_strings) \
+	M(k_fret, S_fret) \
+	M(k_function, S_function) \
+	M(k_fz, S_fz) \
+	M(k_glass, S_glass) \
+	M(k_glissando, S_glissando) \
+	M(k_glyph, S_glyph) \
+	M(k_golpe, S_golpe) \
+	M(k_grace, S_grace) \
+	M(k_group, S_group) \
+	M(k_group_abbreviation, S_group_abbreviation) \
+	M(k_group_abbreviation_display, S_group_abbreviation_display) \
+	M(k_group_barline, S_group_barline) \
+	M(k_group_name, S_group_name) \
+	M(k_group_name_display, S_group_name_display) \
+	M(k_group_symbol, S_group_symbol) \
+	M(k_group_time, S_group_time) \
+	M(k_grouping, S_grouping) \
+	M(k_half_muted, S_half_muted) \
+	M(k_hammer_on, S_hammer_on) \
+	M(k_handbell, S_handbell) \
+	M(k_harmon_closed, S_harmon_closed) \
+	M(k_harmon_mute, S_harmon_mute) \
+	M(k_harmonic, S_harmonic) \
+	M(k_harmony, S_harmony) \
+	M(k_harp_pedals, S_harp_pedals) \
+	M(k_haydn, S_haydn) \
+	M(k_heel, S_heel) \
+	M(k_hole, S_hole) \
+	M(k_hole_closed, S_hole_closed) \
+	M(k_hole_shape, S_hole_shape) \
+	M(k_hole_type, S_hole_type) \
+	M(k_humming, S_humming) \
+	M(k_identification, S_identification) \
+	M(k_image, S_image) \
+	M(k_instrument, S_instrument) \
+	M(k_instrument_abbreviation, S_instrument_abbreviation) \
+	M(k_instrument_name, S_instrument_name) \
+	M(k_instrument_sound, S_instrument_sound) \
+	M(k_instruments, S_instruments) \
+	M(k_interchangeable, S_interchangeable) \
+	M(k_inversion, S_inversion) \
+	M(k_inverted_mordent, S_inverted_mordent) \
+	M(k_inverted_turn, S_inverted_turn) \
+	M(k_inverted_vertical_turn, S_inverted_vertical_turn) \
+	M(k_ipa, S_ipa) \
+	M(k_key, S_key) \
+	M(k_key_accidental, S_key_accidental) \
+	M(k_key_alter, S_key_alter) \
+	M(k_key_octave, S_key_octave) \
+	M(k_key_step, S_key_step) \
+	M(k_kind, S_kind) \
+	M(k_laughing, S_laughing) \
+	M(k_left_divider, S_left_divider) \
+	M(k_left_margin, S_left_margin) \
+	M(k_level, S_level) \
+	M(k_line, S_line) \
+	M(k_line_width, S_line_width) \
+	M(k_link, S_link) \
+	M(k_lyric, S_lyric) \
+	M(k_lyric_font, S_lyric_font) \
+	M(k_lyric_language, S_lyric_language) \
+	M(k_measure, S_measure) \
+	M(k_measure_distance, S_measure_distance) \
+	M(k_measure_layout, S_measure_layout) \
+	M(k_measure_numbering, S_measure_numbering) \
+	M(k_measure_repeat, S_measure_repeat) \
+	M(k_measure_style, S_measure_style) \
+	M(k_membrane, S_membrane) \
+	M(k_metal, S_metal) \
+	M(k_metronome, S_metronome) \
+	M(k_metronome_arrows, S_metronome_arrows) \
+	M(k_metronome_beam, S_metronome_beam) \
+	M(k_metronome_dot, S_metronome_dot) \
+	M(k_metronome_note, S_metronome_note) \
+	M(k_metronome_relation, S_metronome_relation) \
+	M(k_metronome_tied, S_metronome_tied) \
+	M(k_metronome_tuplet, S_metronome_tuplet) \
+	M(k_metronome_type, S_metronome_type) \
+	M(k_mf, S_mf) \
+	M(k_midi_bank, S_midi_bank) \
+	M(k_midi_channel, S_midi_channel) \
+	M(k_midi_device, S_midi_device) \
+	M(k_midi_instrument, S_midi_instrument) \
+	M(k_midi_name, S_midi_name) \
+	M(k_midi_program, S_midi_program) \
+	M(k_midi_unpitched, S_midi_unpitched) \
+	M(k_millimeters, S_millimeters) \
+	M(k_miscellaneous, S_miscellaneous) \
+	M(k_miscellaneous_field, S_miscellaneous_field) \
+	M(k_mode, S_mode) \
+	M(k_mordent, S_mordent) \
+	M(k_movement_number, S_movement_number) \
+	M(k_movement_title, S_movement_title) \
+	M(k_mp, S_mp) \
+	M(k_multiple_rest, S_multiple_rest) \
+	M(k_music_font, S_music_font) \
+	M(k_mute, S_mute) \
+	M(k_n, S_n) \
+	M(k_natural, S_natural) \
+	M(k_non_arpeggiate, S_non_arpeggiate) \
+	M(k_normal_dot, S_normal_dot) \
+	M(k_normal_notes, S_normal_notes) \
+	M(k_normal_type, S_normal_type) \
+	M(k_notations, S_notations) \
+	M(k_note, S_note) \
+	M(k_note_size, S_note_size) \
+	M(k_notehead, S_notehead) \
+	M(k_notehead_text, S_notehead_text) \
+	M(k_octave, S_octave) \
+	M(k_octave_change, S_octave_change) \
+	M(k_octave_shift, S_octave_shift) \
+	M(k_offset, S_offset) \
+	M(k_open, S_open) \
+	M(k_open_string, S_open_string) \
+	M(k_opus, S_opus) \
+	M(k_ornaments, S_ornaments) \
+	M(k_other_appearance, S_other_appearance) \
+	M(k_other_articulation, S_other_articulation) \
+	M(k_other_direction, S_other_direction) \
+	M(k_other_dynamics, S_other_dynamics) \
+	M(k_other_notation, S_other_notation) \
+	M(k_other_ornament, S_other_ornament) \
+	M(k_other_percussion, S_other_percussion) \
+	M(k_other_play, S_other_play) \
+	M(k_other_technical, S_other_technical) \
+	M(k_p, S_p) \
+	M(k_page_height, S_page_height) \
+	M(k_page_layout, S_page_layout) \
+	M(k_page_margins, S_page_margins) \
+	M(k_page_width, S_page_width) \
+	M(k_pan, S_pan) \
+	M(k_part, S_part) \
+	M(k_part_abbreviation, S_part_abbreviation) \
+	M(k_part_abbreviation_display, S_part_abbreviation_display) \
+	M(k_part_group, S_part_group) \
+	M(k_part_list, S_part_list) \
+	M(k_part_name, S_part_name) \
+	M(k_part_name_display, S_part_name_display) \
+	M(k_part_symbol, S_part_symbol) \
+	M(k_pedal, S_pedal) \
+	M(k_pedal_alter, S_pedal_alter) \
+	M(k_pedal_step, S_pedal_step) \
+	M(k_pedal_tuning, S_pedal_tuning) \
+	M(k_per_minute, S_per_minute) \
+	M(k_percussion, S_percussion) \
+	M(k_pf, S_pf) \
+	M(k_pitch, S_pitch) \
+	M(k_pitched, S_pitched) \
+	M(k_play, S_play) \
+	M(k_plop, S_plop) \
+	M(k_pluck, S_pluck) \
+	M(k_pp, S_pp) \
+	M(k_ppp, S_ppp) \
+	M(k_pppp, S_pppp) \
+	M(k_ppppp, S_ppppp) \
+	M(k_pppppp, S_pppppp) \
+	M(k_pre_bend, S_pre_bend) \
+	M(k_prefix, S_prefix) \
+	M(k_principal_voice, S_principal_voice) \
+	M(k_print, S_print) \
+	M(k_pull_off, S_pull_off) \
+	M(k_rehearsal, S_rehearsal) \
+	M(k_relation, S_relation) \
+	M(k_release, S_release) \
+	M(k_repeat, S_repeat) \
+	M(k_rest, S_rest) \
+	M(k_rf, S_rf) \
+	M(k_rfz, S_rfz) \
+	M(k_right_divider, S_right_divider) \
+	M(k_right_margin, S_right_margin) \
+	M(k_rights, S_rights) \
+	M(k_root, S_root) \
+	M(k_root_alter, S_root_alter) \
+	M(k_root_step, S_root_step) \
+	M(k_scaling, S_scaling) \
+	M(k_schleifer, S_schleifer) \
+	M(k_scoop, S_scoop) \
+	M(k_scordatura, S_scordatura) \
+	M(k_score_instrument, S_score_instrument) \
+	M(k_score_part, S_score_part) \
+	M(k_score_partwise, S_score_partwise) \
+	M(k_score_timewise, S_score_timewise) \
+	M(k_segno, S_segno) \
+	M(k_semi_pitched, S_semi_pitched) \
+	M(k_senza_misura, S_senza_misura) \
+	M(k_sf, S_sf) \
+	M(k_sffz, S_sffz) \
+	M(k_sfp, S_sfp) \
+	M(k_sfpp, S_sfpp) \
+	M(k_sfz, S_sfz) \
+	M(k_sfzp, S_sfzp) \
+	M(k_shake, S_shake) \
+	M(k_sign, S_sign) \
+	M(k_slash, S_slash) \
+	M(k_slash_dot, S_slash_dot) \
+	M(k_slash_type, S_slash_type) \
+	M(k_slide, S_slide) \
+	M(k_slur, S_slur) \
+	M(k_smear, S_smear) \
+	M(k_snap_pizzicato, S_snap_pizzicato) \
+	M(k_soft_accent, S_soft_accent) \
+	M(k_software, S_software) \
+	M(k_solo, S_solo) \
+	M(k_sound, S_sound) \
+	M(k_sounding_pitch, S_sounding_pitch) \
+	M(k_source, S_source) \
+	M(k_spiccato, S_spiccato) \
+	M(k_staccatissimo, S_staccatissimo) \
+	M(k_staccato, S_staccato) \
+	M(k_staff, S_staff) \
+	M(k_staff_details, S_staff_details) \
+	M(k_staff_distance, S_staff_distance) \
+	M(k_staff_divide, S_staff_divide) \
+	M(k_staff_layout, S_staff_layout) \
+	M(k_staff_lines, S_staff_lines) \
+	M(k_staff_size, S_staff_size) \
+	M(k_staff_tuning, S_staff_tuning) \
+	M(k_staff_type, S_staff_type) \
+	M(k_staves, S_staves) \
+	M(k_stem, S_stem) \
+	M(k_step, S_step) \
+	M(k_stick, S_stick) \
+	M(k_stick_location, S_stick_location) \
+	M(k_stick_material, S_stick_material) \
+	M(k_stick_type, S_stick_type) \
+	M(k_stopped, S_stopped) \
+	M(k_stress, S_stress) \
+	M(k_string, S_string) \
+	M(k_string_mute, S_string_mute) \
+	M(k_strong_accent, S_strong_accent) \
+	M(k_suffix, S_suffix) \
+	M(k_supports, S_supports) \
+	M(k_syllabic, S_syllabic) \
+	M(k_symbol, S_symbol) \
+	M(k_system_distance, S_system_distance) \
+	M(k_system_dividers, S_system_dividers) \
+	M(k_system_layout, S_system_layout) \
+	M(k_system_margins, S_system_margins) \
+	M(k_tap, S_tap) \
+	M(k_technical, S_technical) \
+	M(k_tenths, S_tenths) \
+	M(k_tenuto, S_tenuto) \
+	M(k_text, S_text) \
+	M(k_thumb_position, S_thumb_position) \
+	M(k_tie, S_tie) \
+	M(k_tied, S_tied) \
+	M(k_time, S_time) \
+	M(k_time_modification, S_time_modification) \
+	M(k_time_relation, S_time_relation) \
+	M(k_timpani, S_timpani) \
+	M(k_toe, S_toe) \
+	M(k_top_margin, S_top_margin) \
+	M(k_top_system_distance, S_top_system_distance) \
+	M(k_touching_pitch, S_touching_pitch) \
+	M(k_transpose, S_transpose) \
+	M(k_tremolo, S_tremolo) \
+	M(k_trill_mark, S_trill_mark) \
+	M(k_triple_tongue, S_triple_tongue) \
+	M(k_tuning_alter, S_tuning_alter) \
+	M(k_tuning_octave, S_tuning_octave) \
+	M(k_tuning_step, S_tuning_step) \
+	M(k_tuplet, S_tuplet) \
+	M(k_tuplet_actual, S_tuplet_actual) \
+	M(k_tuplet_dot, S_tuplet_dot) \
+	M(k_tuplet_normal, S_tuplet_normal) \
+	M(k_tuplet_number, S_tuplet_number) \
+	M(k_tuplet_type, S_tuplet_type) \
+	M(k_turn, S_turn) \
+	M(k_type, S_type) \
+	M(k_unpitched, S_unpitched) \
+	M(k_unstress, S_unstress) \
+	M(k_up_bow, S_up_bow) \
+	M(k_vertical_turn, S_vertical_turn) \
+	M(k_virtual_instrument, S_virtual_instrument) \
+	M(k_virtual_library, S_virtual_library) \
+	M(k_virtual_name, S_virtual_name) \
+	M(k_voice, S_voice) \
+	M(k_volume, S_volume) \
+	M(k_wavy_line, S_wavy_line) \
+	M(k_wedge, S_wedge) \
+	M(k_with_bar, S_with_bar) \
+	M(k_wood, S_wood) \
+	M(k_word_font, S_word_font) \
+	M(k_words, S_words) \
+	M(k_work, S_work) \
+	M(k_work_number, S_work_number) \
+	M(k_work_title, S_work_title) \
+
+#endif
@@ -14,8 +14,6 @@
 #define __factory__
 
 #include <string>
-#include <map>
-#include "functor.h"
 #include "singleton.h"
 #include "xml.h"
 
@@ -27,16 +25,27 @@ namespace MusicXML2
 @{
 */
 
+/*!
+\brief The elements factory.
+
+	The elements names, types and creation functions are constant tables
+	generated from the MusicXML DTDs: the factory has no state and no
+	initialization cost.
+*/
 class EXP factory : public singleton<factory>{
 
-	std::map<std::string, functor<Sxmlelement>*> fMap;
-	std::map<int, const char*>	fType2Name;
 	public:
-				 factory();
+				 factory() {}
 		virtual ~factory() {}
 
 		Sxmlelement create(const std::string& elt) const;	
+		Sxmlelement create(const char* elt) const;	
 		Sxmlelement create(int type) const;	
+
+		//! gives the type of an element name or kNoElement when unknown
+		int			type(const char* elt) const;
+		//! gives the name of an element type or 0 when unknown
+		const char*	name(int type) const;
 };
 
 }
@@ -0,0 +1,144 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+#include "elements.h"
+#include "parallel_tree_browser.h"
+#include "xml_tree_browser.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+// browses the tree except the tasks subtrees
+//______________________________________________________________________________
+class skeleton_browser : public xml_tree_browser
+{
+	const vector<xmlelement*>&	fTasks;
+	size_t						fNext;
+
+	public:
+				 skeleton_browser(basevisitor* v, const vector<xmlelement*>& tasks) : xml_tree_browser(v), fTasks(tasks), fNext(0) {}
+		virtual ~skeleton_browser() {}
+
+	protected:
+		virtual bool intercept (xmlelement& t) {
+			if ((fNext == fTasks.size()) || (&t != fTasks[fNext])) return false;
+			fNext++;			// tasks are in document order
+			return true;
+		}
+};
+
+//______________________________________________________________________________
+// a range of pending tasks owned by a worker
+// the owner takes the tasks at the beginning, the thieves at the end
+//______________________________________________________________________________
+class taskrange
+{
+	mutex	fLock;
+	size_t	fBegin, fEnd;
+
+	public:
+				 taskrange() : fBegin(0), fEnd(0) {}
+
+		void set (size_t begin, size_t end) {
+			lock_guard<mutex> l(fLock);
+			fBegin = begin; fEnd = end;
+		}
+		bool pop (size_t& i) {
+			lock_guard<mutex> l(fLock);
+			if (fBegin == fEnd) return false;
+			i = fBegin++;
+			return true;
+		}
+		// takes the second half of the pending tasks
+		bool steal (size_t& begin, size_t& end) {
+			lock_guard<mutex> l(fLock);
+			if (fBegin == fEnd) return false;
+			end = fEnd;
+			begin = fEnd - (fEnd - fBegin + 1) / 2;
+			fEnd = begin;
+			return true;
+		}
+};
+
+//______________________________________________________________________________
+void parallel_tree_browser::collect (xmlelement* elt, int type, vector<xmlelement*>& tasks)
+{
+	for (ctree<xmlelement>::literator i = elt->lbegin(); i != elt->lend(); i++) {
+		xmlelement* e = *i;
+		if (e->getType() == type) tasks.push_back (e);
+		else collect (e, type, tasks);
+	}
+}
+
+//______________________________________________________________________________
+void parallel_tree_browser::run (xmlelement& t, reduction& r)
+{
+	int type = (fGranularity == kMeasures) ? k_measure : k_part;
+	vector<xmlelement*> tasks;
+	if (t.getType() == type) tasks.push_back (&t);
+	else collect (&t, type, tasks);
+
+	size_t threads = (fThreads > 0) ? size_t(fThreads) : size_t(thread::hardware_concurrency());
+	size_t n = max (size_t(1), min (threads, tasks.size()));
+	bool freeze = (n > 1) && !t.frozen();
+	if (freeze) t.freeze (true);
+
+	// the tasks are evenly distributed to the workers, which steal
+	// the pending tasks of the others when they are done with their own
+	vector<task*> results (tasks.size(), (task*)0);
+	vector<taskrange> ranges (n);
+	for (size_t i = 0; i < n; i++)
+		ranges[i].set (i * tasks.size() / n, (i + 1) * tasks.size() / n);
+	auto work = [&] (size_t self) {
+		size_t i, begin, end;
+		for (;;) {
+			if (!ranges[self].pop (i)) {
+				bool stolen = false;
+				for (size_t v = 1; (v < n) && !stolen; v++)
+					stolen = ranges[(self + v) % n].steal (begin, end);
+				if (!stolen) break;
+				ranges[self].set (begin + 1, end);
+				i = begin;
+			}
+			task* vt = r.create();
+			vt->browse (*tasks[i]);
+			results[i] = vt;
+		}
+	};
+	vector<thread> pool;
+	for (size_t i = 1; i < n; i++)
+		pool.push_back (thread (work, i));
+	skeleton_browser skeleton (r.visitor(), tasks);
+	skeleton.browse (t);
+	work (0);
+	for (size_t i = 0; i < pool.size(); i++)
+		pool[i].join();
+
+	for (size_t i = 0; i < results.size(); i++) {
+		r.merge (results[i]);
+		delete results[i];
+	}
+	if (freeze) t.freeze (false);
+}
+
+}
@@ -0,0 +1,114 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __parallel_tree_browser__
+#define __parallel_tree_browser__
+
+#include <vector>
+
+#include "exports.h"
+#include "basevisitor.h"
+#include "static_tree_browser.h"
+#include "xml.h"
+
+namespace MusicXML2
+{
+
+/*!
+\addtogroup MusicXML
+@{
+*/
+
+//______________________________________________________________________________
+/*!
+\brief A browser that runs a visitor on several threads and reduces the results.
+
+	The tree is split into tasks: the \c part or the \c measure elements.
+	Each task is browsed by a copy of the visitor on a pool of worker threads,
+	using a static dispatch (see static_tree_browser).
+	The copies are next merged into the visitor in document order, using
+	its \c merge method that must be defined as:
+	\code
+		void merge (const V& task);
+	\endcode
+	Thus the result doesn't depend on the threads scheduling.
+	The elements outside the tasks (e.g. the part-list) are visited by the
+	visitor itself on the calling thread.
+
+	The copies are made from the visitor before browsing: it should be in its
+	initial state. Tasks are browsed independently: visitors that rely on
+	the preceding measures (e.g. on the divisions) should use the parts granularity.
+	The tree is frozen during the browse (see TXMLFile::freeze) and must not
+	be modified by the visitors.
+*/
+class EXP parallel_tree_browser
+{
+	public:
+		enum granularity { kParts, kMeasures };
+
+		/*! \param threads the number of threads, 0 to use the hardware concurrency
+			\param g the tasks granularity
+		*/
+				 parallel_tree_browser(int threads=0, granularity g=kParts) : fThreads(threads), fGranularity(g) {}
+		virtual ~parallel_tree_browser() {}
+
+		template <typename V> void browse (xmlelement& t, V& v) {
+			reducer<V> r(v);
+			run (t, r);
+		}
+
+	protected:
+		// the visitor of a task
+		class task {
+			public:
+				virtual ~task() {}
+				virtual void browse (xmlelement& t) = 0;
+		};
+		// creates and merges the tasks visitors
+		class reduction {
+			public:
+				virtual ~reduction() {}
+				virtual basevisitor* visitor() = 0;
+				virtual task*	create () const = 0;
+				virtual void	merge (task* t) = 0;
+		};
+
+		template <typename V> class vtask : public task {
+			public:
+				V	fVisitor;
+						 vtask(const V& v) : fVisitor(v) {}
+				void	browse (xmlelement& t)	{ static_tree_browser<V> browser(&fVisitor); browser.browse (t); }
+		};
+		template <typename V> class reducer : public reduction {
+			V&	fVisitor;
+			V	fPrototype;
+			public:
+						 reducer(V& v) : fVisitor(v), fPrototype(v) {}
+				basevisitor* visitor()		{ return &fVisitor; }
+				task*	create () const		{ return new vtask<V>(fPrototype); }
+				void	merge (task* t)		{ fVisitor.merge (static_cast<vtask<V>*>(t)->fVisitor); }
+		};
+
+		virtual void run (xmlelement& t, reduction& r);
+		//! collects the tasks subtrees in document order
+		virtual void collect (xmlelement* elt, int type, std::vector<xmlelement*>& tasks);
+
+	private:
+		int			fThreads;
+		granularity	fGranularity;
+};
+
+/*! @} */
+
+}
+
+#endif
@@ -0,0 +1,125 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include "elements.h"
+#include "factory.h"
+#include "range_xml_tree_browser.h"
+
+using namespace std;
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+// attributescollector
+//______________________________________________________________________________
+// the attributes sub-elements that make the state, in the dtd order
+// directive and measure-style are not part of the state: they apply to the current measure
+static const int kStateElements[] = { k_divisions, k_key, k_time, k_staves, k_part_symbol,
+							k_instruments, k_clef, k_staff_details, k_transpose, kNoElement };
+
+void attributescollector::add (const Sxmlelement& measure)
+{
+	ctree<xmlelement>::literator i;
+	for (i = measure->lbegin(); i != measure->lend(); i++) {
+		if ((*i)->getType() != k_attributes) continue;
+		ctree<xmlelement>::literator j;
+		for (j = (*i)->lbegin(); j != (*i)->lend(); j++) {
+			fState[key((*j)->getType(), (*j)->getAttributeValue("number"))] = *j;
+		}
+	}
+}
+
+//______________________________________________________________________________
+Sxmlelement attributescollector::attributes (const Sxmlelement& next) const
+{
+	if (fState.empty()) return 0;
+
+	// collects the state redefined at the beginning of the next measure (before any note)
+	attributescollector redefined;
+	if (next) {
+		ctree<xmlelement>::literator i;
+		for (i = next->lbegin(); (i != next->lend()) && ((*i)->getType() != k_note); i++) {
+			if ((*i)->getType() != k_attributes) continue;
+			ctree<xmlelement>::literator j;
+			for (j = (*i)->lbegin(); j != (*i)->lend(); j++)
+				redefined.fState[key((*j)->getType(), (*j)->getAttributeValue("number"))] = *j;
+		}
+	}
+
+	Sxmlelement attributes;
+	for (const int* type = kStateElements; *type != kNoElement; type++) {
+		map<key, Sxmlelement>::const_iterator i = fState.lower_bound (key(*type, ""));
+		while ((i != fState.end()) && (i->first.first == *type)) {
+			if (redefined.fState.find(i->first) == redefined.fState.end()) {
+				if (!attributes) attributes = factory::instance().create(k_attributes);
+				attributes->push (i->second->clone());		// the collected elements belong to the score
+			}
+			i++;
+		}
+	}
+	return attributes;
+}
+
+//______________________________________________________________________________
+// range_xml_tree_browser
+//______________________________________________________________________________
+bool range_xml_tree_browser::intercept (xmlelement& t)
+{
+	if (t.getType() != k_part) return false;
+	fPartIndex++;
+	if (fRange.beforePart(fPartIndex) || fRange.afterPart(fPartIndex)) return true;		// skipped
+	if (fRange.allMeasures()) return false;
+	browsePart (t);
+	return true;
+}
+
+//______________________________________________________________________________
+void range_xml_tree_browser::browsePart (xmlelement& part)
+{
+	attributescollector skipped;
+	int measureIndex = 0;
+
+	enter(part);
+	ctree<xmlelement>::literator iter;
+	for (iter = part.lbegin(); iter != part.lend(); iter++) {
+		if ((*iter)->getType() != k_measure) {
+			browse(**iter);
+			continue;
+		}
+		measureIndex++;
+		if (fRange.beforeMeasure(measureIndex)) {
+			skipped.add (*iter);
+			continue;
+		}
+		if (fRange.afterMeasure(measureIndex)) break;
+
+		Sxmlelement attributes = skipped.attributes(*iter);
+		if (attributes) {
+			// the state is visited at the beginning of the first measure of the range
+			enter(**iter);
+			browse(*attributes);
+			ctree<xmlelement>::literator i;
+			for (i = (*iter)->lbegin(); i != (*iter)->lend(); i++)
+				browse(**i);
+			leave(**iter);
+			skipped.clear();
+		}
+		else browse(**iter);
+	}
+	leave(part);
+}
+
+}
@@ -0,0 +1,117 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __range_xml_tree_browser__
+#define __range_xml_tree_browser__
+
+#include <map>
+#include <utility>
+#include <string>
+
+#include "exports.h"
+#include "xml.h"
+#include "xml_tree_browser.h"
+
+namespace MusicXML2
+{
+
+/*!
+\addtogroup MusicXML
+@{
+*/
+
+//______________________________________________________________________________
+/*!
+\brief A range of parts and measures.
+
+	Parts and measures are denoted by their position in the score, starting at 1:
+	parts are numbered in the score order and measures are numbered in the part order
+	(the measure \e number attribute is not used).
+	A null last index denotes the end of the score or of the part.
+*/
+class EXP scorerange
+{
+	public:
+		int	fFirstPart, fLastPart;
+		int	fFirstMeasure, fLastMeasure;
+
+				 scorerange(int firstPart=1, int lastPart=0, int firstMeasure=1, int lastMeasure=0)
+					: fFirstPart(firstPart), fLastPart(lastPart), fFirstMeasure(firstMeasure), fLastMeasure(lastMeasure) {}
+		virtual ~scorerange() {}
+
+		bool	all () const					{ return allParts() && allMeasures(); }
+		bool	allParts () const				{ return (fFirstPart <= 1) && (fLastPart == 0); }
+		bool	allMeasures () const			{ return (fFirstMeasure <= 1) && (fLastMeasure == 0); }
+		bool	beforePart (int index) const	{ return index < fFirstPart; }
+		bool	afterPart (int index) const		{ return fLastPart && (index > fLastPart); }
+		bool	beforeMeasure (int index) const	{ return index < fFirstMeasure; }
+		bool	afterMeasure (int index) const	{ return fLastMeasure && (index > fLastMeasure); }
+};
+
+//______________________________________________________________________________
+/*!
+\brief Collects the attributes state of a sequence of measures.
+
+	The attributes elements of the measures (divisions, key, time, staves, clef,
+	transpose...) are collected so that the state in effect at the end of the sequence
+	can be restored using a single attributes element. It is typically used to restore
+	the attributes state at the beginning of a measures range.
+*/
+class EXP attributescollector
+{
+	typedef std::pair<int, std::string> key;	// an element type and its 'number' attribute
+	std::map<key, Sxmlelement>	fState;
+
+	public:
+				 attributescollector() {}
+		virtual ~attributescollector() {}
+
+		//! collects the attributes of a measure
+		void		add (const Sxmlelement& measure);
+		/*! \brief gives an attributes element that reflects the collected state
+			\param next an optional measure that follows the collected measures: the state 
+			redefined at the beginning of this measure is omitted.
+			\return an attributes element or null when there is no state to restore
+		*/
+		Sxmlelement	attributes (const Sxmlelement& next=0) const;
+		void		clear ()		{ fState.clear(); }
+		bool		empty () const	{ return fState.empty(); }
+};
+
+//______________________________________________________________________________
+/*!
+\brief A tree browser that restricts the visit to a range of parts and measures.
+
+	Parts and measures out of the range are skipped without visiting their content.
+	When the range doesn't start at the first measure, the attributes state in
+	effect at the beginning of the range is visited as if it was included in the
+	first measure of the range.
+*/
+class EXP range_xml_tree_browser : public xml_tree_browser
+{
+	scorerange	fRange;
+	int			fPartIndex;
+
+	protected:
+		virtual void browsePart (xmlelement& part);
+		virtual bool intercept (xmlelement& t);
+
+	public:
+				 range_xml_tree_browser(basevisitor* v, const scorerange& range) : xml_tree_browser(v), fRange(range), fPartIndex(0) {}
+		virtual ~range_xml_tree_browser() {}
+};
+
+/*! @} */
+
+}
+
+#endif
@@ -0,0 +1,130 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __static_tree_browser__
+#define __static_tree_browser__
+
+#include <type_traits>
+#include <utility>
+
+#include "elementslist.h"
+#include "typedefs.h"
+#include "visitor.h"
+#include "xml_tree_browser.h"
+
+namespace MusicXML2
+{
+
+/*!
+\addtogroup MusicXML
+@{
+*/
+
+template <int n> struct dispatchrank : dispatchrank<n-1> {};		// orders the handlers overloads
+template <> struct dispatchrank<0> {};
+
+//______________________________________________________________________________
+/*!
+\brief Dispatches the elements to a visitor whose type is known at compile time.
+
+	The dispatch is a switch on the element type: the dynamic casts made by
+	xmlelement::acceptIn are avoided and the handlers may be inlined.
+	For an element of type S_xxx, the handler is selected in order:
+	- visitStart(S_xxx&) of the visitor<S_xxx> base, when \c V derives from it
+	(the handler is virtual, the semantic is the same than with acceptIn)
+	- a visitStart(S_xxx&) member of \c V, which needs not to be virtual
+	- the same for the generic Sxmlelement handlers
+	Visit end uses the same rules with visitEnd.
+	Note that the handlers are selected from the static type \c V.
+*/
+template <typename V> class static_dispatch
+{
+	template <int n> using rank = dispatchrank<n>;
+
+	template <int k, typename U> static typename std::enable_if<std::is_base_of<visitor<SMARTP<musicxml<k> > >, U>::value>::type
+		start (U& v, xmlelement& e, rank<4>)	{ SMARTP<musicxml<k> > s(static_cast<musicxml<k>*>(&e)); static_cast<visitor<SMARTP<musicxml<k> > >&>(v).visitStart (s); }
+	template <int k, typename U> static auto start (U& v, xmlelement& e, rank<3>) -> decltype (v.visitStart (std::declval<SMARTP<musicxml<k> >&>()))
+												{ SMARTP<musicxml<k> > s(static_cast<musicxml<k>*>(&e)); v.visitStart (s); }
+	template <int k, typename U> static void start (U& v, xmlelement& e, rank<2>)	{ start (v, e, rank<2>()); }
+
+	template <int k, typename U> static typename std::enable_if<std::is_base_of<visitor<SMARTP<musicxml<k> > >, U>::value>::type
+		end (U& v, xmlelement& e, rank<4>)		{ SMARTP<musicxml<k> > s(static_cast<musicxml<k>*>(&e)); static_cast<visitor<SMARTP<musicxml<k> > >&>(v).visitEnd (s); }
+	template <int k, typename U> static auto end (U& v, xmlelement& e, rank<3>) -> decltype (v.visitEnd (std::declval<SMARTP<musicxml<k> >&>()))
+												{ SMARTP<musicxml<k> > s(static_cast<musicxml<k>*>(&e)); v.visitEnd (s); }
+	template <int k, typename U> static void end (U& v, xmlelement& e, rank<2>)		{ end (v, e, rank<2>()); }
+
+	// the generic handlers
+	template <typename U> static typename std::enable_if<std::is_base_of<visitor<Sxmlelement>, U>::value>::type
+		start (U& v, xmlelement& e, rank<2>)	{ Sxmlelement s(&e); static_cast<visitor<Sxmlelement>&>(v).visitStart (s); }
+	template <typename U> static auto start (U& v, xmlelement& e, rank<1>) -> decltype (v.visitStart (std::declval<Sxmlelement&>()))
+												{ Sxmlelement s(&e); v.visitStart (s); }
+	template <typename U> static void start (U&, xmlelement&, rank<0>)	{}
+
+	template <typename U> static typename std::enable_if<std::is_base_of<visitor<Sxmlelement>, U>::value>::type
+		end (U& v, xmlelement& e, rank<2>)		{ Sxmlelement s(&e); static_cast<visitor<Sxmlelement>&>(v).visitEnd (s); }
+	template <typename U> static auto end (U& v, xmlelement& e, rank<1>) -> decltype (v.visitEnd (std::declval<Sxmlelement&>()))
+												{ Sxmlelement s(&e); v.visitEnd (s); }
+	template <typename U> static void end (U&, xmlelement&, rank<0>)	{}
+
+	public:
+		static void visitStart (V& v, xmlelement& e) {
+			switch (e.getType()) {
+#define MXML_START_CASE(type, S)	case type: start<type> (v, e, rank<4>()); break;
+				MUSICXML_ELEMENTS(MXML_START_CASE)
+#undef MXML_START_CASE
+				default: start (v, e, rank<2>());		// elements without type (e.g. cloned elements)
+			}
+		}
+		static void visitEnd (V& v, xmlelement& e) {
+			switch (e.getType()) {
+#define MXML_END_CASE(type, S)		case type: end<type> (v, e, rank<4>()); break;
+				MUSICXML_ELEMENTS(MXML_END_CASE)
+#undef MXML_END_CASE
+				default: end (v, e, rank<2>());
+			}
+		}
+};
+
+//______________________________________________________________________________
+/*!
+\brief A tree browser using a static dispatch to the visitor (see static_dispatch).
+
+	The traversal is the one of the browser \c B (xml_tree_browser by default),
+	which must take the visitor as first constructor argument. \c V needs not
+	to derive from basevisitor. The remaining
+	arguments are passed to the browser e.g.
+	\code
+		static_tree_browser<partsummary, range_xml_tree_browser> browser(&ps, range);
+	\endcode
+*/
+template <typename V, typename B=xml_tree_browser> class static_tree_browser : public B
+{
+	V&	fStaticVisitor;
+
+	static basevisitor* base (basevisitor* v)	{ return v; }
+	static basevisitor* base (...)				{ return 0; }		// the visitor is used by enter and leave only
+
+	protected:
+		virtual void enter (xmlelement& t)		{ static_dispatch<V>::visitStart (fStaticVisitor, t); }
+		virtual void leave (xmlelement& t)		{ static_dispatch<V>::visitEnd (fStaticVisitor, t); }
+
+	public:
+		template <typename... Args>
+				 static_tree_browser(V* v, Args&&... args) : B(base(v), std::forward<Args>(args)...), fStaticVisitor(*v) {}
+		virtual ~static_tree_browser() {}
+};
+
+/*! @} */
+
+}
+
+#endif
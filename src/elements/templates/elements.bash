@@ -33,22 +33,31 @@ case $3 in
     # to standard output
     cat $2/license.txt $2/factory.txt
 
-    # generate fMap entries for the markups found in the DTD
-   for a in $(cat $1 | cut -d' ' -f1 | sort -u)
+    # generate the kTypes entries for the markups found in the DTD
+    # (same order than the constants)
+    for a in $(cat $1 | cut -d' ' -f1 | sort -u)
     do
-      echo "	fMap[\"$a\"] 	= new newElementFunctor<$(kname $a)>;"
+      echo "	{ \"$a\", newElement<$(kname $a)> },"
     done
+    echo '};'
+    echo 'static_assert (sizeof(kTypes) / sizeof(kTypes[0]) == kEndElement, "elements types and names mismatch");'
     echo
 
-    # generate fType2Name entries for the markups found in the DTD
-    for a in $(cat $1 | cut -d' ' -f1 | sort -u)
+    # generate the kNames entries, sorted for a binary search
+    echo '// the elements types sorted by name'
+    echo 'static const nameentry kNames[] = {'
+    for a in $( (cat $1 | cut -d' ' -f1; echo comment; echo pi) | LC_ALL=C sort -u)
     do
-      echo "	fType2Name[$(kname $a)] 	= \"$a\";"
+      case $a in
+        comment) echo "	{ \"$a\", kComment },";;
+        pi) echo "	{ \"$a\", kProcessingInstruction },";;
+        *) echo "	{ \"$a\", $(kname $a) },";;
+      esac
     done
+    echo '};'
 
     # generate epiloque
-    echo '}'
-    echo '}'
+    cat $2/factoryend.txt
     ;;
 
 
@@ -86,8 +95,38 @@ case $3 in
     ;;
 
 
+  'list')
+    # copy license and the list macro preamble
+    # to standard output
+    cat $2/license.txt $2/elementslist.txt
+
+    # generate the macro entries for the markups found in the DTD
+    for a in $(cat $1 | cut -d' ' -f1 | sort -u)
+    do
+      echo "	M($(kname $a), S_$(echo $a | tr '-' '_')) \\"
+    done
+
+    # generate epiloque
+    echo
+    echo '#endif'
+    ;;
+
+
+  'info')
+    # copy license and the metadata preamble
+    # to standard output
+    cat $2/license.txt $2/elementsinfo.txt
+
+    # generate the metadata tables from the DTD ($4) and the schema ($5)
+    cat $1 | cut -d' ' -f1 | sort -u | awk -f $2/elementsinfo.awk -v dtd=$4 -v xsd=$5
+
+    # generate epiloque
+    cat $2/elementsinfoend.txt
+    ;;
+
+
   *)
-    echo "usage: elements.bash eltsfile templatedir [constants | map | types]"
+    echo "usage: elements.bash eltsfile templatedir [constants | map | types | list | info dtd xsd]"
     exit 1
     ;;
 esac  
@@ -0,0 +1,485 @@
+#
+# generates the elements metadata tables (see elementsinfo.h)
+#
+# usage: awk -f elementsinfo.awk -v dtd=partwise.dtd -v xsd=musicxml.xsd sortedeltsfile
+#   the DTD gives the content models and the attributes,
+#   the schema gives the type of the elements and attributes values.
+#   sortedeltsfile is the elements list in the order of the types constants.
+#
+
+function kname(name, k) {
+	k = "k_" name
+	gsub(/[-.:]/, "_", k)
+	return k
+}
+
+function sname(name, s) {
+	s = name
+	gsub(/[-.:]/, "_", s)
+	return s
+}
+
+#-----------------------------------------------------------------------
+# DTD reading
+#-----------------------------------------------------------------------
+# expands the parameter entities references
+function expand(str, i, name, n) {
+	for (n = 0; (n < 32) && match(str, /%[-a-zA-Z0-9_.:]+;/); n++) {
+		name = substr(str, RSTART + 1, RLENGTH - 2)
+		if (!(name in entity)) { print "warning: undefined entity " name > "/dev/stderr"; entity[name] = "" }
+		str = substr(str, 1, RSTART - 1) entity[name] substr(str, RSTART + RLENGTH)
+	}
+	return str
+}
+
+# gives the position of the declaration end, 0 when incomplete
+function declend(str, i, c, q) {
+	q = ""
+	for (i = 3; i <= length(str); i++) {
+		c = substr(str, i, 1)
+		if (q != "") { if (c == q) q = "" }
+		else if ((c == "\"") || (c == "'")) q = c
+		else if (c == ">") return i
+	}
+	return 0
+}
+
+function unquote(str) {
+	return substr(str, 2, length(str) - 2)
+}
+
+function declare(decl, kind, rest, name) {
+	gsub(/[ \t\n]+/, " ", decl)
+	match(decl, /^<!(ENTITY|ELEMENT|ATTLIST) /)
+	if (!RLENGTH) return
+	kind = substr(decl, 3, RLENGTH - 3)
+	rest = substr(decl, RLENGTH + 1, length(decl) - RLENGTH - 1)
+	if (kind == "ENTITY") {
+		if (rest !~ /^% /) return									# general entities are ignored
+		rest = substr(rest, 3)
+		name = rest; sub(/ .*/, "", name)
+		rest = substr(rest, length(name) + 2)
+		if (name in entity) return									# the first declaration is binding
+		if (rest ~ /^(PUBLIC|SYSTEM) /) {
+			match(rest, /["'][^"']*["'] *$/)
+			external[name] = unquote(substr(rest, RSTART))
+			sub(/ *$/, "", external[name])
+			sub(/["']$/, "", external[name])
+			entity[name] = ""
+		}
+		else {
+			sub(/ *$/, "", rest)
+			entity[name] = expand(unquote(rest))
+		}
+	}
+	else {
+		rest = expand(rest)
+		name = rest; sub(/^ */, "", name); sub(/ .*/, "", name); sub(/\(.*/, "", name)
+		rest = substr(rest, index(rest, name) + length(name))
+		if (kind == "ELEMENT") {
+			if (name in model) return
+			gsub(/ /, "", rest)
+			model[name] = rest
+		}
+		else attlist[name] = attlist[name] " " rest
+	}
+}
+
+# reads a DTD file, the declarations are processed in document order
+function readdtd(file, line, buff, n, name, cond, skip, dir) {
+	dir = file; if (!sub(/[^\/]*$/, "", dir)) dir = ""
+	buff = ""; skip = 0
+	while ((getline line < file) > 0) {
+		sub(/\r$/, "", line)
+		buff = buff "\n" line
+		while (1) {
+			sub(/^[ \t\n]+/, "", buff)
+			if (buff == "") break
+			if (skip) {											# ignored conditional section
+				if (!(n = index(buff, "]]>"))) { buff = ""; break }
+				buff = substr(buff, n + 3); skip = 0
+			}
+			else if (substr(buff, 1, 4) == "<!--") {
+				if (!(n = index(buff, "-->"))) break
+				buff = substr(buff, n + 3)
+			}
+			else if (substr(buff, 1, 3) == "<![") {
+				if (!match(buff, /^<!\[ *[^\[]*\[/)) break
+				cond = substr(buff, 4, RLENGTH - 4)
+				buff = substr(buff, RLENGTH + 1)
+				cond = expand(cond); gsub(/ /, "", cond)
+				skip = (cond == "IGNORE")
+			}
+			else if (substr(buff, 1, 3) == "]]>") buff = substr(buff, 4)
+			else if (substr(buff, 1, 2) == "<?") {
+				if (!(n = index(buff, "?>"))) break
+				buff = substr(buff, n + 2)
+			}
+			else if (substr(buff, 1, 2) == "<!") {
+				if (!(n = declend(buff))) break
+				declare(substr(buff, 1, n))
+				buff = substr(buff, n + 1)
+			}
+			else if (match(buff, /^%[-a-zA-Z0-9_.:]+;/)) {			# external entity reference
+				name = substr(buff, 2, RLENGTH - 2)
+				buff = substr(buff, RLENGTH + 1)
+				if (name in external) readdtd(dir external[name])
+			}
+			else buff = substr(buff, 2)
+		}
+	}
+	close(file)
+}
+
+#-----------------------------------------------------------------------
+# content models: Glushkov automaton
+# each element name occurrence in a model is a position; the sets of
+# positions are strings of space separated numbers
+#-----------------------------------------------------------------------
+function addset(set, items, n, i, a) {
+	if (set == "") set = " "
+	n = split(items, a, " ")
+	for (i = 1; i <= n; i++)
+		if (!index(set, " " a[i] " ")) set = set a[i] " "
+	return set
+}
+
+function addfollow(from, to, n, i, a) {
+	n = split(from, a, " ")
+	for (i = 1; i <= n; i++) follow[a[i]] = addset(follow[a[i]], to)
+}
+
+# parses a content particle at gPos in gModel, the result is in rFirst, rLast, rNull
+function particle(c, name, sep, first, last, null, ifirst, ilast, inull, op) {
+	c = substr(gModel, gPos, 1)
+	if (c == "(") {
+		gPos++
+		sep = ""
+		while (1) {
+			particle()
+			ifirst = rFirst; ilast = rLast; inull = rNull
+			if (sep == "") { first = " " ifirst; last = " " ilast; null = inull }
+			else if (sep == "|") { first = addset(first, ifirst); last = addset(last, ilast); null = null || inull }
+			else {
+				addfollow(last, ifirst)
+				if (null) first = addset(first, ifirst)
+				last = inull ? addset(last, ilast) : " " ilast
+				null = null && inull
+			}
+			c = substr(gModel, gPos++, 1)
+			if (c == ")") break
+			if ((c != ",") && (c != "|")) { print "warning: unexpected " c " in " gModel > "/dev/stderr"; break }
+			sep = c
+		}
+	}
+	else {
+		match(substr(gModel, gPos), /^[-a-zA-Z0-9_.:]+/)
+		name = substr(gModel, gPos, RLENGTH)
+		gPos += RLENGTH
+		symbol[++gCount] = name
+		first = last = " " gCount " "
+		null = 0
+	}
+	op = substr(gModel, gPos, 1)
+	if (op == "?") { null = 1; gPos++ }
+	else if (op == "*") { addfollow(last, first); null = 1; gPos++ }
+	else if (op == "+") { addfollow(last, first); gPos++ }
+	rFirst = first; rLast = last; rNull = null
+}
+
+# builds the automaton of an element content model
+function automaton(m, i) {
+	for (i in follow) delete follow[i]
+	for (i in symbol) delete symbol[i]
+	gModel = m; gPos = 1; gCount = 0
+	particle()
+	aFirst = rFirst; aLast = rLast; aNull = rNull
+}
+
+#-----------------------------------------------------------------------
+# the schema values types
+#-----------------------------------------------------------------------
+function attr(line, name, s) {
+	if (!match(line, name "=\"[^\"]*\"")) return ""
+	s = substr(line, RSTART + length(name) + 2, RLENGTH - length(name) - 3)
+	return s
+}
+
+function readxsd(file, line, depth, cur, tag, type, n, e) {
+	depth = 0; cur = ""
+	while ((getline line < file) > 0) {
+		if (match(line, /<xs:(simpleType|complexType)[ >]/)) {
+			if (!depth) {
+				cur = attr(line, "name"); if (cur == "") cur = "#anonymous"
+				if (line ~ /complexType/) complex[cur] = 1
+			}
+			if (line !~ /\/>/) depth++
+		}
+		else if (line ~ /<\/xs:(simpleType|complexType)>/) { if (!--depth) cur = "" }
+		if (line ~ /<xs:restriction / && !(cur in base)) base[cur] = attr(line, "base")
+		else if (line ~ /<xs:extension / && !(cur in base)) base[cur] = attr(line, "base")
+		else if (line ~ /<xs:enumeration /) enumerated[cur] = 1
+		else if (line ~ /<xs:(union|list) /) { if (!(cur in base)) base[cur] = "#union" }
+		if (line ~ /<xs:(sequence|choice|group|all)[ >]/) haselts[cur] = 1
+		if (line ~ /<xs:element /) {
+			e = attr(line, "name")
+			type = attr(line, "type")
+			if (type == "") type = "#elements"
+			if (!(e in etype)) etype[e] = type
+			else if (etype[e] != type) etype[e] = etype[e] " " type
+		}
+		if (line ~ /<xs:attribute /) {
+			e = attr(line, "name")
+			type = attr(line, "type")
+			if ((e == "") || (type == "")) continue
+			if (!(e in atype)) atype[e] = type
+			else if (atype[e] != type) atype[e] = atype[e] " " type
+		}
+	}
+	close(file)
+}
+
+function valuekind(type, n) {
+	for (n = 0; n < 16; n++) {
+		if (type ~ /^xs:(decimal|integer|int|long|short|byte|nonNegativeInteger|positiveInteger|nonPositiveInteger|negativeInteger|unsignedInt|unsignedLong|unsignedShort|unsignedByte|float|double)$/) return "kNumericValue"
+		if (type ~ /^xs:/) return "kStringValue"
+		if ((type == "#elements") || (type in haselts)) return "kNoValue"
+		if (type in enumerated) return "kEnumValue"
+		if (!(type in base)) return (type in complex) ? "kNoValue" : "kStringValue"
+		if (base[type] == "#union") return "kStringValue"
+		type = base[type]
+	}
+	return "kStringValue"
+}
+
+function elementvalue(e, n, i, a, kind, k) {
+	if (!(e in etype)) return "kStringValue"
+	n = split(etype[e], a, " ")
+	for (i = 1; i <= n; i++) {
+		k = valuekind(a[i])
+		if (i == 1) kind = k
+		else if (k != kind) return "kStringValue"
+	}
+	return kind
+}
+
+# the attributes are identified by their name: an attribute is numeric
+# when one of its declarations has a numeric type
+function numericattributes(name, n, nt, i, j, a, t) {
+	n = 0
+	for (name in atype) {
+		nt = split(atype[name], t, " ")
+		for (i = 1; i <= nt; i++) if (valuekind(t[i]) == "kNumericValue") break
+		if (i <= nt) a[++n] = name
+	}
+	for (i = 2; i <= n; i++) {
+		name = a[i]
+		for (j = i - 1; (j > 0) && (a[j] > name); j--) a[j+1] = a[j]
+		a[j+1] = name
+	}
+	print "// the numeric attributes names, sorted for a binary search"
+	print "static const char* kNumericAttributes[] = {"
+	for (i = 1; i <= n; i++) print "\t\"" a[i] "\","
+	print "};"
+	print "static const int kNumericAttributesCount = sizeof(kNumericAttributes) / sizeof(kNumericAttributes[0]);"
+	print ""
+}
+
+#-----------------------------------------------------------------------
+# generation
+#-----------------------------------------------------------------------
+# the children ranks: an element ranks after the elements that must precede it
+# i.e. that may be followed by it but that can't follow it
+function ranks(e, n, names, idx, i, j, k, a, na, b, nb, order, done, r, max) {
+	n = 0
+	for (i = 1; i <= gCount; i++)
+		if (!(symbol[i] in idx)) { idx[symbol[i]] = ++n; names[n] = symbol[i] }
+	for (i = 1; i <= n; i++) for (j = 1; j <= n; j++) reach[i, j] = 0
+	for (i = 1; i <= gCount; i++) {
+		nb = split(follow[i], b, " ")
+		for (j = 1; j <= nb; j++) reach[idx[symbol[i]], idx[symbol[b[j]]]] = 1
+	}
+	for (k = 1; k <= n; k++) for (i = 1; i <= n; i++) if (reach[i, k])
+		for (j = 1; j <= n; j++) if (reach[k, j]) reach[i, j] = 1
+	# the ranks are computed in the order of the count of predecessors
+	for (i = 1; i <= n; i++) {
+		order[i] = 0
+		for (j = 1; j <= n; j++) if (reach[j, i] && !reach[i, j]) order[i]++
+	}
+	for (k = 0; k < n; k++) for (i = 1; i <= n; i++) if (order[i] == k) {
+		max = 0
+		for (j = 1; j <= n; j++) if (reach[j, i] && !reach[i, j] && (rank[names[j]] > max)) max = rank[names[j]]
+		rank[names[i]] = max + 1
+	}
+	r = ""
+	for (i = 1; i <= n; i++) r = r names[i] " "
+	return r
+}
+
+function sortbytype(list, n, a, i, j, t) {
+	n = split(list, a, " ")
+	for (i = 2; i <= n; i++) {
+		t = a[i]
+		for (j = i - 1; (j > 0) && (type[a[j]] > type[t]); j--) a[j+1] = a[j]
+		a[j+1] = t
+	}
+	list = ""
+	for (i = 1; i <= n; i++) list = list a[i] " "
+	return list
+}
+
+# the content model automaton: the state 0 is the initial state, the state p is
+# reached after the element at position p. The DTD content models are deterministic
+# thus each state has at most one transition for an element type.
+function transitions(e, s, n, a, i, j, list, out, offsets, finals, ntrans, t) {
+	out = ""; offsets = ""; finals = ""; ntrans = 0
+	for (s = 0; s <= gCount; s++) {
+		list = (s == 0) ? aFirst : follow[s]
+		n = split(list, a, " ")
+		# transitions are sorted by element type
+		for (i = 2; i <= n; i++) {
+			t = a[i]
+			for (j = i - 1; (j > 0) && (type[symbol[a[j]]] > type[symbol[t]]); j--) a[j+1] = a[j]
+			a[j+1] = t
+		}
+		offsets = offsets ntrans ", "
+		for (i = 1; i <= n; i++) {
+			if ((i > 1) && (symbol[a[i]] == symbol[a[i-1]]))
+				print "warning: non deterministic content model for " e > "/dev/stderr"
+			out = out "\t{ " kname(symbol[a[i]]) ", " a[i] " },\n"
+			ntrans++
+		}
+		finals = finals (((s == 0) ? aNull : index(aLast, " " s " ") > 0) ? "1" : "0") ((s < gCount) ? ", " : "")
+	}
+	print "static const transition kTransitions_" sname(e) "[] = {"
+	printf "%s", out
+	print "};"
+	print "static const int kStates_" sname(e) "[] = { " offsets ntrans " };"
+	print "static const char kFinals_" sname(e) "[] = { " finals " };"
+	print "static const contentmodel kModel_" sname(e) " = { " (gCount + 1) ", kStates_" sname(e) ", kTransitions_" sname(e) ", kFinals_" sname(e) " };"
+}
+
+# the attributes list
+function attributes(e, list, tokens, n, i, c, q, depth, tok, name, atype, values, flags, out) {
+	list = attlist[e]
+	n = 0; tok = ""; q = ""; depth = 0
+	for (i = 1; i <= length(list); i++) {
+		c = substr(list, i, 1)
+		if (q != "") { tok = tok c; if (c == q) q = "" }
+		else if ((c == "\"") || (c == "'")) { q = c; tok = tok c }
+		else if (c == "(") { depth++; tok = tok c }
+		else if (c == ")") { depth--; tok = tok c }
+		else if ((c == " ") && !depth) { if (tok != "") tokens[++n] = tok; tok = "" }
+		else if ((c != " ") || !depth) tok = tok c
+	}
+	if (tok != "") tokens[++n] = tok
+	out = ""
+	for (i = 1; i <= n; ) {
+		name = tokens[i++]
+		atype = tokens[i++]
+		if (atype == "NOTATION") atype = tokens[i++]
+		flags = 0
+		if (tokens[i] == "#REQUIRED") { flags = "kRequiredAttribute"; i++ }
+		else if (tokens[i] == "#IMPLIED") i++
+		else { if (tokens[i] == "#FIXED") i++; i++ }
+		values = "0"
+		if (atype ~ /^\(/) {
+			values = substr(atype, 2, length(atype) - 2)
+			values = "\"" values "\""
+		}
+		if (!(name in seen)) {
+			seen[name] = 1
+			out = out "\t{ \"" name "\", " values ", " flags " },\n"
+		}
+	}
+	return out
+}
+
+BEGIN {
+	readdtd(dtd)
+	readxsd(xsd)
+}
+
+{
+	elt[++count] = $1
+	type[$1] = count + 2			# after kNoElement, kComment and kProcessingInstruction
+}
+
+END {
+	words = int((count + 3 + 31) / 32)
+	print "// the count of 32 bits words in a children set"
+	print "#define kChildrenWords\t" words
+	print "static_assert (kChildrenWords == (kEndElement + 31) / 32, \"unexpected elements count\");"
+	print ""
+	for (i = 1; i <= count; i++) {
+		e = elt[i]
+		if (!(e in model)) { content[e] = "kUndeclared"; continue }
+		m = model[e]
+		if (m == "EMPTY") content[e] = "kEmptyContent"
+		else if (m == "ANY") content[e] = "kAnyContent"
+		else if (m ~ /^\(#PCDATA\)\*?$/) content[e] = "kTextContent"
+		else if (m ~ /^\(#PCDATA\|/) content[e] = "kMixedContent"
+		else content[e] = "kElementsContent"
+
+		if (content[e] == "kElementsContent") {
+			automaton(m)
+			for (n in rank) delete rank[n]
+			names = sortbytype(ranks(e))
+			nn = split(names, a, " ")
+			# the xmlelement children types mask has a bit for each allowed child
+			if (nn > 63) print "warning: more than 63 children types allowed in " e > "/dev/stderr"
+			for (j = 0; j < words; j++) bits[j] = 0
+			for (j = 0; j < count + 3; j++) dense[j] = 0
+			for (j = 1; j <= nn; j++) {
+				if (!(a[j] in type)) { print "warning: unknown element " a[j] " in " e > "/dev/stderr"; continue }
+				t = type[a[j]]
+				w = int(t / 32)
+				bits[w] += 2 ^ (t % 32)
+				dense[t] = rank[a[j]]
+			}
+			print "static const unsigned kChildren_" sname(e) "[] = {"
+			line = "\t"
+			for (j = 0; j < words; j++) line = line sprintf("0x%08x", bits[j]) ((j < words - 1) ? ", " : "")
+			print line
+			print "};"
+			print "static const unsigned char kRanks_" sname(e) "[kEndElement] = {"
+			for (j = 0; j < count + 3; j += 32) {
+				line = "\t"
+				for (k = j; (k < j + 32) && (k < count + 3); k++) line = line dense[k] ((k < count + 2) ? "," : "")
+				print line
+			}
+			print "};"
+			transitions(e)
+			children[e] = 1
+		}
+		for (n in seen) delete seen[n]
+		out = attributes(e)
+		if (out != "") {
+			print "static const attributeinfo kAttributes_" sname(e) "[] = {"
+			printf "%s", out
+			print "\t{ 0, 0, 0 }"
+			print "};"
+			attrs[e] = 1
+		}
+		if ((e in children) || (e in attrs)) print ""
+	}
+	numericattributes()
+
+	print "// the elements metadata, indexed by type"
+	print "static const elementinfo kInfos[] = {"
+	print "\t{ \"\", kUndeclared, kNoValue, 0, 0, 0, 0 },"
+	print "\t{ \"comment\", kUndeclared, kStringValue, 0, 0, 0, 0 },"
+	print "\t{ \"pi\", kUndeclared, kStringValue, 0, 0, 0, 0 },"
+	for (i = 1; i <= count; i++) {
+		e = elt[i]
+		c = content[e]
+		v = "kNoValue"
+		if ((c == "kTextContent") || (c == "kMixedContent")) v = elementvalue(e)
+		else if (c == "kUndeclared") v = elementvalue(e)
+		ch = (e in children) ? "kChildren_" sname(e) ", kRanks_" sname(e) ", &kModel_" sname(e) : "0, 0, 0"
+		at = (e in attrs) ? "kAttributes_" sname(e) : "0"
+		print "\t{ \"" e "\", " c ", " v ", " ch ", " at " },"
+	}
+	print "};"
+	print "static_assert (sizeof(kInfos) / sizeof(kInfos[0]) == kEndElement, \"elements types and metadata mismatch\");"
+}
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <vector>
+#include "elements.h"
 #include "unrolled_xml_tree_browser.h"
 
 using namespace std;
@@ -27,21 +28,37 @@ void unrolled_xml_tree_browser::browse (xmlelement& t)				{ t.acceptIn(*this); }
 
 void unrolled_xml_tree_browser::forwardBrowse( xmlelement& elt )
 {
-	enter(elt);
-	ctree<xmlelement>::literator iter;
-	for (iter = elt.lbegin(); iter != elt.lend(); iter++)
-		forwardBrowse(**iter);
-	leave(elt);
+	xml_tree_walker walker(elt);
+	for (xml_tree_walker::event e = walker.next(); e.node; e = walker.next()) {
+		if (e.phase == xml_tree_walker::kEnter) enter(*e.node);
+		else leave(*e.node);
+	}
+}
+
+// the elements that have a specific visit method (see the class declaration)
+static bool controlElement (int type)
+{
+	return (type == k_part) || (type == k_measure) || (type == k_ending) || (type == k_repeat) || (type == k_sound);
 }
 
 void unrolled_xml_tree_browser::visitStart( Sxmlelement& elt)
 {
-	bool forward = fForward;
-	if (forward) enter(*elt);
-	ctree<xmlelement>::literator iter;
-	for (iter = elt->lbegin(); iter != elt->lend(); iter++)
-		browse(**iter);
-	if (forward) leave(*elt);
+	vector<bool> forward;		// the forward state of the entered elements
+	xml_tree_walker walker(*elt);
+	for (xml_tree_walker::event e = walker.next(); e.node; e = walker.next()) {
+		if (e.phase == xml_tree_walker::kLeave) {
+			if (forward.back()) leave(*e.node);
+			forward.pop_back();
+		}
+		else if ((e.node != elt) && controlElement (e.node->getType())) {
+			browse(*e.node);
+			walker.skip();
+		}
+		else {
+			forward.push_back (fForward);
+			if (fForward) enter(*e.node);
+		}
+	}
 }
 
 //______________________________________________________________________________
@@ -54,10 +71,13 @@ void unrolled_xml_tree_browser::visitStart( S_ending& elt)
 	if (type == "start") {
 		// it is assumed that ending starting just after a repeat bar denotes a continuation
 		// of the previous repeat, thus it is ignored whatever value it has
+		// and the round of the previous repeat is continued
 		if (fSectionIndex > 1) fExpectedRound.current = number;
+		else fRound.current = fLastRound;
 	}
 	else if ((type == "stop") || (type == "discontinue")) {
 		fExpectedRound.next = kNoInstruction;			// no specific round expected at next iteration
+		fRound.next = 1;								// and a continued round ends with the ending
 	}
 }
 
@@ -77,14 +97,17 @@ void unrolled_xml_tree_browser::visitStart( S_repeat& elt)
 			fExpectedRound.next = fRound.current + 1;	// and adjust the corresponding round for next iteration
 		}
 		else {											// jump out of the repeat section:
+			fLastRound = fRound.current;				// stores the last round for a continuation ending
+			fForwardRepeat = fNextIterator;				// a next backward repeat without forward repeat jumps after the section
 			fRound.next = 1;							// next round will be 1
 			fExpectedRound.next = kNoInstruction;		// no specific round expected at next iteration
 			fSectionIndex = 0;							// and starts a new section
 		}
 	}
 	else if (direction == "forward") {
-		// current measure iterator will be stored in the fForwardRepeat location
-		fStoreIterator = &fForwardRepeat;
+		// the current measure is the forward repeat location: it is stored at once
+		// since a backward repeat in the same measure jumps to it
+		fForwardRepeat = fCurrentIterator;
 	}
 }
 
@@ -113,14 +136,33 @@ void unrolled_xml_tree_browser::visitStart( S_measure& elt)
 	if (fJump.current != kToCoda) {		// check that we're not looking for the coda sign
 										// and check that we're playing the correct round
 		if ((fExpectedRound.current == kNoInstruction) || (fRound.current == fExpectedRound.current))
-			forwardBrowse (*elt);
+			forwardMeasure (*elt);
 	}
 }
 
+//______________________________________________________________________________
+// the attributes state of the measures skipped before a range is forwarded
+// as if it was included in the first measure of the range
+void unrolled_xml_tree_browser::forwardMeasure( xmlelement& elt )
+{
+	if (fPendingAttributes) {
+		Sxmlelement attributes = fPendingAttributes;
+		fPendingAttributes = Sxmlelement();
+		enter(elt);
+		forwardBrowse(*attributes);
+		ctree<xmlelement>::literator iter;
+		for (iter = elt.lbegin(); iter != elt.lend(); iter++)
+			forwardBrowse(**iter);
+		leave(elt);
+	}
+	else forwardBrowse (elt);
+}
+
 //______________________________________________________________________________
 void unrolled_xml_tree_browser::reset()
 {
 	fRepeatMap.clear();								// clear the map of backward repeat measures
+	fLastRound = 1;
 	fSectionIndex = 0;
 	fRound.current = 1;	fRound.next = kNoInstruction;	// this is the first time we visit the part
 	fExpectedRound.current = kNoInstruction;			// and there is no specific instruction for the round
@@ -142,12 +184,32 @@ void unrolled_xml_tree_browser::reset()
 //
 void unrolled_xml_tree_browser::visitStart( S_part& elt)
 {
+	fPartIndex++;
+	if (fRange.beforePart(fPartIndex) || fRange.afterPart(fPartIndex)) return;
+
 	// first initializes the iterators used to broswe the tree
-	// segno and coda are initialized to the end of the measures list
 	fEndIterator = elt->elements().end();
+	ctree<xmlelement>::literator iter = elt->elements().begin();
+	fPendingAttributes = Sxmlelement();
+	if (!fRange.allMeasures()) {
+		// skip the measures before the range and restrict the end location to the range end
+		attributescollector skipped;
+		int index = 0;
+		for (; iter != fEndIterator; iter++) {
+			if ((*iter)->getType() != k_measure) continue;
+			if (!fRange.beforeMeasure(++index)) break;
+			skipped.add (*iter);
+		}
+		if (iter != fEndIterator) fPendingAttributes = skipped.attributes(*iter);
+		ctree<xmlelement>::literator end = iter;
+		for (; end != fEndIterator; end++) {
+			if (((*end)->getType() == k_measure) && fRange.afterMeasure(index++)) break;
+		}
+		fEndIterator = end;
+	}
+	// segno and coda are initialized to the end of the measures list
 	fSegnoIterator= fCodaIterator = fEndIterator;
 	// stores the first measures and makes a provision for the forward repeat location
-	ctree<xmlelement>::literator iter = elt->elements().begin();
 	fFirstMeasure = fForwardRepeat = iter;
 	fStoreIterator = 0;
 	fStoreDelay = 0;
@@ -158,7 +220,7 @@ void unrolled_xml_tree_browser::visitStart( S_part& elt)
 	fForward = false;
 	// while we're not at the end location (elements().end() is checked for safety reasons only)
 	while ((iter != fEndIterator) && (iter != elt->elements().end())) {
-		fNextIterator = iter;
+		fCurrentIterator = fNextIterator = iter;
 		fNextIterator++;				// default value for next iterator is the next measure
 		browse(**iter);					// browse the measure
 		if (fStoreIterator) {			// check if we need to store the current iterator
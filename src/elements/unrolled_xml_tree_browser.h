@@ -17,6 +17,7 @@
 #include "visitor.h"
 #include "xml.h"
 #include "browser.h"
+#include "range_xml_tree_browser.h"
 #include "typedefs.h"
 
 namespace MusicXML2 
@@ -57,7 +58,7 @@ class EXP unrolled_xml_tree_browser : public browser<xmlelement>,
 {
 	private:
 		typedef struct { int current; int next; } state;
-		std::map<S_repeat,int>	fRepeatMap;			// used to avoid loops in miswritten scores
+		std::map<S_repeat,int>	fRepeatMap;			// the count of each backward repeat, used to avoid loops in miswritten scores
 
 		enum { kUndefined=-1, kNoInstruction=0 };
 		enum { kNoJump,  kDaCapo, kDalSegno, kToCoda };
@@ -66,9 +67,14 @@ class EXP unrolled_xml_tree_browser : public browser<xmlelement>,
 		state	fJump;			///< indicates the current and next jump state
 		state	fRound;			///< the current time we're visiting a section
 		state	fExpectedRound;	///< the expected time to visit a section (0 when no instruction)
+		int		fLastRound;		///< the last round of the previous repeat section
 		int		fSectionIndex;	///< the current measure number within the current section
-		
+		scorerange	fRange;			///< the range of parts and measures to visit
+		int		fPartIndex;		///< the current part index
+		Sxmlelement	fPendingAttributes;	///< the attributes state to be visited with the first measure of the range
+
 		void reset();
+		void forwardMeasure (xmlelement& measure);
 
 	protected:
 		basevisitor*	fVisitor;
@@ -76,6 +82,7 @@ class EXP unrolled_xml_tree_browser : public browser<xmlelement>,
 		ctree<xmlelement>::literator	fFirstMeasure;		///< the first measure iterator
 		ctree<xmlelement>::literator	fForwardRepeat;		///< the forward repeat location
 		ctree<xmlelement>::literator	fEndIterator;		///< indicates the end of to visit
+		ctree<xmlelement>::literator	fCurrentIterator;	///< the measure currently visited
 		ctree<xmlelement>::literator	fNextIterator;		///< indicates the next elt to visit
 		ctree<xmlelement>::literator	fSegnoIterator;		///< the segno location
 		ctree<xmlelement>::literator	fCodaIterator;		///< the segno location
@@ -83,9 +90,16 @@ class EXP unrolled_xml_tree_browser : public browser<xmlelement>,
 		int	fStoreDelay;		///< an iterations counter for delayed store
 
 	public:
-				 unrolled_xml_tree_browser(basevisitor* v) : fForward(true), fVisitor(v) {}
+				 unrolled_xml_tree_browser(basevisitor* v) : fForward(true), fPartIndex(0), fVisitor(v) { fJump.current = fJump.next = kNoJump; }
+				 unrolled_xml_tree_browser(basevisitor* v, const scorerange& range) : fForward(true), fRange(range), fPartIndex(0), fVisitor(v) { fJump.current = fJump.next = kNoJump; }
 		virtual ~unrolled_xml_tree_browser() {}
 
+		/*! \brief restricts the visit to a range of parts and measures
+		
+			Repeats and jumps are interpreted within the range only.
+		*/
+		void	setRange (const scorerange& range)		{ fRange = range; }
+
 		virtual void visitStart( Sxmlelement& elt);
 		virtual void visitStart( S_measure& elt);
 		virtual void visitStart( S_ending& elt);
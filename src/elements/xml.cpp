@@ -11,10 +11,14 @@
 */
 
 #include <stdlib.h>
+#include <string.h>
 #include <string>
-#include <sstream>
+#include <utility>
 #include <iostream>
 
+#include "factory.h"
+#include "elementsinfo.h"
+#include "numbers.h"
 #include "xml.h"
 #include "visitor.h"
 
@@ -23,81 +27,217 @@ using namespace std;
 namespace MusicXML2 
 {
 
+//______________________________________________________________________________
+// xmlnumber
+//______________________________________________________________________________
+// the text is an integer when parseInt stops on a char that can't continue a float
+// (parseFloat also parses fractions, exponents, hexadecimal numbers, inf and nan)
+void xmlnumber::set (const string& text)
+{
+	const char* str = text.c_str();
+	long value;
+	bool overflow;
+	const char* end = parseInt (str, value, &overflow);
+	const char* next = (end != str) ? end : str + strspn (str, " \t\n\v\f\r");
+	if (!overflow && !(*next && strchr (".eExXiInN+-", *next))) {
+		fValue.fLong = value;
+		fKind = kInteger;
+	}
+	else {
+		double d;
+		parseFloat (str, d);
+		fValue.fFloat = (float)d;
+		fKind = kFloat;
+	}
+}
+
 //______________________________________________________________________________
 // xmlattribute
 //______________________________________________________________________________
 Sxmlattribute xmlattribute::create() { xmlattribute * o = new xmlattribute; assert(o!=0); return o; }
 
+Sxmlattribute xmlattribute::clone() const
+{
+	xmlattribute * o = new xmlattribute;
+	assert(o!=0);
+	o->fName = fName;
+	o->fValue = fValue;
+	o->fNumber = fNumber;
+	return o;
+}
+
 //______________________________________________________________________________
-void xmlattribute::setName (const string& name) 		{ fName = name; }
-void xmlattribute::setValue (const string& value) 		{ fValue = value; }
+// the element hash depends on its attributes
+void xmlattribute::modified ()							{ assert (!shared()); if (fElement) fElement->touch(); }
+void xmlattribute::setName (const string& name) 		{ fName = name; modified(); }
+void xmlattribute::setValue (const string& value) 		{ fValue = value; setNumber(); modified(); }
+
+// only the numeric attributes values are converted when they are set
+void xmlattribute::setNumber ()
+{
+	if (attributeinfo::numeric (fName.c_str())) fNumber.set (fValue);
+	else fNumber.clear();
+}
 
 //______________________________________________________________________________
 void xmlattribute::setValue (long value)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	char buff[kMaxNumberSize];
+	fValue.assign (buff, formatInt (value, buff));
+	fNumber.set (value);
+	modified();
 }
 
 //______________________________________________________________________________
 void xmlattribute::setValue (int value)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	char buff[kMaxNumberSize];
+	fValue.assign (buff, formatInt (value, buff));
+	fNumber.set (long(value));
+	modified();
 }
 
 //______________________________________________________________________________
 void xmlattribute::setValue (float value)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	char buff[kMaxNumberSize];
+	fValue.assign (buff, formatFloat (value, buff));
+	setNumber();
+	modified();
 }
 
-xmlattribute::operator int () const		{ return atoi(fValue.c_str()); }
-xmlattribute::operator long () const	{ return atol(fValue.c_str()); }
-xmlattribute::operator float () const	{ return (float)atof(fValue.c_str()); }
-
 //______________________________________________________________________________
 // xmlelement
 //______________________________________________________________________________
 Sxmlelement xmlelement::create(int lineno)			{ xmlelement * o = new xmlelement(lineno); assert(o!=0); return o; }
 void xmlelement::setValue (int value)				{ setValue((long)value); }
-void xmlelement::setValue (const string& value) 	{ fValue = value; }
-void xmlelement::setName (const string& name) 		{ fName = name; }
+void xmlelement::setValue (const string& value) 	{ fValue = value; setNumber(); touch(); }
+void xmlelement::setName (const string& name) 		{ fName = name; touch(); }
+
+// only the numeric elements values are converted when they are set
+void xmlelement::setNumber ()
+{
+	if (elementinfo::get (fType).value == kNumericValue) fNumber.set (fValue);
+	else fNumber.clear();
+}
+
+//______________________________________________________________________________
+// the attributes that may survive the element don't refer to it anymore
+xmlelement::~xmlelement()
+{
+	for (vector<Sxmlattribute>::const_iterator i = fAttributes.begin(); i != fAttributes.end(); i++)
+		(*i)->fElement = 0;
+}
+
 //______________________________________________________________________________
 void xmlelement::setValue (long value)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	char buff[kMaxNumberSize];
+	fValue.assign (buff, formatInt (value, buff));
+	fNumber.set (value);
+	touch();
 }
 
 //______________________________________________________________________________
 void xmlelement::setValue (unsigned long value)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	char buff[kMaxNumberSize];
+	fValue.assign (buff, formatUInt (value, buff));
+	setNumber();
+	touch();
 }
 
 //______________________________________________________________________________
 void xmlelement::setValue (float value)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	char buff[kMaxNumberSize];
+	fValue.assign (buff, formatFloat (value, buff));
+	setNumber();
+	touch();
 }
 
 //______________________________________________________________________________
 long xmlelement::add (const Sxmlattribute& attr)
 { 
+	attr->fElement = this;
 	fAttributes.push_back(attr);
+	touch();
+	return long(fAttributes.size()-1);
+}
+
+long xmlelement::add (Sxmlattribute&& attr)
+{ 
+	attr->fElement = this;
+	fAttributes.push_back(std::move(attr));
+	touch();
 	return long(fAttributes.size()-1);
 }
 
+//______________________________________________________________________________
+// the typed elements are created by the factory, the values are copied as is
+// (the numeric values are not parsed again)
+Sxmlelement xmlelement::copy () const
+{
+	Sxmlelement elt = fType ? factory::instance().create (fType) : xmlelement::create (fInputLineNumber);
+	elt->fInputLineNumber = fInputLineNumber;
+	elt->fName = fName;
+	elt->fValue = fValue;
+	elt->fNumber = fNumber;
+	elt->fAttributes.reserve (fAttributes.size());
+	for (vector<Sxmlattribute>::const_iterator i = fAttributes.begin(); i != fAttributes.end(); i++) {
+		Sxmlattribute attr = (*i)->clone();
+		attr->fElement = elt;
+		elt->fAttributes.push_back (attr);
+	}
+	return elt;
+}
+
+//______________________________________________________________________________
+// copies the sub elements of a source element when they are first accessed
+class cloneloader : public ctreeloader<xmlelement>
+{
+	Sxmlelement fSource;
+	protected:
+				 cloneloader(const Sxmlelement& source) : fSource(source) {}
+		virtual ~cloneloader() {}
+	public:
+		static SMARTP<cloneloader> create (const Sxmlelement& source)	{ cloneloader* o = new cloneloader(source); assert(o!=0); return o; }
+
+		void load (xmlelement& node) {
+			const xmlelement::branchs& elts = fSource->elements();
+			node.elements().reserve (elts.size());
+			for (xmlelement::branchs::const_iterator i = elts.begin(); i != elts.end(); i++)
+				node.push ((*i)->clone (true));
+		}
+};
+
+//______________________________________________________________________________
+Sxmlelement xmlelement::clone (bool shared) const
+{
+	Sxmlelement root = copy();
+	if (shared && frozen()) {
+		if (!loaded() || size())
+			root->setLoader (cloneloader::create (const_cast<xmlelement*>(this)));
+		return root;
+	}
+	// the subtree is copied without recursion, using a stack of the elements to be filled
+	vector<pair<const xmlelement*, xmlelement*> > stack;
+	stack.push_back (make_pair (this, (xmlelement*)root));
+	while (stack.size()) {
+		const xmlelement* src = stack.back().first;
+		xmlelement* dst = stack.back().second;
+		stack.pop_back();
+		const branchs& elts = src->elements();
+		dst->elements().reserve (elts.size());
+		for (branchs::const_iterator i = elts.begin(); i != elts.end(); i++) {
+			Sxmlelement elt = (*i)->copy();
+			dst->push (elt);
+			if ((*i)->size()) stack.push_back (make_pair ((const xmlelement*)(*i), (xmlelement*)elt));
+		}
+	}
+	return root;
+}
+
 //______________________________________________________________________________
 void xmlelement::acceptIn(basevisitor& v) {
 	visitor<Sxmlelement>* p = dynamic_cast<visitor<Sxmlelement>*>(&v);
@@ -138,27 +278,23 @@ const string xmlelement::getAttributeValue (const string& attrname) const
 long xmlelement::getAttributeLongValue (const string& attrname, long defaultvalue) const
 {
 	Sxmlattribute attribute = getAttribute(attrname);
-	return attribute ? atol(attribute->getValue().c_str()) : defaultvalue;
+	return attribute ? long(*attribute) : defaultvalue;
 }
 
 //______________________________________________________________________________
 int xmlelement::getAttributeIntValue (const string& attrname, int defaultvalue) const
 {
 	Sxmlattribute attribute = getAttribute(attrname);
-	return attribute ? atoi(attribute->getValue().c_str()) : defaultvalue;
+	return attribute ? int(*attribute) : defaultvalue;
 }
 
 //______________________________________________________________________________
 float xmlelement::getAttributeFloatValue (const string& attrname, float defaultvalue) const
 {
 	Sxmlattribute attribute = getAttribute(attrname);
-	return attribute ? (float)atof(attribute->getValue().c_str()) : defaultvalue;
+	return attribute ? float(*attribute) : defaultvalue;
 }
 
-xmlelement::operator int () const	{ return atoi(fValue.c_str()); }
-xmlelement::operator long () const	{ return atol(fValue.c_str()); }
-xmlelement::operator float () const { return (float)atof(fValue.c_str()); }
-
 //______________________________________________________________________________
 bool xmlelement::operator ==(const xmlelement& elt) const
 {
@@ -181,12 +317,186 @@ bool xmlelement::operator ==(const xmlelement& elt) const
 }
 
 //______________________________________________________________________________
-ctree<xmlelement>::iterator xmlelement::find(int type)
+// the hashes are combined using the boost hash_combine scheme, the strings are
+// hashed using FNV-1a and the result is finalized using the splitmix64 mixer
+static inline unsigned long long combine (unsigned long long h, unsigned long long v)
+{
+	return h ^ (v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+}
+
+static unsigned long long hashString (const string& str)
+{
+	unsigned long long h = 0xcbf29ce484222325ULL;
+	for (size_t i = 0; i < str.size(); i++) {
+		h ^= (unsigned char)str[i];
+		h *= 0x100000001b3ULL;
+	}
+	return h;
+}
+
+static inline unsigned long long finalize (unsigned long long h)
+{
+	h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+	return h ^ (h >> 31);
+}
+
+// a valid hash implies that the sub elements hashes are valid: the ancestors
+// of an element whose hash is not computed don't have a computed hash either
+unsigned long long xmlelement::hash () const
+{
+	unsigned long long h = fHash.load (std::memory_order_relaxed);
+	if (h) return h;
+	h = combine (fType, hashString (fName));
+	h = combine (h, hashString (fValue));
+	h = combine (h, fAttributes.size());
+	for (vector<Sxmlattribute>::const_iterator i = fAttributes.begin(); i != fAttributes.end(); i++) {
+		h = combine (h, hashString ((*i)->getName()));
+		h = combine (h, hashString ((*i)->getValue()));
+	}
+	const branchs& elts = elements();
+	h = combine (h, elts.size());
+	for (branchs::const_iterator i = elts.begin(); i != elts.end(); i++)
+		h = combine (h, (*i)->hash());
+	h = finalize (h);
+	if (!h) h = 1;
+	fHash.store (h, std::memory_order_relaxed);
+	return h;
+}
+
+void xmlelement::touch ()
+{
+	assert (!frozen());			// a frozen tree must not be modified
+	for (xmlelement* elt = this; elt && elt->fHash.load (std::memory_order_relaxed); elt = elt->getParent())
+		elt->fHash.store (0, std::memory_order_relaxed);
+}
+
+//______________________________________________________________________________
+// the children types allowed by the DTD have their own bit, given by their index in the
+// allowed children set (less than 64 of them, checked by the generator); the other types (comments,
+// processing instructions, invalid children) share the last bit. The children of the
+// elements without declared content (e.g. timewise elements) share the bits modulo 64.
+unsigned long long xmlelement::typeBit (int type, bool& own) const
+{
+	const elementinfo& info = elementinfo::get (fType);
+	if (info.children) {
+		int i = info.index (type);
+		own = (i >= 0) && (i < 63);
+		return 1ULL << (own ? i : 63);
+	}
+	own = false;
+	return 1ULL << (type & 63);
+}
+
+//______________________________________________________________________________
+// the child types are recomputed when the sub elements have been modified
+// since the last computation (see modified), a push updates them incrementally
+unsigned long long xmlelement::childTypes () const
+{
+	const branchs& elts = elements();
+	if (!fChildTypesValid) {
+		unsigned long long types = 0;
+		for (branchs::const_iterator i = elts.begin(); i != elts.end(); i++)
+			types |= typeBit ((*i)->getType());
+		fChildTypes = types;
+		fChildTypesValid = true;
+	}
+	return fChildTypes;
+}
+
+void xmlelement::push (const treePtr& t)
+{
+	bool uptodate = fChildTypesValid;
+	ctree<xmlelement>::push (t);
+	if (uptodate) {
+		fChildTypes |= typeBit (t->getType());
+		fChildTypesValid = true;
+	}
+}
+
+void xmlelement::push (treePtr&& t)
+{
+	bool uptodate = fChildTypesValid;
+	int type = t->getType();
+	ctree<xmlelement>::push (std::move(t));
+	if (uptodate) {
+		fChildTypes |= typeBit (type);
+		fChildTypesValid = true;
+	}
+}
+
+//______________________________________________________________________________
+// deferred sub elements are loaded and the lazily computed data (sub elements
+// types and indexes in parent) are updated so that reading the tree doesn't
+// write to it anymore; the ref counts are switched to atomic updates
+void xmlelement::freeze (bool state)
+{
+	const branchs& elts = elements();		// deferred sub elements are loaded before the element is frozen
+	childTypes();
+	setShared (state);
+	for (vector<Sxmlattribute>::const_iterator i = fAttributes.begin(); i != fAttributes.end(); i++)
+		(*i)->setShared (state);
+	for (branchs::const_iterator i = elts.begin(); i != elts.end(); i++) {
+		(*i)->getIndex();
+		(*i)->freeze (state);
+	}
+}
+
+//______________________________________________________________________________
+bool xmlelement::hasChild (int type) const
+{
+	bool own;
+	if (!(childTypes() & typeBit(type, own))) return false;
+	if (own) return true;
+	const branchs& elts = elements();
+	for (branchs::const_iterator i = elts.begin(); i != elts.end(); i++)
+		if ((*i)->getType() == type) return true;
+	return false;
+}
+
+ctree<xmlelement>::literator xmlelement::findChild (int type)
+{
+	return (childTypes() & typeBit(type)) ? findChild (type, lbegin()) : lend();
+}
+
+ctree<xmlelement>::literator xmlelement::findChild (int type, ctree<xmlelement>::literator iter)
+{
+	for (literator e = lend(); iter != e; iter++)
+		if ((*iter)->getType() == type) break;
+	return iter;
+}
+
+const std::string xmlelement::getChildValue (int type)
+{
+	literator iter = findChild(type);
+	return (iter != lend()) ? (*iter)->getValue() : "";
+}
+
+int xmlelement::getChildIntValue (int type, int defaultvalue)
+{
+	literator iter = findChild(type);
+	return (iter != lend()) ? int(*(*iter)) : defaultvalue;
+}
+
+long xmlelement::getChildLongValue (int type, long defaultvalue)
+{
+	literator iter = findChild(type);
+	return (iter != lend()) ? long(*(*iter)) : defaultvalue;
+}
+
+float xmlelement::getChildFloatValue (int type, float defaultvalue)
+{
+	literator iter = findChild(type);
+	return (iter != lend()) ? float(*(*iter)) : defaultvalue;
+}
+
+//______________________________________________________________________________
+ctree<xmlelement>::iterator xmlelement::deepFind(int type)
 { 
-	return find(type, begin());
+	return deepFind(type, begin());
 }
 
-ctree<xmlelement>::iterator xmlelement::find(int type, ctree<xmlelement>::iterator iter)
+ctree<xmlelement>::iterator xmlelement::deepFind(int type, ctree<xmlelement>::iterator iter)
 {
 	while (iter != end()) {
 		if ((*iter)->getType() == type) break;
@@ -13,6 +13,8 @@
 #ifndef __xml__
 #define __xml__
 
+#include <stdlib.h>
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -38,6 +40,35 @@ class xmlattribute;
 typedef SMARTP<xmlattribute> 	Sxmlattribute;
 typedef SMARTP<xmlelement> 		Sxmlelement;
 
+/*!
+\brief The numeric value of an xml element or attribute.
+
+	The value text of the numeric elements and attributes (as given by the schema,
+	see elementinfo and attributeinfo) is converted once when it is set: integers are
+	stored as long, the other numbers as float. The other values are only kept as
+	text and converted on request. The conversions follow the atoi, atol and atof
+	semantics. The text itself is kept unchanged.
+*/
+//______________________________________________________________________________
+class EXP xmlnumber {
+	enum { kText, kInteger, kFloat };
+	union { long fLong; float fFloat; } fValue;
+	int fKind;
+	public:
+				 xmlnumber() : fKind(kInteger) { fValue.fLong = 0; }
+
+		void	set (const std::string& text);
+		void	set (long value)		{ fValue.fLong = value; fKind = kInteger; }
+		//! the value is not converted, it is converted from the text on request
+		void	clear ()				{ fKind = kText; }
+
+		int		toInt (const std::string& text) const	{ return (fKind == kInteger) ? int(fValue.fLong) : atoi(text.c_str()); }
+		long	toLong (const std::string& text) const	{ return (fKind == kInteger) ? fValue.fLong : atol(text.c_str()); }
+		float	toFloat (const std::string& text) const	{ return (fKind == kInteger) ? float(fValue.fLong) : (fKind == kFloat) ? fValue.fFloat : float(atof(text.c_str())); }
+};
+
+class xmlelement;
+
 /*!
 \brief A generic xml attribute representation.
 
@@ -45,15 +76,25 @@ typedef SMARTP<xmlelement> 		Sxmlelement;
 */
 //______________________________________________________________________________
 class EXP xmlattribute : public smartable {
+	friend class xmlelement;
 	//! the attribute name
 	std::string	fName;
 	//! the attribute value
 	std::string 	fValue;
+	//! the attribute numeric value
+	xmlnumber		fNumber;
+	//! the element that holds the attribute (not owned), notified of the attribute changes
+	xmlelement*		fElement;
+
+	void	modified ();
+	void	setNumber ();
     protected:
-		xmlattribute() {}
+		xmlattribute() : fElement(0) {}
 		virtual ~xmlattribute() {}
     public:
 		static SMARTP<xmlattribute> create();
+		//! creates a copy of the attribute
+		SMARTP<xmlattribute> clone () const;
 
 		void setName (const std::string& name);
 		void setValue (const std::string& value);
@@ -65,11 +106,11 @@ class EXP xmlattribute : public smartable {
 		//! returns the attribute value as a string
 		const std::string& getValue () const	{ return fValue; }
 		//! returns the attribute value as a int
-		operator int () const;
+		operator int () const		{ return fNumber.toInt (fValue); }
 		//! returns the attribute value as a long
-		operator long () const;
+		operator long () const		{ return fNumber.toLong (fValue); }
 		//! returns the attribute value as a float
-		operator float () const;
+		operator float () const		{ return fNumber.toFloat (fValue); }
 };
 
 
@@ -89,8 +130,20 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		std::string fName;
 		//! the element value
 		std::string fValue;
+		//! the element numeric value
+		xmlnumber	fNumber;
 		//! list of the element attributes
 		std::vector<Sxmlattribute> fAttributes;
+		//! the direct sub elements types (see typeBit), recomputed when fChildTypesValid is false
+		mutable unsigned long long	fChildTypes;
+		mutable bool				fChildTypesValid;
+		//! the subtree structural hash, 0 when not computed
+		mutable std::atomic<unsigned long long>	fHash;
+
+		unsigned long long	typeBit (int type, bool& own) const;
+		unsigned long long	typeBit (int type) const		{ bool own; return typeBit (type, own); }
+		unsigned long long	childTypes () const;
+		void				setNumber ();
 
 	protected:
 		// the element type
@@ -98,18 +151,34 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		// the input line number for messages to the user
 		int fInputLineNumber;
 
-				 xmlelement (int inputLineNumber) : fType(0), fInputLineNumber(inputLineNumber) {}
-		virtual ~xmlelement() {}
+				 xmlelement (int inputLineNumber) : fChildTypes(0), fChildTypesValid(true), fHash(0), fType(0), fInputLineNumber(inputLineNumber) {}
+		virtual ~xmlelement();
+
+		virtual void modified ()	{ fChildTypesValid = false; touch(); }
 
 	public:
 		typedef ctree<xmlelement>::iterator     iterator;
 
 		static SMARTP<xmlelement> create (int inputLineNumber);
 
+		//! creates a copy of the element with its type, its value and its attributes, but without the sub elements
+		SMARTP<xmlelement>	copy () const;
+		/*! \brief creates a copy of the element and of its subtree
+
+			The copy keeps the elements types: the typed visitors apply to the copy.
+			\param shared when true, the copy is deferred, it is not a copy on write: the sub
+			elements are copied from the source when they are first accessed, and until then,
+			the copy reads the source subtree. This is only done when the source is frozen
+			(see freeze), which must then stay frozen while the copy is in use; otherwise the
+			subtree is copied at once.
+		*/
+		SMARTP<xmlelement>	clone (bool shared=false) const;
+
 		virtual void acceptIn  (basevisitor& visitor);
 		virtual void acceptOut (basevisitor& visitor);
 
-		int getInputLineNumber () { return fInputLineNumber; }
+		int getInputLineNumber () const { return fInputLineNumber; }
+		void setInputLineNumber (int line) { fInputLineNumber = line; }
 
 		void setValue (unsigned long value);
 		void setValue (long value);
@@ -125,17 +194,33 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		const std::string& getValue () const    { return fValue; }
 
 		//! returns the element value as a long
-		operator long () const;
+		operator long () const		{ return fNumber.toLong (fValue); }
 		//! returns the element value as a int
-		operator int () const;
+		operator int () const		{ return fNumber.toInt (fValue); }
 		//! returns the element value as a float
-		operator float () const;
+		operator float () const		{ return fNumber.toFloat (fValue); }
 		//! elements comparison
 		bool operator ==(const xmlelement& elt) const;
 		bool operator !=(const xmlelement& elt) const { return !(*this == elt); }
 
+		/*! \brief gives a structural hash of the element subtree
+
+			The hash covers the types, names, values and attributes of the element and of its
+			sub elements, in order. It is computed on demand and kept until the subtree is modified:
+			comparing unchanged subtrees is then a constant time operation.
+			The changes made using the element, attribute and tree methods (push, insert, erase,
+			replace) are detected, but not the changes made directly to the elements() vector:
+			touch must then be called.
+		*/
+		unsigned long long	hash () const;
+		//! invalidates the hash of the element and of its ancestors
+		void				touch ();
+		//! checks if two subtrees are the same using their hashes (see hash)
+		bool				sameTree (const xmlelement& elt) const	{ return hash() == elt.hash(); }
+
 		//! adds an attribute to the element
 		long add (const Sxmlattribute& attr);
+		long add (Sxmlattribute&& attr);
 
 		// getting information about attributes
 		const std::vector<Sxmlattribute>& attributes() const { return fAttributes; }
@@ -145,11 +230,29 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		int                 getAttributeIntValue  (const std::string& attrname, int defaultvalue) const;
 		float               getAttributeFloatValue  (const std::string& attrname, float defaultvalue) const;
 
-		// finding sub elements by type
-		ctree<xmlelement>::iterator     find(int type);
-		ctree<xmlelement>::iterator     find(int type, ctree<xmlelement>::iterator start);
-
-		// getting sub elements values
+		virtual void push (const treePtr& t);
+		virtual void push (treePtr&& t);
+
+		// finding direct sub elements by type
+		//! returns true if a direct sub element of the given type exists (misses, and hits of the types allowed by the DTD, are answered without scanning)
+		bool            hasChild (int type) const;
+		ctree<xmlelement>::literator    findChild (int type);
+		ctree<xmlelement>::literator    findChild (int type, ctree<xmlelement>::literator start);
+
+		// getting direct sub elements values
+		const std::string getChildValue      (int type);
+		int               getChildIntValue   (int type, int defaultvalue);
+		long              getChildLongValue  (int type, long defaultvalue);
+		float             getChildFloatValue (int type, float defaultvalue);
+
+		// finding sub elements by type in the whole subtree (depth first)
+		ctree<xmlelement>::iterator     deepFind(int type);
+		ctree<xmlelement>::iterator     deepFind(int type, ctree<xmlelement>::iterator start);
+		//! same as deepFind
+		ctree<xmlelement>::iterator     find(int type)		{ return deepFind (type); }
+		ctree<xmlelement>::iterator     find(int type, ctree<xmlelement>::iterator start)	{ return deepFind (type, start); }
+
+		// getting sub elements values (depth first search)
 		const std::string getValue      (int subElementType);
 		int               getIntValue   (int subElementType, int defaultvalue);
 		long              getLongValue  (int subElementType, long defaultvalue);
@@ -159,6 +262,14 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
     //! returns true if subelement with given value exists
     bool hasSubElement(int subElementType, std::string value);
 
+		/*! \brief prepares (or releases) the element and its subtree for concurrent reading (see TXMLFile::freeze)
+
+			A frozen element must not be modified, which is asserted by the modification methods.
+		*/
+		void freeze (bool state);
+		//! returns true when the element is frozen
+		bool frozen () const		{ return shared(); }
+
 		// misc
 		bool empty () const	{ return fValue.empty() && elements().empty(); }
 };
@@ -18,11 +18,12 @@ namespace MusicXML2
 {
 
 void xml_tree_browser::browse (xmlelement& t) {
-	enter(t);
-	ctree<xmlelement>::literator iter;
-	for (iter = t.lbegin(); iter != t.lend(); iter++)
-		browse(**iter);
-	leave(t);
+	xml_tree_walker walker(t);
+	for (xml_tree_walker::event e = walker.next(); e.node; e = walker.next()) {
+		if (e.phase == xml_tree_walker::kLeave) leave (*e.node);
+		else if (intercept (*e.node)) walker.skip();
+		else enter (*e.node);
+	}
 }
 
 
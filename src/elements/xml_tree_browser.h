@@ -24,7 +24,15 @@ namespace MusicXML2
 @{
 */
 
+typedef tree_walker<xmlelement>	xml_tree_walker;
+
 //______________________________________________________________________________
+/*!
+\brief A browser that visits a tree in document order.
+
+	The traversal is not recursive (see tree_walker). Derived browsers may
+	take over the visit of specific elements using intercept().
+*/
 class EXP xml_tree_browser : public tree_browser<xmlelement> 
 {
 	public:
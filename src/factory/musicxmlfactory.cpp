@@ -17,7 +17,7 @@
 #include "musicxmlfactory.h"
 #include "factory.h"
 #include "sortvisitor.h"
-#include "xml_tree_browser.h"
+#include "static_tree_browser.h"
 #include "versions.h"
 
 using namespace std;
@@ -28,7 +28,7 @@ namespace MusicXML2
 //------------------------------------------------------------------------
 // public methods
 //------------------------------------------------------------------------
-musicxmlfactory::musicxmlfactory ()
+musicxmlfactory::musicxmlfactory () : fSortOnInsert(false)
 {
 //	init();
 	fFile = TXMLFile::create();
@@ -39,10 +39,10 @@ musicxmlfactory::musicxmlfactory ()
 	fFile->set (fRoot);
 	
 	fIdentification = factory::instance().create(k_identification);
-	fRoot->push (fIdentification);
+	insert (fRoot, fIdentification);
 	
 	fPartList = factory::instance().create(k_part_list);
-	fRoot->push (fPartList);
+	insert (fRoot, fPartList);
 }
 
 //------------------------------------------------------------------------
@@ -50,8 +50,8 @@ Sxmlelement	musicxmlfactory::scorepart (const char* id, const char* name, const
 {
 	Sxmlelement part = element(k_score_part);
 	part->add (attribute("id", id));
-	if (name)			part->push (element(k_part_name, name));
-	if (abbrev)			part->push (element(k_part_abbreviation, abbrev));
+	if (name)			insert (part, element(k_part_name, name));
+	if (abbrev)			insert (part, element(k_part_abbreviation, abbrev));
 	return part;
 }
 
@@ -68,12 +68,12 @@ void musicxmlfactory::header (const char* worknumber, const char* worktitle, con
 {
 	if (worknumber || worktitle) {
 		Sxmlelement work = element(k_work);
-		if (worknumber) work->push (element(k_work_number, worknumber));
-		if (worktitle) work->push (element(k_work_title, worktitle));
-		fRoot->push (work);
+		if (worknumber) insert (work, element(k_work_number, worknumber));
+		if (worktitle) insert (work, element(k_work_title, worktitle));
+		insert (fRoot, work);
 	}
-	if (movementnumber) fRoot->push (element(k_movement_number, movementnumber));
-	if (movementtitle) fRoot->push (element(k_movement_title, movementtitle));
+	if (movementnumber) insert (fRoot, element(k_movement_number, movementnumber));
+	if (movementtitle) insert (fRoot, element(k_movement_title, movementtitle));
 }
 
 //------------------------------------------------------------------------
@@ -81,7 +81,7 @@ void musicxmlfactory::creator (const char* c, const char* type)
 {
 	Sxmlelement creator = element(k_creator, c);
 	if (type) creator->add (attribute("type", type));
-	fIdentification->push (creator);
+	insert (fIdentification, creator);
 }
 
 //------------------------------------------------------------------------
@@ -89,7 +89,7 @@ void musicxmlfactory::rights (const char* c, const char* type)
 {
 	Sxmlelement rights = element(k_rights, c);
 	if (type) rights->add (attribute("type", type));
-	fIdentification->push (rights);
+	insert (fIdentification, rights);
 }
 
 //------------------------------------------------------------------------
@@ -105,27 +105,27 @@ Sxmlelement musicxmlfactory::newmeasure (int number, const char* time, const cha
 {
 	Sxmlelement m = newmeasure (number);
 	Sxmlelement attributes = getAttributes (m);
-	if (division) attributes->push (element(k_divisions, division));
+	if (division) insert (attributes, element(k_divisions, division));
 	if (time) {
 		int beat, beatType;
 		int n = sscanf (time, "%d/%d", &beat, &beatType);
 		if (n == 2) {
 			Sxmlelement t = element (k_time);
-			t->push (element(k_beats, beat));
-			t->push (element(k_beat_type, beatType));
-			attributes->push (t);
+			insert (t, element(k_beats, beat));
+			insert (t, element(k_beat_type, beatType));
+			insert (attributes, t);
 		}
 	}
 	if (clef) {
 		Sxmlelement c = element (k_clef);
-		c->push (element (k_sign, clef));
-		if (line) c->push (element (k_line, line));
-		attributes->push (c);
+		insert (c, element (k_sign, clef));
+		if (line) insert (c, element (k_line, line));
+		insert (attributes, c);
 	}
 	if (key) {
 		Sxmlelement k = element (k_key);
-		k->push (element (k_fifths, key));
-		attributes->push (k);
+		insert (k, element (k_fifths, key));
+		insert (attributes, k);
 	}
 	return m;
 }
@@ -135,12 +135,12 @@ Sxmlelement musicxmlfactory::newnote (const char* step, float alter, int octave,
 {
 	Sxmlelement elt = element(k_note);
 	Sxmlelement pitch = element(k_pitch);
-	pitch->push (element (k_step, step));
-	if (alter) pitch->push (element (k_alter, alter));
-	pitch->push (element (k_octave, octave));
-	elt->push(pitch);
-	if (duration) elt->push(element(k_duration, duration));
-	if (type) elt->push(element(k_type, type));
+	insert (pitch, element (k_step, step));
+	if (alter) insert (pitch, element (k_alter, alter));
+	insert (pitch, element (k_octave, octave));
+	insert (elt, pitch);
+	if (duration) insert (elt, element(k_duration, duration));
+	if (type) insert (elt, element(k_type, type));
 	return elt;
 }
 
@@ -148,8 +148,9 @@ Sxmlelement musicxmlfactory::newnote (const char* step, float alter, int octave,
 Sxmlelement musicxmlfactory::newrest (int duration, const char* type)
 {
 	Sxmlelement elt = element(k_note);
-	if (duration) elt->push(element(k_duration, duration));
-	if (type) elt->push(element(k_type, type));
+	insert (elt, element(k_rest));
+	if (duration) insert (elt, element(k_duration, duration));
+	if (type) insert (elt, element(k_type, type));
 	return elt;
 }
 
@@ -159,7 +160,7 @@ Sxmlelement musicxmlfactory::newdynamics (int type, const char* placement)
 	Sxmlelement dynamics = element (k_dynamics);
 	if (placement)
 		dynamics->add (attribute( "placement", placement));
-	dynamics->push (element(type));
+	insert (dynamics, element(type));
 	return dynamics;
 }
 
@@ -170,11 +171,11 @@ Sxmlelement musicxmlfactory::newbarline (const char* location, const char* barst
 	if (location)
 		barline->add (attribute( "location", location));
 	if (barstyle)
-		barline->push (element(k_bar_style, barstyle));
+		insert (barline, element(k_bar_style, barstyle));
 	if (repeat) {
 		Sxmlelement repeatelt = (element(k_repeat));
 		repeatelt->add (attribute( "direction", repeat));
-		barline->push (repeatelt);
+		insert (barline, repeatelt);
 	}
 	return barline;
 }
@@ -186,7 +187,7 @@ void musicxmlfactory::makechord (const vector<Sxmlelement>& notes)
 	vector<Sxmlelement>::const_iterator i = notes.begin();
 	i++;								// skip first note
 	for (; i != notes.end(); i++)
-		(*i)->push(element(k_chord));
+		insert (*i, element(k_chord));
 }
 
 //------------------------------------------------------------------------
@@ -194,19 +195,19 @@ void musicxmlfactory::maketuplet(int actual, int normal, const std::vector<Sxmle
 {
 	if (notes.empty()) return;
 	Sxmlelement timemod = element(k_time_modification);
-	timemod->push (element (k_actual_notes, actual));
-	timemod->push (element (k_normal_notes, normal));
+	insert (timemod, element (k_actual_notes, actual));
+	insert (timemod, element (k_normal_notes, normal));
 	for (unsigned int i=0; i < notes.size(); i++)
-		notes[i]->push(timemod);
+		insert (notes[i], i ? timemod->clone() : timemod);
 	Sxmlelement notations = getNotations (notes[0]);
 	Sxmlelement tuplet = element (k_tuplet);
 	tuplet->add (attribute ("type", "start"));
-	notations->push (tuplet);
+	insert (notations, tuplet);
 
 	notations = getNotations (notes[notes.size()-1]);
 	tuplet = element (k_tuplet);
 	tuplet->add (attribute ("type", "stop"));
-	notations->push (tuplet);
+	insert (notations, tuplet);
 }
 
 //------------------------------------------------------------------------
@@ -214,14 +215,14 @@ void musicxmlfactory::tie (Sxmlelement start, Sxmlelement stop)
 {
 	Sxmlelement tieStart = element (k_tie);
 	tieStart->add (attribute ("type", "start"));
-	start->push (tieStart);
+	insert (start, tieStart);
 	Sxmlelement tiedStart = element (k_tied);
 	tiedStart->add (attribute ("type", "start"));
 	addnotation (start, tiedStart);
 	
 	Sxmlelement tieStop = element (k_tie);
 	tieStop->add (attribute ("type", "stop"));
-	stop->push (tieStop);
+	insert (stop, tieStop);
 	Sxmlelement tiedStop = element (k_tied);
 	tiedStop->add (attribute ("type", "stop"));
 	addnotation (stop, tiedStop);
@@ -231,14 +232,14 @@ void musicxmlfactory::tie (Sxmlelement start, Sxmlelement stop)
 void musicxmlfactory::addnotation (Sxmlelement elt, Sxmlelement notation)
 {
 	Sxmlelement notations = getNotations (elt);
-	notations->push (notation);
+	insert (notations, notation);
 }
 
 //------------------------------------------------------------------------
 void musicxmlfactory::addarticulation (Sxmlelement elt, Sxmlelement articulation)
 {
 	Sxmlelement articulations = getArticulations (elt);
-	articulations->push (articulation);
+	insert (articulations, articulation);
 }
 
 //------------------------------------------------------------------------
@@ -247,10 +248,10 @@ void musicxmlfactory::addgroup (int number, const char* name, const char* abbrev
 	Sxmlelement groupStart = element(k_part_group);
 	groupStart->add (attribute ("number", number));
 	groupStart->add (attribute ("type", "start"));
-	if (name)			groupStart->push (element(k_group_name, name));
-	if (abbrev)			groupStart->push (element(k_group_abbreviation, abbrev));
-	if (groupbarline)	groupStart->push (element(k_group_barline, "yes"));
-	fPartList->push (groupStart);
+	if (name)			insert (groupStart, element(k_group_name, name));
+	if (abbrev)			insert (groupStart, element(k_group_abbreviation, abbrev));
+	if (groupbarline)	insert (groupStart, element(k_group_barline, "yes"));
+	insert (fPartList, groupStart);
 
 	for (vector<Sxmlelement>::const_iterator i = parts.begin(); i != parts.end(); i++)
 		addpart(*i);
@@ -258,7 +259,7 @@ void musicxmlfactory::addgroup (int number, const char* name, const char* abbrev
 	Sxmlelement groupStop = element(k_part_group);
 	groupStop->add (attribute ("number", number));
 	groupStop->add (attribute ("type", "stop"));
-	fPartList->push (groupStop);	
+	insert (fPartList, groupStop);	
 }
 
 //------------------------------------------------------------------------
@@ -266,10 +267,10 @@ void musicxmlfactory::addpart (const Sxmlelement& part)
 { 
 	switch (part->getType()) {
 		case k_score_part:
-			fPartList->push(part);
+			insert (fPartList, part);
 			break;
 		case k_part:
-			fRoot->push(part);
+			insert (fRoot, part);
 			break;
 		default:
 			cerr << "musicxmlfactory::addpart unexpected type " <<  part->getType() << endl;
@@ -280,7 +281,7 @@ void musicxmlfactory::addpart (const Sxmlelement& part)
 void musicxmlfactory::add (Sxmlelement elt, const std::vector<Sxmlelement>& subelts) const
 {
 	for (unsigned int i=0; i < subelts.size(); i++) 
-		elt->push( subelts[i]);
+		insert (elt, subelts[i]);
 }
 
 //------------------------------------------------------------------------
@@ -317,35 +318,47 @@ static const char * timestring ()
 void musicxmlfactory::encoding(const char* software)
 {
 	Sxmlelement encoding = element (k_encoding);
-	if (software) encoding->push (element(k_software, software));
+	if (software) insert (encoding, element(k_software, software));
 
 	string lib = "MusicXML Library version ";
 	lib += musicxmllibVersionStr();
-	encoding->push (element(k_software, lib.c_str()));
-	encoding->push (element (k_encoding_date, timestring()));
-	fIdentification->push (encoding);
+	insert (encoding, element(k_software, lib.c_str()));
+	insert (encoding, element (k_encoding_date, timestring()));
+	insert (fIdentification, encoding);
 }
 
 //------------------------------------------------------------------------
 // protected methods
+//------------------------------------------------------------------------
+void musicxmlfactory::setSortOnInsert (bool state)
+{
+	if (state && !fSortOnInsert) sort();		// the elements inserted so far
+	fSortOnInsert = state;
+}
+
+//------------------------------------------------------------------------
+void musicxmlfactory::insert (Sxmlelement elt, const Sxmlelement& child) const
+{
+	if (fSortOnInsert) sortvisitor::insert (*elt, child);
+	else elt->push (child);
+}
+
 //------------------------------------------------------------------------
 void musicxmlfactory::sort()
 {
+	if (fSortOnInsert) return;		// the tree is already sorted
 	sortvisitor sorter;
-	xml_tree_browser browser(&sorter);
+	static_tree_browser<sortvisitor> browser(&sorter);
 	browser.browse(*fRoot);
 }
 
 //------------------------------------------------------------------------
 Sxmlelement	musicxmlfactory::getSubElement (Sxmlelement elt, int type) const
 {
-	vector<Sxmlelement>&  subelts = elt->elements();
-	for (unsigned int i=0; i < subelts.size(); i++) {
-		if (subelts[i]->getType() == type)
-			return subelts[i];
-	}
+	ctree<xmlelement>::literator i = elt->findChild (type);
+	if (i != elt->lend()) return *i;
 	Sxmlelement sub = element(type);
-	elt->push (sub);
+	insert (elt, sub);
 	return sub;
 }
 
@@ -29,9 +29,11 @@ class musicxmlfactory
 		Sxmlelement	fRoot;
 		Sxmlelement	fIdentification;
 		Sxmlelement	fPartList;
+		bool		fSortOnInsert;
 
 	protected:
 		void			sort ();
+		void			insert (Sxmlelement elt, const Sxmlelement& child) const;
 		Sxmlelement		getSubElement (Sxmlelement elt, int type) const;
 		Sxmlelement		getNotations (Sxmlelement elt) const		{ return getSubElement (elt, MusicXML2::k_notations); }
 		Sxmlelement		getAttributes (Sxmlelement elt) const		{ return getSubElement (elt, MusicXML2::k_attributes); }
@@ -47,6 +49,12 @@ class musicxmlfactory
 		virtual Sxmlelement	identification ()	{ return fIdentification; }
 		virtual Sxmlelement	partlist ()			{ return fPartList; }
 
+		// sort on insert: the elements are inserted at their place in their container and the
+		// tree needs not to be sorted when printed. Note that only the elements inserted using
+		// the factory are sorted: the elements pushed directly in the tree are not.
+		virtual void	setSortOnInsert (bool state);
+		virtual bool	getSortOnInsert () const	{ return fSortOnInsert; }
+
 		// managing header information
 		virtual void	header	(const char* worknumber, const char* worktitle, const char* movementnumber, const char* movementtitle);
 		virtual void	creator	(const char* c, const char* type=0);
@@ -73,7 +81,7 @@ class musicxmlfactory
 		virtual void		addarticulation (Sxmlelement elt, Sxmlelement articulation);
 
 		virtual void add (Sxmlelement elt, const std::vector<Sxmlelement>& subelts) const;
-		virtual void add (Sxmlelement elt, const Sxmlelement& subelt) const		{ elt->push (subelt); }
+		virtual void add (Sxmlelement elt, const Sxmlelement& subelt) const		{ insert (elt, subelt); }
 		virtual void add (Sxmlelement elt, const Sxmlattribute& attr) const		{ elt->add (attr); }
 
 		virtual Sxmlelement		element(int type, const char * value=0) const;
@@ -0,0 +1,387 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <iostream>
+
+#include "elementsinfo.h"
+#include "libmusicxml.h"
+#include "musicxmlwriter.h"
+#include "sortvisitor.h"
+#include "static_tree_browser.h"
+#include "versions.h"
+#include "xmlfile.h"
+#include "xmlvisitor.h"
+
+using namespace std;
+namespace MusicXML2
+{
+
+//------------------------------------------------------------------------
+musicxmlwriter::musicxmlwriter (ostream& out)
+	: fOut(out), fTupletSize(0), fTupletCount(0), fTieStop(false), fStarted(false), fErrors(0)
+{
+}
+
+musicxmlwriter::~musicxmlwriter ()
+{
+	finish();
+}
+
+//------------------------------------------------------------------------
+// private methods
+//------------------------------------------------------------------------
+void musicxmlwriter::warning (const string& msg)
+{
+	cerr << "musicxmlwriter warning: " << msg << endl;
+	fErrors++;
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::eol (int indent)
+{
+	fOut << '\n';
+	while (indent-- > 0) fOut << "    ";
+}
+
+//------------------------------------------------------------------------
+// writes the xml declaration, the doctype and opens the score
+void musicxmlwriter::start ()
+{
+	if (fStarted) return;
+	fStarted = true;
+	TXMLDecl decl ("1.0", "", TXMLDecl::kNo);
+	TDocType doctype ("score-partwise");
+	decl.print (fOut);
+	doctype.print (fOut);
+	open (fFactory.element (k_score_partwise));
+}
+
+//------------------------------------------------------------------------
+// checks the place of an element in the current element and closes the current element start tag
+void musicxmlwriter::check (int type)
+{
+	if (fStack.empty()) return;
+	frame& f = fStack.back();
+	if (f.empty) {
+		fOut << ">";
+		f.empty = false;
+	}
+	const elementinfo& info = elementinfo::get (f.elt->getType());
+	if (!info.allows (type))
+		warning (string("element ") + elementinfo::get(type).name + " not allowed in " + info.name);
+	else if (info.model && (type != kComment) && (type != kProcessingInstruction)) {
+		int next = info.model->next (f.state, type);
+		if (next < 0) {
+			warning (string("misplaced element ") + elementinfo::get(type).name + " in " + info.name);
+			next = info.model->resync (type);
+		}
+		if (next >= 0) f.state = next;
+	}
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::write (const Sxmlelement& elt)
+{
+	check (elt->getType());
+	sortvisitor sorter;
+	static_tree_browser<sortvisitor> sort(&sorter);
+	sort.browse (*elt);
+	xmlvisitor v (fOut, int(fStack.size()));
+	static_tree_browser<xmlvisitor> browser(&v);
+	browser.browse (*elt);
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::flush ()
+{
+	if (fNote) {
+		Sxmlelement note = fNote;
+		fNote = Sxmlelement();
+		write (note);
+	}
+}
+
+//------------------------------------------------------------------------
+// closes the elements up to an element of the given type, returns false when there is no such element
+bool musicxmlwriter::moveto (int type)
+{
+	size_t n = fStack.size();
+	while (n && (fStack[n-1].elt->getType() != type)) n--;
+	if (!n) return false;
+	while (fStack.size() > n) close();
+	return true;
+}
+
+//------------------------------------------------------------------------
+// makes sure that an element of the given type is open in its parent
+void musicxmlwriter::enter (int type, int parent)
+{
+	start();
+	flush();
+	if (fStack.size() && (fStack.back().elt->getType() == type)) return;
+	moveto (parent);
+	open (fFactory.element (type));
+}
+
+//------------------------------------------------------------------------
+// the pending note takes the current tuplet and ties
+void musicxmlwriter::pending (const Sxmlelement& note)
+{
+	if (fTupletCount > 0) {
+		fFactory.add (note, fTimeModification->clone());
+		if (fTupletCount == fTupletSize) {
+			Sxmlelement tuplet = fFactory.element (k_tuplet);
+			tuplet->add (fFactory.attribute ("type", "start"));
+			fFactory.addnotation (note, tuplet);
+		}
+		if (fTupletCount == 1) {
+			Sxmlelement tuplet = fFactory.element (k_tuplet);
+			tuplet->add (fFactory.attribute ("type", "stop"));
+			fFactory.addnotation (note, tuplet);
+		}
+		fTupletCount--;
+	}
+	if (fTieStop) {
+		Sxmlelement tieStop = fFactory.element (k_tie);
+		tieStop->add (fFactory.attribute ("type", "stop"));
+		fFactory.add (note, tieStop);
+		Sxmlelement tiedStop = fFactory.element (k_tied);
+		tiedStop->add (fFactory.attribute ("type", "stop"));
+		fFactory.addnotation (note, tiedStop);
+		fTieStop = false;
+	}
+	fNote = note;
+}
+
+//------------------------------------------------------------------------
+// low level operations
+//------------------------------------------------------------------------
+void musicxmlwriter::open (const Sxmlelement& elt)
+{
+	flush();
+	check (elt->getType());
+	eol (int(fStack.size()));
+	fOut << "<" << elt->getName();
+	vector<Sxmlattribute>::const_iterator attr;
+	for (attr = elt->attributes().begin(); attr != elt->attributes().end(); attr++)
+		fOut << " " << (*attr)->getName() << "=\"" << (*attr)->getValue() << "\"";
+	frame f = { elt, 0, true };
+	fStack.push_back (f);
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::close ()
+{
+	flush();
+	if (fStack.empty()) return;
+	frame f = fStack.back();
+	fStack.pop_back();
+	const elementinfo& info = elementinfo::get (f.elt->getType());
+	if (info.model && !info.model->final (f.state))
+		warning (string("incomplete content in ") + info.name);
+	if (f.empty) fOut << "/>";
+	else {
+		eol (int(fStack.size()));
+		fOut << "</" << f.elt->getName() << ">";
+	}
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::add (const Sxmlelement& elt)
+{
+	flush();
+	write (elt);
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::finish ()
+{
+	start();
+	flush();
+	while (fStack.size()) close();
+	fOut.flush();
+}
+
+//------------------------------------------------------------------------
+// header information
+//------------------------------------------------------------------------
+void musicxmlwriter::header (const char* worknumber, const char* worktitle, const char* movementnumber, const char* movementtitle)
+{
+	start();
+	flush();
+	moveto (k_score_partwise);
+	if (worknumber || worktitle) {
+		Sxmlelement work = fFactory.element(k_work);
+		if (worknumber) fFactory.add (work, fFactory.element(k_work_number, worknumber));
+		if (worktitle) fFactory.add (work, fFactory.element(k_work_title, worktitle));
+		add (work);
+	}
+	if (movementnumber) add (fFactory.element(k_movement_number, movementnumber));
+	if (movementtitle) add (fFactory.element(k_movement_title, movementtitle));
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::creator (const char* c, const char* type)
+{
+	Sxmlelement creator = fFactory.element(k_creator, c);
+	if (type) creator->add (fFactory.attribute("type", type));
+	enter (k_identification, k_score_partwise);
+	add (creator);
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::rights (const char* c, const char* type)
+{
+	Sxmlelement rights = fFactory.element(k_rights, c);
+	if (type) rights->add (fFactory.attribute("type", type));
+	enter (k_identification, k_score_partwise);
+	add (rights);
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::encoding (const char* software)
+{
+	Sxmlelement encoding = fFactory.element (k_encoding);
+	if (software) fFactory.add (encoding, fFactory.element(k_software, software));
+
+	string lib = "MusicXML Library version ";
+	lib += musicxmllibVersionStr();
+	fFactory.add (encoding, fFactory.element(k_software, lib.c_str()));
+	enter (k_identification, k_score_partwise);
+	add (encoding);
+}
+
+//------------------------------------------------------------------------
+// the part list
+//------------------------------------------------------------------------
+void musicxmlwriter::scorepart (const char* id, const char* name, const char* abbrev)
+{
+	enter (k_part_list, k_score_partwise);
+	add (fFactory.scorepart (id, name, abbrev));
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::startgroup (int number, const char* name, const char* abbrev, bool groupbarline)
+{
+	Sxmlelement group = fFactory.element(k_part_group);
+	group->add (fFactory.attribute ("number", number));
+	group->add (fFactory.attribute ("type", "start"));
+	if (name)			fFactory.add (group, fFactory.element(k_group_name, name));
+	if (abbrev)			fFactory.add (group, fFactory.element(k_group_abbreviation, abbrev));
+	if (groupbarline)	fFactory.add (group, fFactory.element(k_group_barline, "yes"));
+	enter (k_part_list, k_score_partwise);
+	add (group);
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::stopgroup (int number)
+{
+	Sxmlelement group = fFactory.element(k_part_group);
+	group->add (fFactory.attribute ("number", number));
+	group->add (fFactory.attribute ("type", "stop"));
+	enter (k_part_list, k_score_partwise);
+	add (group);
+}
+
+//------------------------------------------------------------------------
+// the parts content
+//------------------------------------------------------------------------
+void musicxmlwriter::part (const char* id)
+{
+	start();
+	flush();
+	moveto (k_score_partwise);
+	open (fFactory.part (id));
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::newmeasure (int number)
+{
+	flush();
+	moveto (k_part);
+	open (fFactory.newmeasure (number));
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::newmeasure (int number, const char* time, const char* clef, int line, int key, int division)
+{
+	Sxmlelement measure = fFactory.newmeasure (number, time, clef, line, key, division);
+	flush();
+	moveto (k_part);
+	open (measure);
+	for (ctree<xmlelement>::literator i = measure->lbegin(); i != measure->lend(); i++)
+		add (*i);
+}
+
+//------------------------------------------------------------------------
+Sxmlelement musicxmlwriter::newnote (const char* step, float alter, int octave, int duration, const char* type)
+{
+	flush();
+	pending (fFactory.newnote (step, alter, octave, duration, type));
+	return fNote;
+}
+
+//------------------------------------------------------------------------
+Sxmlelement musicxmlwriter::newrest (int duration, const char* type)
+{
+	flush();
+	pending (fFactory.newrest (duration, type));
+	return fNote;
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::newbarline (const char* location, const char* barstyle, const char *repeat)
+{
+	add (fFactory.newbarline (location, barstyle, repeat));
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::makechord ()
+{
+	if (fNote) fFactory.add (fNote, fFactory.element(k_chord));
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::maketuplet (int actual, int normal, int count)
+{
+	fTimeModification = fFactory.element (k_time_modification);
+	fFactory.add (fTimeModification, fFactory.element (k_actual_notes, actual));
+	fFactory.add (fTimeModification, fFactory.element (k_normal_notes, normal));
+	fTupletSize = fTupletCount = count;
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::tie ()
+{
+	if (!fNote) return;
+	Sxmlelement tieStart = fFactory.element (k_tie);
+	tieStart->add (fFactory.attribute ("type", "start"));
+	fFactory.add (fNote, tieStart);
+	Sxmlelement tiedStart = fFactory.element (k_tied);
+	tiedStart->add (fFactory.attribute ("type", "start"));
+	fFactory.addnotation (fNote, tiedStart);
+	fTieStop = true;
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::addnotation (Sxmlelement notation)
+{
+	if (fNote) fFactory.addnotation (fNote, notation);
+}
+
+//------------------------------------------------------------------------
+void musicxmlwriter::addarticulation (Sxmlelement articulation)
+{
+	if (fNote) fFactory.addarticulation (fNote, articulation);
+}
+
+}
@@ -0,0 +1,143 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __musicxmlwriter__
+#define __musicxmlwriter__
+
+#include <ostream>
+#include <vector>
+
+#include "exports.h"
+#include "musicxmlfactory.h"
+#include "xml.h"
+
+namespace MusicXML2
+{
+
+/*!
+\addtogroup MusicXML
+@{
+*/
+
+//------------------------------------------------------------------------
+/*!
+\brief A forward only MusicXML writer.
+
+	The writer provides the high level operations of the musicxmlfactory but
+	the score is written to the output stream while it is generated: no tree
+	is built and the memory doesn't depend on the score size. Only the open
+	elements (score-partwise, part, measure...) and the last note are kept.
+
+	The elements are written in the order of the calls: the high level
+	operations open and close the containers as required, e.g. \c part closes
+	the part-list and the previous part. The subtrees given to the writer
+	are sorted according to the DTD and the elements order is checked using
+	the content models automata (see elementinfo): the misplaced elements
+	are reported on the standard error and counted (see errors).
+
+	The last note (or rest) remains pending until the next operation, so that
+	it can be modified: chords, ties, tuplets, notations and articulations
+	apply to the pending note.
+	\code
+		musicxmlwriter w (out);
+		w.scorepart ("P1", "Piano", 0);
+		w.part ("P1");
+		w.newmeasure (1, "4/4", "G", 2, 0, 4);
+		w.newnote ("C", 0, 4, 4, "quarter");
+		w.newnote ("E", 0, 4, 4, "quarter");
+		w.makechord();
+		w.finish();
+	\endcode
+*/
+class EXP musicxmlwriter
+{
+	private:
+		struct frame {
+			Sxmlelement	elt;		// the open element, without children
+			int			state;		// the content model state
+			bool		empty;		// true while no child has been written
+		};
+		std::ostream&		fOut;
+		std::vector<frame>	fStack;
+		musicxmlfactory		fFactory;	// creates the subtrees
+		Sxmlelement			fNote;		// the pending note
+		Sxmlelement			fTimeModification;
+		int					fTupletSize;	// the count of notes of the current tuplet
+		int					fTupletCount;	// the count of the remaining notes of the current tuplet
+		bool				fTieStop;
+		bool				fStarted;
+		int					fErrors;
+
+		void	start ();
+		void	check (int type);
+		void	eol (int indent);
+		void	write (const Sxmlelement& elt);
+		void	flush ();
+		void	pending (const Sxmlelement& note);
+		bool	moveto (int type);
+		void	enter (int type, int parent);
+		void	warning (const std::string& msg);
+
+	public:
+				 musicxmlwriter(std::ostream& out);
+		virtual	~musicxmlwriter();
+
+		// managing header information
+		virtual void	header	(const char* worknumber, const char* worktitle, const char* movementnumber, const char* movementtitle);
+		virtual void	creator	(const char* c, const char* type=0);
+		virtual void	rights	(const char* c, const char* type=0);
+		virtual void	encoding(const char* software = 0);
+
+		// managing the part list
+		virtual void	scorepart (const char* id, const char* name, const char* abbrev);
+		virtual void	startgroup (int number, const char* name, const char* abbrev, bool groupbarline);
+		virtual void	stopgroup (int number);
+
+		// the parts content
+		virtual void		part (const char* id);
+		virtual void		newmeasure (int number);
+		virtual void		newmeasure (int number, const char* time, const char* clef, int line, int key, int division);
+		//! the returned note is pending: it may be modified until the next writer operation
+		virtual Sxmlelement	newnote (const char* step, float alter, int octave, int duration, const char* type=0);
+		virtual Sxmlelement	newrest (int duration, const char* type=0);
+		virtual void		newbarline (const char* location, const char* barstyle, const char *repeat=0);
+
+		//! makes the pending note a chord note of the previous note
+		virtual void		makechord ();
+		//! makes a tuplet of the next \c count notes and rests (including the chord notes)
+		virtual void		maketuplet (int actual, int normal, int count);
+		//! ties the pending note to the next note
+		virtual void		tie ();
+		virtual void		addnotation (Sxmlelement notation);
+		virtual void		addarticulation (Sxmlelement articulation);
+
+		// low level operations
+		//! opens an element in the current element: the element children are ignored
+		virtual void	open (const Sxmlelement& elt);
+		//! closes the current element
+		virtual void	close ();
+		//! writes an element and its subtree in the current element
+		virtual void	add (const Sxmlelement& elt);
+		//! flushes the pending note and closes all the open elements
+		virtual void	finish ();
+
+		//! gives a factory to create the elements
+		const musicxmlfactory&	getFactory () const	{ return fFactory; }
+		//! gives the count of ordering errors
+		int						errors () const		{ return fErrors; }
+};
+
+/*! @} */
+
+}
+
+#endif
@@ -0,0 +1,299 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "scoremetadata.h"
+#include "xmlscan.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+void scoremetadata::clear ()
+{
+	fWorkTitle.clear();
+	fWorkNumber.clear();
+	fMovementTitle.clear();
+	fCreators.clear();
+	fParts.clear();
+	fTimes.clear();
+	fKeys.clear();
+	fMeasures = 0;
+	fDuration = rational(0);
+}
+
+//______________________________________________________________________________
+void scoremetadata::print (ostream& os) const
+{
+	if (fWorkTitle.size())		os << "work title: " << fWorkTitle << endl;
+	if (fWorkNumber.size())		os << "work number: " << fWorkNumber << endl;
+	if (fMovementTitle.size())	os << "movement title: " << fMovementTitle << endl;
+	for (size_t i = 0; i < fCreators.size(); i++)
+		os << "creator " << fCreators[i].first << ": " << fCreators[i].second << endl;
+	for (size_t i = 0; i < fParts.size(); i++)
+		os << "part " << fParts[i].fID << " \"" << fParts[i].fName << "\": " << fParts[i].fMeasures << " measures" << endl;
+	os << "measures: " << fMeasures << endl;
+	for (size_t i = 0; i < fTimes.size(); i++)
+		os << "time " << fTimes[i].fSignature << " at measure " << fTimes[i].fMeasure << endl;
+	for (size_t i = 0; i < fKeys.size(); i++)
+		os << "key " << fKeys[i].fFifths << (fKeys[i].fMode.size() ? " " : "") << fKeys[i].fMode << " at measure " << fKeys[i].fMeasure << endl;
+	os << "duration: " << fDuration.toString() << endl;
+}
+
+//______________________________________________________________________________
+// metadatascanner
+//______________________________________________________________________________
+// the element content up to the next markup, leading and trailing spaces removed
+static string content (const string& text, size_t pos)
+{
+	size_t end = text.find ('<', pos);
+	if (end == string::npos) end = text.size();
+	while ((pos < end) && isspace((unsigned char)text[pos])) pos++;
+	while ((end > pos) && isspace((unsigned char)text[end-1])) end--;
+	return text.substr (pos, end - pos);
+}
+
+//______________________________________________________________________________
+// an attribute value in a tag located between start and end
+static string attribute (const string& text, size_t start, size_t end, const char* name)
+{
+	size_t n = strlen(name);
+	for (size_t pos = text.find (name, start); (pos != string::npos) && (pos < end); pos = text.find (name, pos + n)) {
+		if (!isspace((unsigned char)text[pos-1])) continue;
+		size_t i = pos + n;
+		while ((i < end) && isspace((unsigned char)text[i])) i++;
+		if ((i >= end) || (text[i] != '=')) continue;
+		i++;
+		while ((i < end) && isspace((unsigned char)text[i])) i++;
+		if ((i >= end) || ((text[i] != '"') && (text[i] != '\''))) continue;
+		size_t close = text.find (text[i], i + 1);
+		if ((close == string::npos) || (close > end)) return "";
+		return text.substr (i + 1, close - i - 1);
+	}
+	return "";
+}
+
+//______________________________________________________________________________
+// a sum of beats (e.g. "3+2")
+static long beats (const string& str)
+{
+	long sum = 0;
+	const char* ptr = str.c_str();
+	while (*ptr) {
+		char* next;
+		sum += strtol (ptr, &next, 10);
+		if (next == ptr) break;
+		ptr = next;
+		while (*ptr && ((*ptr == '+') || isspace((unsigned char)*ptr))) ptr++;
+	}
+	return sum;
+}
+
+//______________________________________________________________________________
+// an element name that refers to the document text: it avoids strings allocation
+class elementname
+{
+	const char* fName;
+	size_t		fSize;
+	public:
+		elementname (const char* name, size_t size) : fName(name), fSize(size) {}
+		bool operator == (const char* name) const	{ return (fSize == strlen(name)) && !memcmp (fName, name, fSize); }
+		// checks if the name is at a given position of a text
+		bool at (const string& text, size_t pos) const	{ return !text.compare (pos, fSize, fName, fSize) && xmlIsNameEnd (text, pos + fSize); }
+		// the elements whose content is skipped
+		bool skipped () const {
+			return (*this == "note") || (*this == "direction") || (*this == "harmony") || (*this == "print")
+				|| (*this == "barline") || (*this == "backup") || (*this == "forward") || (*this == "figured-bass");
+		}
+};
+
+//______________________________________________________________________________
+bool metadatascanner::scanfile (const char* file, scoremetadata& md)
+{
+	FILE* fd = fopen (file, "rb");
+	if (!fd) return false;
+
+	string text;
+	char buff[65536];
+	size_t n;
+	while ((n = fread (buff, 1, sizeof(buff), fd)) > 0)
+		text.append (buff, n);
+	fclose (fd);
+	return scan (text, md);
+}
+
+//______________________________________________________________________________
+bool metadatascanner::scan (const string& text, scoremetadata& md)
+{
+	md.clear();
+	if (utf16bom (text.data(), text.size()) != kNoBOM) {
+		string utf8 (text);
+		xmlToUTF8 (utf8);
+		return scan (utf8, md);
+	}
+
+	bool score = false, timewise = false;
+	bool inWork = false, inScorePart = false, inFirstPart = false;
+	int partIndex = -1;				// the current part index in md.fParts
+	int measureIndex = 0;			// the current measure index in the first part
+	rational measureLength;			// the current nominal measure length
+	rational time;					// the time signature being scanned
+	string signature, beatsStr;
+	bool inTime = false, inKey = false, keyNumbered = false, keyFifths = false;
+	scoremetadata::keyinfo key;
+
+	size_t pos = 0;
+	while (true) {
+		size_t start = text.find ('<', pos);
+		if (start == string::npos) break;
+		size_t end = xmlAnyMarkupEnd (text, start);
+		if (end == string::npos) break;
+		pos = end + 1;
+
+		char c = text[start+1];
+		if ((c == '!') || (c == '?')) continue;		// comments, pi, doctype...
+
+		bool endTag = (c == '/');
+		size_t nameStart = start + (endTag ? 2 : 1);
+		size_t nameEnd = nameStart;
+		while (!xmlIsNameEnd (text, nameEnd)) nameEnd++;
+		elementname name (text.data() + nameStart, nameEnd - nameStart);
+		bool empty = !endTag && (text[end-1] == '/');
+
+		if (endTag) {
+			if (name == "work")				inWork = false;
+			else if (name == "score-part")	inScorePart = false;
+			else if (name == "measure") {
+				if (timewise || inFirstPart) md.fDuration += measureLength;
+				md.fDuration.rationalise();
+			}
+			else if (name == "time") {
+				if (inTime && signature.size()) {
+					scoremetadata::timeinfo info = { measureIndex, signature };
+					md.fTimes.push_back (info);
+					measureLength = time;
+				}
+				inTime = false;
+			}
+			else if (name == "key") {
+				if (inKey && !keyNumbered && keyFifths) md.fKeys.push_back (key);
+				inKey = false;
+			}
+			else if (name == "part") {
+				if (!timewise) inFirstPart = false;
+			}
+			continue;
+		}
+
+		// start tags
+		if (name.skipped()) {
+			// the notes content (and the other measure content that is not part of the metadata) is skipped
+			if (!empty) {
+				size_t next = text.find ("</", end);
+				while ((next != string::npos) && !name.at (text, next + 2))
+					next = text.find ("</", next + 2);
+				if (next == string::npos) break;
+				pos = next;
+			}
+		}
+		else if ((name == "score-partwise") || (name == "score-timewise")) {
+			score = true;
+			timewise = (name == "score-timewise");
+		}
+		else if (name == "measure") {
+			if (timewise) {
+				measureIndex++;
+				md.fMeasures++;
+			}
+			else if (partIndex >= 0) {
+				md.fParts[partIndex].fMeasures++;
+				if (inFirstPart) {
+					measureIndex++;
+					md.fMeasures++;
+				}
+			}
+		}
+		else if (name == "part") {
+			string id = attribute (text, start, end, "id");
+			partIndex = -1;
+			for (size_t i = 0; i < md.fParts.size(); i++) {
+				if (md.fParts[i].fID == id) { partIndex = int(i); break; }
+			}
+			if (partIndex < 0) {
+				scoremetadata::partinfo info = { id, "", 0 };
+				md.fParts.push_back (info);
+				partIndex = int(md.fParts.size()) - 1;
+			}
+			inFirstPart = (partIndex == 0);
+			if (timewise) md.fParts[partIndex].fMeasures++;
+		}
+		else if (empty) continue;
+		else if (name == "work")			inWork = true;
+		else if (name == "work-title")		{ if (inWork) md.fWorkTitle = content (text, end + 1); }
+		else if (name == "work-number")		{ if (inWork) md.fWorkNumber = content (text, end + 1); }
+		else if (name == "movement-title")	md.fMovementTitle = content (text, end + 1);
+		else if (name == "creator")
+			md.fCreators.push_back (make_pair (attribute (text, start, end, "type"), content (text, end + 1)));
+		else if (name == "score-part") {
+			scoremetadata::partinfo info = { attribute (text, start, end, "id"), "", 0 };
+			md.fParts.push_back (info);
+			inScorePart = true;
+		}
+		else if (name == "part-name") {
+			if (inScorePart && md.fParts.size()) md.fParts.back().fName = content (text, end + 1);
+		}
+		else if (inFirstPart && (name == "time")) {
+			string number = attribute (text, start, end, "number");
+			inTime = number.empty() || (number == "1");
+			signature.clear();
+			time = rational(0);
+		}
+		else if (inTime && (name == "beats"))		beatsStr = content (text, end + 1);
+		else if (inTime && (name == "beat-type")) {
+			string beatType = content (text, end + 1);
+			long n = beats (beatsStr), d = atol (beatType.c_str());
+			if (signature.size()) signature += "+";
+			signature += beatsStr + "/" + beatType;
+			if (d) {
+				time += rational(n, d);
+				time.rationalise();
+			}
+		}
+		else if (inFirstPart && (name == "key")) {
+			inKey = true;
+			string number = attribute (text, start, end, "number");
+			keyNumbered = number.size() && (number != "1");
+			key.fMeasure = measureIndex;
+			key.fFifths = 0;
+			key.fMode.clear();
+			keyFifths = false;
+		}
+		else if (inKey && (name == "fifths")) {
+			key.fFifths = atoi (content (text, end + 1).c_str());
+			keyFifths = true;
+		}
+		else if (inKey && (name == "mode"))		key.fMode = content (text, end + 1);
+	}
+	return score;
+}
+
+}
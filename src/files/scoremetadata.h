@@ -0,0 +1,101 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __scoremetadata__
+#define __scoremetadata__
+
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "exports.h"
+#include "rational.h"
+
+namespace MusicXML2
+{
+
+/*!
+\addtogroup MusicXML
+@{
+*/
+
+//______________________________________________________________________________
+/*!
+\brief The metadata of a score.
+
+	Measures are denoted by their position in the score, starting at 1.
+	Time and key signatures are collected from the first part only.
+*/
+class EXP scoremetadata
+{
+	public:
+		typedef struct {
+			std::string	fID;
+			std::string	fName;
+			int			fMeasures;		///< the part measures count
+		} partinfo;
+
+		typedef struct {
+			int			fMeasure;		///< the measure where the time signature is set
+			std::string	fSignature;		///< the time signature, e.g. "3/4" or "3/8+2/8"
+		} timeinfo;
+
+		typedef struct {
+			int			fMeasure;		///< the measure where the key signature is set
+			int			fFifths;
+			std::string	fMode;
+		} keyinfo;
+
+		std::string		fWorkTitle;
+		std::string		fWorkNumber;
+		std::string		fMovementTitle;
+		std::vector<std::pair<std::string, std::string> > fCreators;	///< the creators type and name
+		std::vector<partinfo>	fParts;
+		std::vector<timeinfo>	fTimes;
+		std::vector<keyinfo>	fKeys;
+		int				fMeasures;		///< the measures count of the first part
+		rational		fDuration;		///< the score nominal duration in whole notes
+
+				 scoremetadata() : fMeasures(0) {}
+		virtual ~scoremetadata() {}
+
+		void	clear ();
+		void	print (std::ostream& os) const;
+};
+
+//______________________________________________________________________________
+/*!
+\brief A fast scanner for the score metadata.
+
+	The scanner skims the document text: it doesn't build any element and
+	it skips the notes content. The score duration is computed from the time
+	signatures (it is the sum of the measures nominal length, pickup measures included).
+	UTF-16 documents are transcoded to UTF-8 first.
+*/
+class EXP metadatascanner
+{
+	public:
+				 metadatascanner() {}
+		virtual ~metadatascanner() {}
+
+		//! scans a document text, returns false when the text is not a score
+		bool	scan (const std::string& text, scoremetadata& md);
+		//! scans a file, returns false when the file can't be read or is not a score
+		bool	scanfile (const char* file, scoremetadata& md);
+};
+
+/*! @} */
+
+}
+
+#endif
@@ -13,7 +13,7 @@
 #include <iostream>
 #include "xmlfile.h"
 #include "xmlvisitor.h"
-#include "tree_browser.h"
+#include "static_tree_browser.h"
 
 using namespace std; 
 using namespace MusicXML2; 
@@ -59,7 +59,7 @@ void TXMLFile::print (ostream& stream)
 	if (fXMLDecl) fXMLDecl->print(stream);
 	if (fDocType) fDocType->print(stream);
 	xmlvisitor v(stream);
-	tree_browser<xmlelement> browser(&v);
+	static_tree_browser<xmlvisitor> browser(&v);
 	browser.browse(*elements());
 }
 
@@ -90,6 +90,17 @@ class EXP TXMLFile : public smartable
     void 			set (TDocType * dt)		{ fDocType = dt; }
 
     void 			print (std::ostream& s);
+
+    /*! \brief makes the tree safe for concurrent reading
+    	Once frozen, the tree may be browsed by several threads at the same time
+    	e.g. to run different visitors on the same score. The tree must not be
+    	modified while frozen and each thread must use its own visitors.
+    	freeze and unfreeze must be called while a single thread uses the tree.
+    */
+    void 			freeze ()				{ if (fXMLTree) fXMLTree->freeze (true); }
+    //! makes the tree modifiable again
+    void 			unfreeze ()				{ if (fXMLTree) fXMLTree->freeze (false); }
+    bool 			frozen () const			{ return fXMLTree && fXMLTree->frozen(); }
 };
 typedef SMARTP<TXMLFile> SXMLFile;
 
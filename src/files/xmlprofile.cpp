@@ -0,0 +1,104 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <algorithm>
+#include <string.h>
+
+#include "xmlprofile.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+// the presets definitions
+//______________________________________________________________________________
+static const char* kLayoutElements[] = { "defaults", "credit", "print", "appearance", "*-layout", 0 };
+static const char* kGraphicElements[] = { "stem", "beam", "notehead", 0 };
+static const char* kMidiElements[] = { "midi-device", "midi-instrument", "play", "virtual-instrument", "instrument-sound", 0 };
+static const char* kPageElements[] = { "page-layout", 0 };
+static const char* kPositionAttributes[] = { "default-x", "default-y", "relative-x", "relative-y", "bezier-*",
+											"font-*", "color", "halign", "valign", "justify", 0 };
+
+//______________________________________________________________________________
+static bool nameLess (const string& s1, const char* s2)	{ return strcmp (s1.c_str(), s2) < 0; }
+
+static bool endsWith (const char* name, size_t n, const string& suffix)
+{
+	return (n >= suffix.size()) && !memcmp (name + n - suffix.size(), suffix.data(), suffix.size());
+}
+
+//______________________________________________________________________________
+void xmlprofile::names::add (const string& name)
+{
+	if (name.empty()) return;
+	if (name[name.size()-1] == '*')	fPrefixes.push_back (name.substr (0, name.size()-1));
+	else if (name[0] == '*')		fSuffixes.push_back (name.substr (1));
+	else {
+		vector<string>::iterator i = lower_bound (fNames.begin(), fNames.end(), name);
+		if ((i == fNames.end()) || (*i != name)) fNames.insert (i, name);
+	}
+}
+
+//______________________________________________________________________________
+bool xmlprofile::names::match (const char* name) const
+{
+	vector<string>::const_iterator i = lower_bound (fNames.begin(), fNames.end(), name, nameLess);
+	if ((i != fNames.end()) && (*i == name)) return true;
+	for (size_t j = 0; j < fPrefixes.size(); j++)
+		if (!strncmp (name, fPrefixes[j].c_str(), fPrefixes[j].size())) return true;
+	if (fSuffixes.size()) {
+		size_t n = strlen (name);
+		for (size_t j = 0; j < fSuffixes.size(); j++)
+			if (endsWith (name, n, fSuffixes[j])) return true;
+	}
+	return false;
+}
+
+//______________________________________________________________________________
+static void addElements (xmlprofile* profile, const char** list)
+{
+	while (*list) profile->pruneElement (*list++);
+}
+
+static void addAttributes (xmlprofile* profile, const char** list)
+{
+	while (*list) profile->pruneAttribute (*list++);
+}
+
+//______________________________________________________________________________
+Sxmlprofile xmlprofile::create (const string& preset)
+{
+	Sxmlprofile profile = create();
+	if (preset == "playback") {
+		addElements (profile, kLayoutElements);
+		addElements (profile, kGraphicElements);
+		addAttributes (profile, kPositionAttributes);
+	}
+	else if (preset == "analysis") {
+		addElements (profile, kLayoutElements);
+		addAttributes (profile, kPositionAttributes);
+	}
+	else if (preset == "notation") {
+		addElements (profile, kPageElements);
+		addElements (profile, kMidiElements);
+	}
+	else return 0;
+	return profile;
+}
+
+}
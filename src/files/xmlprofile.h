@@ -0,0 +1,84 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmlprofile__
+#define __xmlprofile__
+
+#include <string>
+#include <vector>
+
+#include "exports.h"
+#include "smartpointer.h"
+
+namespace MusicXML2
+{
+
+/*!
+\addtogroup MusicXML
+@{
+*/
+
+//______________________________________________________________________________
+/*!
+\brief A pruning profile for the xml reader.
+
+	A profile is a set of elements and attributes names that are excluded
+	from the tree at parse time: the excluded elements (and their whole
+	content) and attributes are not built.
+	A name may be a pattern with a leading or a trailing '*' (e.g. "*-layout" or
+	"bezier-*") that matches any name with the corresponding suffix or prefix.
+
+	Predefined profiles are available:
+	- \e playback keeps what's necessary to play a score: layout, positions,
+	fonts and the graphic elements like stems, beams or noteheads are excluded.
+	- \e analysis keeps the musical content: layout, positions and fonts are excluded.
+	- \e notation keeps what's necessary to render a score: the page layout
+	and the midi data are excluded. Positions are kept.
+*/
+class EXP xmlprofile : public smartable
+{
+	class names {
+		std::vector<std::string>	fNames;		// sorted names
+		std::vector<std::string>	fPrefixes;
+		std::vector<std::string>	fSuffixes;
+		public:
+			void add (const std::string& name);
+			bool match (const char* name) const;
+	};
+
+	names	fElements;
+	names	fAttributes;
+
+	protected:
+				 xmlprofile() {}
+		virtual ~xmlprofile() {}
+
+	public:
+		static SMARTP<xmlprofile> create()	{ xmlprofile* o = new xmlprofile; assert(o!=0); return o; }
+		//! creates a predefined profile: "playback", "analysis" or "notation", returns 0 for unknown names
+		static SMARTP<xmlprofile> create(const std::string& preset);
+
+		//! excludes an element and its content
+		void	pruneElement (const std::string& name)		{ fElements.add (name); }
+		//! excludes an attribute
+		void	pruneAttribute (const std::string& name)	{ fAttributes.add (name); }
+
+		bool	prunedElement (const char* name) const		{ return fElements.match (name); }
+		bool	prunedAttribute (const char* name) const	{ return fAttributes.match (name); }
+};
+typedef SMARTP<xmlprofile> Sxmlprofile;
+
+/*! @} */
+
+}
+
+#endif
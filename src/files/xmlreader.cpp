@@ -14,12 +14,22 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <atomic>
 #include <iostream>
+#include <string.h>
+#include <thread>
+#include <utility>
+#include <vector>
 #include "xmlreader.h"
 #include "factory.h"
+#include "fastxml.h"
+#include "xmlscan.h"
 
 using namespace std;
 
+// libmxmllineno is outside of name space MusicXML2
+extern int libmxmllineno;
+
 namespace MusicXML2
 {
 
@@ -35,52 +45,286 @@ bool readbuffer (const char * buffer, reader * r);
 #define debug(str,val)
 #endif
 
+//_______________________________________________________________________________
+// reads a file text, UTF-16 is transcoded to UTF-8
+//_______________________________________________________________________________
+static bool readtext (const char* file, string& text)
+{
+	FILE* fd = fopen (file, "rb");
+	if (!fd) return false;
+	char buff[65536];
+	size_t n;
+	while ((n = fread (buff, 1, sizeof(buff), fd)) > 0)
+		text.append (buff, n);
+	fclose (fd);
+	xmlToUTF8 (text);
+	return true;
+}
+
+//_______________________________________________________________________________
+// the fast path gives up on documents it doesn't cover: the reader state is
+// then restored so that the document can be parsed again by the flex parser
+//_______________________________________________________________________________
+bool xmlreader::fastread(const char* buffer, size_t size)
+{
+	int lineno = libmxmllineno;
+	size_t measureIndex = fMeasureIndex;
+	if (fastreadbuffer (buffer, size, this)) return true;
+
+	libmxmllineno = lineno;
+	fMeasureIndex = measureIndex;
+	while (fStack.size()) fStack.pop();
+	fPruned.clear();
+	fFile = TXMLFile::create();
+	if (fValidator) fValidator->reset();
+	return false;
+}
+
 //_______________________________________________________________________________
 SXMLFile xmlreader::readbuff(const char* buffer)
 {
+	if (fValidator) fValidator->reset();
 	fFile = TXMLFile::create();
+	fPruned.clear();
 	debug("read buffer", '-');
+	if (buffer && fastread (buffer, strlen(buffer))) return fFile;
 	return readbuffer (buffer, this) ? fFile : 0;
 }
 
 //_______________________________________________________________________________
 SXMLFile xmlreader::read(const char* file)
 {
+	if (fValidator) fValidator->reset();
 	fFile = TXMLFile::create();
+	fPruned.clear();
 	debug("read", file);
+	string text;
+	if (readtext (file, text) && fastread (text.data(), text.size())) return fFile;
 	return readfile (file, this) ? fFile : 0;
 }
 
 //_______________________________________________________________________________
 SXMLFile xmlreader::read(FILE* file)
 {
+	if (fValidator) fValidator->reset();
 	fFile = TXMLFile::create();
+	fPruned.clear();
 	return readstream (file, this) ? fFile : 0;
 }
 
+//_______________________________________________________________________________
+// the parser expects a document type declaration: a dummy one is inserted on the
+// fragment first line so that the line numbers are preserved
+//_______________________________________________________________________________
+Sxmlelement xmlreader::readfragment(const char* buffer, int lineno)
+{
+	if (!buffer) return 0;
+	string doc = "<!DOCTYPE fragment SYSTEM \"\">";
+	doc += buffer;
+	libmxmllineno = lineno;
+	SXMLFile file = readbuff (doc.c_str());
+	return file ? file->elements() : 0;
+}
+
+//_______________________________________________________________________________
+// lazy mode: the skeleton is parsed and the measures subtrees are attached
+// to the measure elements in the document order (see endElement)
+//_______________________________________________________________________________
+SXMLFile xmlreader::readlazy(const Sxmlsource& src)
+{
+	src->fProfile = fProfile;
+	if (!fSkeleton.scan (src)) return 0;
+	fMeasureIndex = 0;
+	libmxmllineno = 1;
+	Sxmlvalidator validator = fValidator;		// the measures content is not available
+	fValidator = Sxmlvalidator();
+	SXMLFile file = readbuff (fSkeleton.fText.c_str());
+	fValidator = validator;
+	fSkeleton.fText.clear();
+	fSkeleton.fSubtrees.clear();
+	return file;
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::readlazybuff(const char* buffer)
+{
+	if (!buffer) return 0;
+	Sxmlsource src = xmlsource::create();
+	src->fText = buffer;
+	return readlazy (src);
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::readlazy(const char* file)
+{
+	Sxmlsource src = xmlsource::create();
+	if (!readtext (file, src->fText)) return read (file);
+	return readlazy (src);
+}
+
+//_______________________________________________________________________________
+// parallel mode: the document skeleton is read first, the elements that have been
+// removed from the skeleton are read concurrently and their content is attached to
+// the corresponding skeleton elements
+//_______________________________________________________________________________
+// collects the elements of a given name in the document order
+static void collect (const Sxmlelement& elt, const string& name, vector<Sxmlelement>& list)
+{
+	if (elt->getName() == name) list.push_back (elt);
+	for (ctree<xmlelement>::literator i = elt->lbegin(); i != elt->lend(); i++)
+		collect (*i, name, list);
+}
+
+//_______________________________________________________________________________
+// reads a single element using the fast parser, the elements line numbers are
+// maintained locally so that distinct readers can run concurrently
+//_______________________________________________________________________________
+Sxmlelement xmlreader::readelement(const char* buffer, size_t size, int lineno)
+{
+	fFile = TXMLFile::create();
+	while (fStack.size()) fStack.pop();
+	fPruned.clear();
+	fLineRef = &lineno;
+	bool done = fastreadelement (buffer, size, this, &lineno);
+	fLineRef = 0;
+	return done ? fFile->elements() : 0;
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::readparallel(const Sxmlsource& src, int threads)
+{
+	const string& text = src->fText;
+	if (threads <= 0) threads = int(thread::hardware_concurrency());
+	xmlskeleton skeleton;
+	string name = "part";
+	if ((threads < 2) || !skeleton.scan (src, name)) {
+		libmxmllineno = 1;
+		return readbuff (text.c_str());
+	}
+	if (skeleton.fSubtrees.size() < size_t(threads)) {
+		xmlskeleton measures;
+		if (measures.scan (src, "measure") && (measures.fSubtrees.size() > skeleton.fSubtrees.size())) {
+			skeleton.fText.swap (measures.fText);
+			skeleton.fSubtrees.swap (measures.fSubtrees);
+			name = "measure";
+		}
+	}
+
+	libmxmllineno = 1;
+	Sxmlvalidator validator = fValidator;		// the assembled document is validated
+	fValidator = Sxmlvalidator();
+	SXMLFile file = readbuff (skeleton.fText.c_str());
+	fValidator = validator;
+	vector<Sxmlelement> targets;
+	if (file && file->elements()) collect (file->elements(), name, targets);
+	const vector<Sxmlsubtree>& subtrees = skeleton.fSubtrees;
+	if (targets.size() != subtrees.size()) {		// the skeleton can't be read or doesn't match the scan
+		libmxmllineno = 1;
+		return readbuff (text.c_str());
+	}
+
+	// each thread reads the next pending subtree until all are done
+	// the threads readers refer to the profile: its ref count is atomic meanwhile
+	bool shared = fProfile && fProfile->shared();
+	if (fProfile) fProfile->setShared (true);
+	vector<Sxmlelement> results (subtrees.size());
+	atomic<size_t> next (0);
+	atomic<bool> failed (false);
+	auto work = [&] () {
+		xmlreader r;
+		r.fProfile = fProfile;
+		for (size_t i = next++; (i < subtrees.size()) && !failed; i = next++) {
+			const Sxmlsubtree& sub = subtrees[i];
+			if (!sub) continue;
+			results[i] = r.readelement (text.data() + sub->offset(), sub->length(), sub->line());
+			if (!results[i]) failed = true;
+		}
+	};
+	size_t n = min (size_t(threads), subtrees.size());
+	vector<thread> pool;
+	for (size_t i = 1; i < n; i++)
+		pool.push_back (thread (work));
+	work();
+	for (size_t i = 0; i < pool.size(); i++)
+		pool[i].join();
+	if (fProfile) fProfile->setShared (shared);
+
+	if (failed) {		// the fast parser gives up: the document is read as usual
+		libmxmllineno = 1;
+		return readbuff (text.c_str());
+	}
+	for (size_t i = 0; i < results.size(); i++) {
+		if (!results[i]) continue;
+		for (ctree<xmlelement>::literator e = results[i]->lbegin(); e != results[i]->lend(); e++)
+			targets[i]->push (*e);
+	}
+	if (fValidator) {
+		fValidator->reset();
+		fValidator->validate (file->elements());
+	}
+	return file;
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::readparallelbuff(const char* buffer, int threads)
+{
+	if (!buffer) return 0;
+	Sxmlsource src = xmlsource::create();
+	src->fText = buffer;
+	return readparallel (src, threads);
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::readparallel(const char* file, int threads)
+{
+	Sxmlsource src = xmlsource::create();
+	if (!readtext (file, src->fText)) return read (file);
+	return readparallel (src, threads);
+}
+
+//_______________________________________________________________________________
+// the elements line number is set by the factory using libmxmllineno, unless
+// the reader maintains its own line number
+//_______________________________________________________________________________
+Sxmlelement xmlreader::create(const char* eltName) const
+{
+	Sxmlelement elt = factory::instance().create(eltName);
+	if (elt && fLineRef) elt->setInputLineNumber (*fLineRef);
+	return elt;
+}
+
 //_______________________________________________________________________________
 void xmlreader::newComment (const char* comment)
 {
-	Sxmlelement elt = factory::instance().create("comment");
+	if (fPruned.size()) return;
+	Sxmlelement elt = create("comment");
 	elt->setValue(comment);
+	if (fValidator && fStack.size()) { fValidator->start (*elt); fValidator->end (*elt); }
 	// comments outside the xml hierarchy are lost
-	if (fStack.size()) fStack.top()->push(elt);
+	if (fStack.size()) fStack.top()->push(std::move(elt));
 }
 
 //_______________________________________________________________________________
 void xmlreader::newProcessingInstruction (const char* pi)
 {
-	Sxmlelement elt = factory::instance().create("pi");
+	if (fPruned.size()) return;
+	Sxmlelement elt = create("pi");
 	elt->setValue(pi);
+	if (fValidator && fStack.size()) { fValidator->start (*elt); fValidator->end (*elt); }
 	// processing instructions outside the xml hierarchy are lost
-	if (fStack.size()) fStack.top()->push(elt);
+	if (fStack.size()) fStack.top()->push(std::move(elt));
 }
 
 //_______________________________________________________________________________
 bool xmlreader::newElement (const char* eltName)
 {
 	debug("newElement", eltName);
-	Sxmlelement elt = factory::instance().create(eltName);
+	if (fPruned.size() || (fProfile && fProfile->prunedElement (eltName))) {
+		if (fValidator && fPruned.empty()) fValidator->skip();
+		fPruned.push_back (eltName);
+		return true;
+	}
+	Sxmlelement elt = create(eltName);
 	if (!elt) return false;
 	if (!fFile->elements()) {
 	debug("first element", eltName);
@@ -90,7 +334,8 @@ bool xmlreader::newElement (const char* eltName)
 	debug("push element", eltName);
 		fStack.top()->push(elt);
 	}
-	fStack.push(elt);
+	if (fValidator) fValidator->start (*elt);
+	fStack.push(std::move(elt));
 	return true;
 }
 
@@ -98,8 +343,20 @@ bool xmlreader::newElement (const char* eltName)
 bool xmlreader::endElement (const char* eltName)
 {
 	debug("endElement", eltName);
+	if (fPruned.size()) {
+		// a pruned measure subtree is dropped in lazy mode
+		if ((fMeasureIndex < fSkeleton.fSubtrees.size()) && !strcmp(eltName, "measure"))
+			fMeasureIndex++;
+		bool ok = (fPruned.back() == eltName);
+		fPruned.pop_back();
+		return ok;
+	}
 	Sxmlelement top = fStack.top();
 	fStack.pop();
+	if (fValidator) fValidator->end (*top);
+	// in lazy mode, the measure content is attached when the measure is complete
+	if ((fMeasureIndex < fSkeleton.fSubtrees.size()) && !strcmp(eltName, "measure"))
+		top->setLoader (fSkeleton.fSubtrees[fMeasureIndex++]);
 	return top->getName() == eltName;
 }
 
@@ -107,11 +364,12 @@ bool xmlreader::endElement (const char* eltName)
 bool xmlreader::newAttribute (const char* name, const char *value)
 {
 	debug("newAttribute", name);
+	if (fPruned.size() || (fProfile && fProfile->prunedAttribute (name))) return true;
 	Sxmlattribute attr = xmlattribute::create();
 	if (attr) {
 		attr->setName(name);
 		attr->setValue(value);
-		fStack.top()->add(attr);
+		fStack.top()->add(std::move(attr));
 		return true;
 	}
 	return false;
@@ -139,6 +397,7 @@ bool xmlreader::docType (const char* start, bool status, const char *pub, const
 void xmlreader::setValue (const char* value)
 {
 	debug("setValue", value);
+	if (fPruned.size()) return;
 	fStack.top()->setValue(value);
 }
 
@@ -15,8 +15,13 @@
 
 #include <stack>
 #include <stdio.h>
+#include <string>
+#include <vector>
 #include "exports.h"
 #include "xmlfile.h"
+#include "xmlprofile.h"
+#include "xmlsubtree.h"
+#include "xmlvalidator.h"
 #include "reader.h"
 
 namespace MusicXML2 
@@ -27,14 +32,77 @@ class EXP xmlreader : public reader
 { 
 	std::stack<Sxmlelement>	fStack;
 	SXMLFile				fFile;
+	xmlskeleton				fSkeleton;		// the document skeleton in lazy mode
+	size_t					fMeasureIndex;	// the current measure index in lazy mode
+	int*					fLineRef;		// the current line number when it's not libmxmllineno
+	Sxmlprofile				fProfile;		// the pruning profile
+	Sxmlvalidator			fValidator;		// the validator, when validating at parse time
+	std::vector<std::string> fPruned;		// the stack of the pruned elements being read
+
+	SXMLFile	readlazy(const Sxmlsource& src);
+	SXMLFile	readparallel(const Sxmlsource& src, int threads);
+	bool		fastread(const char* buffer, size_t size);
+	Sxmlelement	readelement(const char* buffer, size_t size, int lineno);
+	Sxmlelement	create(const char* eltName) const;
 
 	public:
-				 xmlreader() {}
+				 xmlreader() : fMeasureIndex(0), fLineRef(0) {}
 		virtual ~xmlreader() {}
 		
+		/*! \brief sets a pruning profile
+
+			The elements and attributes excluded by the profile are skipped at parse time
+			(they are not built). The profile applies to all the reading modes.
+			\param profile the profile, 0 to read the whole document
+		*/
+		void	 setProfile(const Sxmlprofile& profile)	{ fProfile = profile; }
+		const Sxmlprofile& getProfile() const			{ return fProfile; }
+
+		/*! \brief sets a validator
+
+			The documents are validated while they are parsed, the validator
+			gives the errors of the last document read.
+			Validation applies to \c read, \c readbuff and \c readfragment. With \c readparallel,
+			the document is validated once assembled. Documents read in lazy mode are
+			not validated: the measures content is not available at parse time.
+			Note that the content of the elements pruned by a profile is not checked
+			and that pruned attributes are reported when they are required (see setProfile).
+			\param validator the validator, 0 to disable validation
+		*/
+		void	 setValidator(const Sxmlvalidator& validator)	{ fValidator = validator; }
+		const Sxmlvalidator& getValidator() const			{ return fValidator; }
+
 		SXMLFile readbuff(const char* file);
 		SXMLFile read(const char* file);
 		SXMLFile read(FILE* file);
+		//! reads an element without xml declaration and doctype (e.g. a single measure), lineno is the line number of the first line
+		Sxmlelement readfragment(const char* buffer, int lineno=1);
+
+		/*! \brief reads a file in lazy mode
+		
+			In lazy mode, the document structure is scanned first and the \e measure
+			elements are built without their content. A measure content is parsed at its
+			first access (using \c elements() or a browser). It saves the parsing cost
+			of the measures that are never accessed.
+			Note that in lazy mode, syntax errors inside measures are reported at access time.
+		*/
+		SXMLFile readlazy(const char* file);
+		//! reads a buffer in lazy mode
+		SXMLFile readlazybuff(const char* buffer);
+
+		/*! \brief reads a file using several threads
+
+			The document is split at the \e part elements (or at the \e measure elements
+			when there are less parts than threads). The parts are parsed concurrently
+			and attached to the document skeleton in the document order: the result is the
+			same as with \c read, including the elements line numbers.
+			When the document can't be split, it is read as usual.
+			\param file the file name
+			\param threads the number of threads, 0 to use the hardware concurrency
+		*/
+		SXMLFile readparallel(const char* file, int threads=0);
+		//! reads a buffer using several threads
+		SXMLFile readparallelbuff(const char* buffer, int threads=0);
 
 		bool	xmlDecl (const char* version, const char *encoding, int standalone);
 		bool	docType (const char* start, bool status, const char *pub, const char *sys);
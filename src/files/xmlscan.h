@@ -0,0 +1,102 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmlscan__
+#define __xmlscan__
+
+#include <string>
+#include <string.h>
+#include "utf16.h"
+
+namespace MusicXML2
+{
+
+/*
+	Helpers for the structural scanners: they operate on a document text
+	and give the position of the last char of a markup or npos when the
+	markup is not terminated.
+*/
+
+//______________________________________________________________________________
+// gives the position of the end of a tag, quoted attributes values are skipped
+inline size_t xmlTagEnd (const std::string& text, size_t pos)
+{
+	char quote = 0;
+	for (size_t n = text.size(); pos < n; pos++) {
+		char c = text[pos];
+		if (quote) { if (c == quote) quote = 0; }
+		else if ((c == '"') || (c == '\'')) quote = c;
+		else if (c == '>') return pos;
+	}
+	return std::string::npos;
+}
+
+//______________________________________________________________________________
+// gives the position of the end of a doctype declaration (possibly including an internal subset)
+inline size_t xmlDoctypeEnd (const std::string& text, size_t pos)
+{
+	int depth = 0;
+	for (size_t n = text.size(); pos < n; pos++) {
+		char c = text[pos];
+		if (c == '[') depth++;
+		else if (c == ']') depth--;
+		else if ((c == '>') && (depth == 0)) return pos;
+	}
+	return std::string::npos;
+}
+
+//______________________________________________________________________________
+// gives the position of the end of a markup terminated by a given string
+inline size_t xmlMarkupEnd (const std::string& text, size_t pos, const char* terminator)
+{
+	size_t end = text.find (terminator, pos + 2);
+	return (end == std::string::npos) ? end : end + strlen(terminator) - 1;
+}
+
+//______________________________________________________________________________
+// gives the position of the end of any markup starting at pos
+inline size_t xmlAnyMarkupEnd (const std::string& text, size_t pos)
+{
+	if (!text.compare (pos, 4, "<!--"))				return xmlMarkupEnd (text, pos, "-->");
+	else if (!text.compare (pos, 9, "<![CDATA["))	return xmlMarkupEnd (text, pos, "]]>");
+	else if (!text.compare (pos, 2, "<?"))			return xmlMarkupEnd (text, pos, "?>");
+	else if (!text.compare (pos, 9, "<!DOCTYPE"))	return xmlDoctypeEnd (text, pos);
+	return xmlTagEnd (text, pos);
+}
+
+//______________________________________________________________________________
+// checks for the end of an element name
+inline bool xmlIsNameEnd (const std::string& text, size_t pos)
+{
+	if (pos >= text.size()) return true;
+	switch (text[pos]) {
+		case ' ': case '\t': case '\r': case '\n': case '/': case '>':
+			return true;
+	}
+	return false;
+}
+
+//______________________________________________________________________________
+// converts a UTF-16 text (with a byte order mark) to UTF-8, other texts are unchanged
+inline void xmlToUTF8 (std::string& text)
+{
+	int bom = utf16bom (text.data(), text.size());
+	if (bom == kNoBOM) return;
+	std::string utf8 ((text.size() / 2) * 3, 0);
+	size_t n = utf16toutf8 (text.data() + 2, text.size() - 2, bom == kUTF16BE, &utf8[0], 0, 1);
+	utf8.resize (n);
+	text.swap (utf8);
+}
+
+}
+
+#endif
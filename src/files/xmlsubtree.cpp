@@ -0,0 +1,96 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <algorithm>
+#include <iostream>
+
+#include "xmlreader.h"
+#include "xmlscan.h"
+#include "xmlsubtree.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+void xmlsubtree::load (xmlelement& node)
+{
+	xmlreader r;
+	r.setProfile (fSource->fProfile);
+	string text = fSource->fText.substr (fOffset, fLength);
+	Sxmlelement elt = r.readfragment (text.c_str(), fLine);
+	if (!elt) {
+		cerr << "can't read " << node.getName() << " content on line " << fLine << endl;
+		return;
+	}
+	for (ctree<xmlelement>::literator i = elt->lbegin(); i != elt->lend(); i++)
+		node.push (*i);
+}
+
+//______________________________________________________________________________
+// xmlskeleton
+//______________________________________________________________________________
+bool xmlskeleton::scan (const Sxmlsource& src, const string& name)
+{
+	const string& text = src->fText;
+	const string tag = "<" + name, endtag = "</" + name;
+	size_t pos = 0;
+	int line = 1;
+
+	fText.clear();
+	fSubtrees.clear();
+	fText.reserve (text.size() / 4);
+	while (true) {
+		size_t start = text.find ('<', pos);
+		if (start == string::npos) {
+			fText.append (text, pos, string::npos);
+			return true;
+		}
+		fText.append (text, pos, start - pos);
+		line += int(count (text.begin() + pos, text.begin() + start, '\n'));
+
+		size_t end = xmlAnyMarkupEnd (text, start);
+		if (end == string::npos) return false;	// unterminated markup
+
+		bool elt = !text.compare (start, tag.size(), tag) && xmlIsNameEnd (text, start + tag.size());
+		if (!elt || (text[end-1] == '/')) {
+			// any markup but a non empty start tag of the element is kept unchanged
+			if (elt) fSubtrees.push_back (0);
+			fText.append (text, start, end + 1 - start);
+			line += int(count (text.begin() + start, text.begin() + end, '\n'));
+			pos = end + 1;
+			continue;
+		}
+
+		// looks for the element end tag (the element is not expected to be nested)
+		size_t close = text.find (endtag, end);
+		while ((close != string::npos) && !xmlIsNameEnd (text, close + endtag.size()))
+			close = text.find (endtag, close + endtag.size());
+		size_t closeEnd = (close == string::npos) ? close : text.find ('>', close);
+		if (closeEnd == string::npos) return false;
+
+		fSubtrees.push_back (xmlsubtree::create (src, start, closeEnd + 1 - start, line));
+		// the start tag is kept, the element content is replaced by its end of lines
+		fText.append (text, start, end + 1 - start);
+		fText.append (size_t(count (text.begin() + end, text.begin() + close, '\n')), '\n');
+		fText.append (text, close, closeEnd + 1 - close);
+		line += int(count (text.begin() + start, text.begin() + closeEnd, '\n'));
+		pos = closeEnd + 1;
+	}
+}
+
+}
@@ -0,0 +1,98 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmlsubtree__
+#define __xmlsubtree__
+
+#include <string>
+#include <vector>
+
+#include "exports.h"
+#include "ctree.h"
+#include "smartpointer.h"
+#include "xml.h"
+#include "xmlprofile.h"
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+/*!
+\brief the text of a document shared by its deferred subtrees, and the reader profile
+*/
+class EXP xmlsource : public smartable
+{
+	public:
+		static SMARTP<xmlsource> create()	{ xmlsource* o = new xmlsource; assert(o!=0); return o; }
+
+		std::string	fText;
+		Sxmlprofile	fProfile;	///< the pruning profile used to read the subtrees
+
+	protected:
+				 xmlsource() {}
+		virtual ~xmlsource() {}
+};
+typedef SMARTP<xmlsource> Sxmlsource;
+
+//______________________________________________________________________________
+/*!
+\brief a deferred subtree: a location in the document text
+
+	The subtree is parsed and its sub elements are pushed to the
+	target element at first access to the element content.
+*/
+class EXP xmlsubtree : public ctreeloader<xmlelement>
+{
+	Sxmlsource	fSource;
+	size_t		fOffset, fLength;	// the subtree location in the source text
+	int			fLine;				// the subtree first line number
+
+	protected:
+				 xmlsubtree(const Sxmlsource& src, size_t offset, size_t length, int line)
+					: fSource(src), fOffset(offset), fLength(length), fLine(line) {}
+		virtual ~xmlsubtree() {}
+
+	public:
+		static SMARTP<xmlsubtree> create(const Sxmlsource& src, size_t offset, size_t length, int line)
+			{ xmlsubtree* o = new xmlsubtree(src, offset, length, line); assert(o!=0); return o; }
+
+		size_t	offset() const		{ return fOffset; }
+		size_t	length() const		{ return fLength; }
+		int		line() const		{ return fLine; }
+		const Sxmlsource& source() const	{ return fSource; }
+
+		virtual void load (xmlelement& node);
+};
+typedef SMARTP<xmlsubtree> Sxmlsubtree;
+
+//______________________________________________________________________________
+/*!
+\brief a fast structural scan of a document
+
+	The scanner builds a skeleton of the document where the content of the \e measure
+	elements (or of any other non nested element) is removed, except the end of lines
+	so that the line numbers are preserved. The location of each of these elements is
+	stored in a subtree, in the document order. Empty elements have a null subtree.
+*/
+class EXP xmlskeleton
+{
+	public:
+		std::string					fText;		///< the document skeleton
+		std::vector<Sxmlsubtree>	fSubtrees;	///< the elements subtrees in the document order
+
+		//! scans the source text for a given element, returns false when the source can't be scanned
+		bool scan (const Sxmlsource& src, const std::string& name = "measure");
+};
+
+}
+
+#endif
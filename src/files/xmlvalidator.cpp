@@ -0,0 +1,165 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include "elements.h"
+#include "elementsinfo.h"
+#include "numbers.h"
+#include "tree_walker.h"
+#include "xml_tree_browser.h"
+#include "xmlvalidator.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+static bool blank (const string& str)
+{
+	for (size_t i = 0; i < str.size(); i++) {
+		char c = str[i];
+		if ((c != ' ') && (c != '\t') && (c != '\n') && (c != '\r')) return false;
+	}
+	return true;
+}
+
+//______________________________________________________________________________
+void xmlvalidator::report (int type, const xmlelement& elt, const string& msg)
+{
+	error e;
+	e.type = type;
+	e.line = elt.getInputLineNumber();
+	e.message = msg;
+	fErrors.push_back (e);
+}
+
+//______________________________________________________________________________
+void xmlvalidator::start (const xmlelement& elt)
+{
+	int type = elt.getType();
+	const elementinfo& info = elementinfo::get (type);
+	if (fStack.size()) {
+		frame& parent = fStack.back();
+		if (parent.checked && !parent.info->allows (type))
+			report (kUnknownElement, elt, "element " + elt.getName() + " not allowed in " + parent.info->name);
+		else if (parent.checked && parent.info->model && (type != kComment) && (type != kProcessingInstruction)) {
+			int next = parent.info->model->next (parent.state, type);
+			if (next < 0) {
+				report (kMisplacedElement, elt, "misplaced element " + elt.getName() + " in " + parent.info->name);
+				next = parent.info->model->resync (type);		// continues from the element
+				parent.state = (next < 0) ? parent.state : next;
+			}
+			else parent.state = next;
+		}
+	}
+	frame f = { &info, 0, (type != kNoElement) };
+	fStack.push_back (f);
+}
+
+//______________________________________________________________________________
+void xmlvalidator::end (const xmlelement& elt)
+{
+	if (fStack.empty()) return;
+	frame f = fStack.back();
+	fStack.pop_back();
+	const elementinfo& info = *f.info;
+	if ((info.content == kUndeclared) || (info.content == kAnyContent)) return;
+	checkAttributes (info, elt);
+	checkValue (info, elt);
+	if (f.checked) checkEnd (info, f.state, elt);
+}
+
+//______________________________________________________________________________
+void xmlvalidator::skip ()
+{
+	if (fStack.size()) fStack.back().checked = false;
+}
+
+//______________________________________________________________________________
+void xmlvalidator::checkAttributes (const elementinfo& info, const xmlelement& elt)
+{
+	const vector<Sxmlattribute>& attributes = elt.attributes();
+	for (size_t i = 0; i < attributes.size(); i++) {
+		const xmlattribute* attr = attributes[i];
+		const attributeinfo* ainfo = info.attribute (attr->getName().c_str());
+		if (!ainfo)
+			report (kUnknownAttribute, elt, "undeclared attribute " + attr->getName() + " in " + info.name);
+		else if (!ainfo->accepts (attr->getValue().c_str()))
+			report (kInvalidAttributeValue, elt, "invalid value \"" + attr->getValue() + "\" for attribute " + attr->getName() + " in " + info.name);
+	}
+	for (const attributeinfo* a = info.attributes; a && a->name; a++) {
+		if (!(a->flags & kRequiredAttribute)) continue;
+		size_t i = 0;
+		while ((i < attributes.size()) && (attributes[i]->getName() != a->name)) i++;
+		if (i == attributes.size())
+			report (kMissingAttribute, elt, string("missing required attribute ") + a->name + " in " + info.name);
+	}
+}
+
+//______________________________________________________________________________
+void xmlvalidator::checkValue (const elementinfo& info, const xmlelement& elt)
+{
+	const string& value = elt.getValue();
+	if ((info.content == kEmptyContent) || (info.content == kElementsContent)) {
+		if (!blank (value))
+			report (kUnexpectedText, elt, string("unexpected text in ") + info.name);
+	}
+	else if (info.value == kNumericValue) {
+		double v;
+		const char* str = value.c_str();
+		const char* end = parseFloat (str, v);
+		bool valid = (end != str);
+		for (; valid && *end; end++)
+			valid = (*end == ' ') || (*end == '\t') || (*end == '\n') || (*end == '\r');
+		if (!valid)
+			report (kInvalidValue, elt, "invalid value \"" + value + "\" for " + info.name + ": a number is expected");
+	}
+}
+
+//______________________________________________________________________________
+void xmlvalidator::checkEnd (const elementinfo& info, int state, const xmlelement& elt)
+{
+	const contentmodel* model = info.model;
+	if (!model || model->final (state)) return;
+	string expected;
+	for (int i = model->offsets[state]; i < model->offsets[state+1]; i++) {
+		if (expected.size()) expected += ", ";
+		expected += elementinfo::get (model->transitions[i].type).name;
+	}
+	report (kIncompleteContent, elt, string("incomplete content in ") + info.name + ", expecting " + expected);
+}
+
+//______________________________________________________________________________
+bool xmlvalidator::validate (const Sxmlelement& elt)
+{
+	if (!elt) return true;
+	size_t errors = fErrors.size();
+	fStack.clear();
+	xml_tree_walker w (*elt);
+	for (xml_tree_walker::event e = w.next(); e.node; e = w.next()) {
+		if (e.phase == xml_tree_walker::kEnter) start (*e.node);
+		else end (*e.node);
+	}
+	return fErrors.size() == errors;
+}
+
+//______________________________________________________________________________
+void xmlvalidator::print (ostream& out) const
+{
+	for (size_t i = 0; i < fErrors.size(); i++)
+		out << "line " << fErrors[i].line << ": " << fErrors[i].message << endl;
+}
+
+}
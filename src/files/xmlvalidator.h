@@ -0,0 +1,109 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmlvalidator__
+#define __xmlvalidator__
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "exports.h"
+#include "smartpointer.h"
+#include "xml.h"
+
+namespace MusicXML2
+{
+
+struct elementinfo;
+
+/*!
+\addtogroup MusicXML
+@{
+*/
+
+//______________________________________________________________________________
+/*!
+\brief A MusicXML validator.
+
+	The validator checks the elements content, the attributes and the elements
+	values using the content models automata and the metadata generated from the
+	DTD (see elementinfo). It reports the violations with their line numbers.
+
+	A tree may be validated using \c validate. The validator may also be attached
+	to a reader (see xmlreader::setValidator) to validate the documents while they
+	are parsed: the elements are then given in document order using \c start and
+	\c end.
+*/
+class EXP xmlvalidator : public smartable
+{
+	public:
+		enum errortype {
+			kUnknownElement,		//!< an element not allowed in its parent
+			kMisplacedElement,		//!< an allowed element that violates the content model order
+			kIncompleteContent,		//!< missing elements at the end of a content
+			kUnexpectedText,		//!< text in an element content or in an empty element
+			kInvalidValue,			//!< an element value that doesn't match its type
+			kUnknownAttribute,		//!< an undeclared attribute
+			kMissingAttribute,		//!< a missing required attribute
+			kInvalidAttributeValue	//!< an attribute value that is not in the enumerated values
+		};
+		struct error {
+			int			type;
+			int			line;
+			std::string	message;
+		};
+
+	private:
+		struct frame {
+			const elementinfo*	info;
+			int					state;		// the content model state
+			bool				checked;	// false when the content can't be checked (e.g. pruned elements)
+		};
+		std::vector<frame>	fStack;
+		std::vector<error>	fErrors;
+
+		void	report (int type, const xmlelement& elt, const std::string& msg);
+		void	checkAttributes (const elementinfo& info, const xmlelement& elt);
+		void	checkValue (const elementinfo& info, const xmlelement& elt);
+		void	checkEnd (const elementinfo& info, int state, const xmlelement& elt);
+
+	protected:
+				 xmlvalidator() {}
+		virtual ~xmlvalidator() {}
+
+	public:
+		static SMARTP<xmlvalidator> create()	{ xmlvalidator* o = new xmlvalidator; assert(o!=0); return o; }
+
+		//! validates a tree, returns true when no error is found
+		bool	validate (const Sxmlelement& elt);
+
+		//! starts an element: its place in the current content is checked
+		void	start (const xmlelement& elt);
+		//! ends the current element: its attributes, its value and the end of its content are checked
+		void	end (const xmlelement& elt);
+		//! indicates that an element has been skipped: the current content can't be checked
+		void	skip ();
+
+		//! clears the errors and the validation state
+		void	reset ()							{ fStack.clear(); fErrors.clear(); }
+		const std::vector<error>& errors() const	{ return fErrors; }
+		//! prints the errors, one per line
+		void	print (std::ostream& out) const;
+};
+typedef SMARTP<xmlvalidator> Sxmlvalidator;
+
+/*! @} */
+
+}
+
+#endif
@@ -11,7 +11,9 @@
 */
 
 #include <sstream>
+#include <utility>
 #include "guido.h"
+#include "numbers.h"
 
 using namespace std;
 
@@ -40,13 +42,23 @@ Sguidotag guidotag::create(string name)	{ guidotag* o = new guidotag(name); asse
 Sguidotag guidotag::create(string name, string sep)	{ guidotag* o = new guidotag(name, sep); assert(o!=0); return o;}
 
 //______________________________________________________________________________
-guidonotestatus* guidonotestatus::fInstances[kMaxInstances] = { 0 };
+// the notes status is maintained per thread so that several scores can be
+// converted concurrently, it is released when the thread exits
+namespace {
+struct notestatusinstances {
+	guidonotestatus* fInstances[guidonotestatus::kMaxInstances];
+	 notestatusinstances()	{ for (int i=0; i<guidonotestatus::kMaxInstances; i++) fInstances[i] = 0; }
+	~notestatusinstances()	{ for (int i=0; i<guidonotestatus::kMaxInstances; i++) delete fInstances[i]; }
+};
+thread_local notestatusinstances gNoteStatus;
+}
+
 guidonotestatus* guidonotestatus::get (unsigned short voice)
 { 
     if (voice < kMaxInstances) {
-        if (!fInstances[voice])
-            fInstances[voice] = new guidonotestatus; 
-        return fInstances[voice];
+        if (!gNoteStatus.fInstances[voice])
+            gNoteStatus.fInstances[voice] = new guidonotestatus; 
+        return gNoteStatus.fInstances[voice];
     }
     return 0;
 }
@@ -54,15 +66,15 @@ guidonotestatus* guidonotestatus::get (unsigned short voice)
 void guidonotestatus::resetall ()
 { 
     for (int i=0; i<kMaxInstances; i++) {
-        if (fInstances[i]) fInstances[i]->reset();
+        if (gNoteStatus.fInstances[i]) gNoteStatus.fInstances[i]->reset();
     }
 }
 
 void guidonotestatus::freeall ()
 { 
     for (int i=0; i<kMaxInstances; i++) {
-        delete fInstances[i];
-		fInstances[i] = 0;
+        delete gNoteStatus.fInstances[i];
+		gNoteStatus.fInstances[i] = 0;
     }
 }
 
@@ -76,9 +88,8 @@ void guidoparam::set (string value, bool quote)
 //______________________________________________________________________________
 void guidoparam::set (long value, bool quote)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	char buff[kMaxNumberSize];
+	fValue.assign (buff, formatInt (value, buff));
 	fQuote = quote;
 }
 
@@ -87,12 +98,16 @@ long guidoelement::add (Sguidoelement& elt)	{
 	fElements.push_back(elt); 
 	return fElements.size()-1;
 }
+long guidoelement::add (Sguidoelement&& elt)	{ 
+	fElements.push_back(std::move(elt)); 
+	return fElements.size()-1;
+}
 long guidoelement::add (Sguidoparam& param) { 
 	fParams.push_back(param); 
 	return fParams.size()-1;
 }
 long guidoelement::add (Sguidoparam param) { 
-	fParams.push_back(param); 
+	fParams.push_back(std::move(param)); 
 	return fParams.size()-1;
 }
 
@@ -186,7 +201,7 @@ ostream& operator<< (ostream& os, const Sguidoelement& elt)
 void guidonote::set (unsigned short voice, string name, char octave, guidonoteduration& dur, string acc)
 {
     guidonotestatus * status = guidonotestatus::get(voice);
-    stringstream s;
+    char buff[kMaxNumberSize];
     long dots = dur.fDots;
     
  	fNote = name;
@@ -194,16 +209,16 @@ void guidonote::set (unsigned short voice, string name, char octave, guidonotedu
 	fOctave = octave;
 	fDuration = dur;
 	
-	s << name;
+	fName = name;
     // octave is ignored in case of rests
 	if (name[0] != '_') {
 		if (!acc.empty())
-			s << acc;
+			fName += acc;
 		if (name != "empty") {
 			if (!status)
-				s << (int)octave;
+				fName.append (buff, formatInt ((int)octave, buff));
 			else if (status->fOctave != octave) {
-				s << (int)octave;
+				fName.append (buff, formatInt ((int)octave, buff));
 				status->fOctave = octave;
 			}
 		}
@@ -211,14 +226,15 @@ void guidonote::set (unsigned short voice, string name, char octave, guidonotedu
     //// AC Note 20/02/2017: Not generating Durations, causes problems on multi-voice scores with Pickup measures!
 	//if (!status || (*status != dur)) {
         if (dur.fNum != 1) {
-            s << "*" << (int)dur.fNum;
+            fName += '*';
+            fName.append (buff, formatInt ((int)dur.fNum, buff));
         }
-        s << "/" << (int)dur.fDenom;
+        fName += '/';
+        fName.append (buff, formatInt ((int)dur.fDenom, buff));
         if (status) *status = dur;
     //}
     while (dots-- > 0)
-        s << ".";
-    s >> fName;
+        fName += '.';
 }
 
 //______________________________________________________________________________
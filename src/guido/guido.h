@@ -75,6 +75,7 @@ class EXP guidoelement : public smartable {
         static SMARTP<guidoelement> create(std::string name, std::string sep=" ");
 		
 		long add (Sguidoelement& elt);
+		long add (Sguidoelement&& elt);
 		long add (Sguidoparam& param);
 		long add (Sguidoparam param);
 		virtual void print (std::ostream& os) const;
@@ -243,8 +244,6 @@ class EXP guidonotestatus {
 
 	protected:
 		guidonotestatus() :	fOctave(defoctave), fDur(defnum, defdenom, 0) {}
-	private:
-		static guidonotestatus * fInstances[kMaxInstances];
 };
 
 /*!
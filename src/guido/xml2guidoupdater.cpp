@@ -0,0 +1,121 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <iostream>
+#include <set>
+
+#include "elements.h"
+#include "xml2guidoupdater.h"
+#include "xmlreader.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+xml2guidoupdater::xml2guidoupdater(bool generateComments, bool generateStem, bool generateBar)
+	: fGenerateComments(generateComments), fGenerateStem(generateStem), fGenerateBars(generateBar)
+{
+}
+
+//______________________________________________________________________________
+Sguidoelement xml2guidoupdater::convert (const SXMLFile& file)
+{
+	fFile = SXMLFile();
+	fGuido = Sguidoelement();
+	fParts.clear();
+
+	Sxmlelement score = file ? file->elements() : 0;
+	if (!score || (score->getName() == "score-timewise")) return 0;
+
+	xml2guidovisitor v(fGenerateComments, fGenerateStem, fGenerateBars);
+	fGuido = v.convert(score);
+	if (fGuido) {
+		fFile = file;
+		fParts = v.getPartsConversion();
+	}
+	return fGuido;
+}
+
+//______________________________________________________________________________
+Sxmlelement xml2guidoupdater::findPart (const Sxmlelement& score, const string& id) const
+{
+	for (ctree<xmlelement>::literator i = score->lbegin(); i != score->lend(); i++) {
+		if (((*i)->getType() == k_part) && ((*i)->getAttributeValue("id") == id))
+			return *i;
+	}
+	return 0;
+}
+
+//______________________________________________________________________________
+ctree<xmlelement>::literator xml2guidoupdater::findMeasure (const Sxmlelement& part, const string& number) const
+{
+	ctree<xmlelement>::literator i;
+	for (i = part->lbegin(); i != part->lend(); i++) {
+		if (((*i)->getType() == k_measure) && ((*i)->getAttributeValue("number") == number))
+			break;
+	}
+	return i;
+}
+
+//______________________________________________________________________________
+// all the measures are parsed and located before the score is modified
+// so that an invalid change leaves the score unchanged
+//______________________________________________________________________________
+Sguidoelement xml2guidoupdater::update (const vector<measureChange>& changes)
+{
+	Sxmlelement score = fFile ? fFile->elements() : 0;
+	if (!score || !fGuido) return 0;
+
+	vector<Sxmlelement> parts;
+	vector<int> targets;
+	vector<Sxmlelement> measures;
+	for (vector<measureChange>::const_iterator i = changes.begin(); i != changes.end(); i++) {
+		Sxmlelement part = findPart (score, i->fPartID);
+		if (!part) {
+			cerr << "xml2guidoupdater: unknown part " << i->fPartID << endl;
+			return 0;
+		}
+		ctree<xmlelement>::literator target = findMeasure (part, i->fNumber);
+		if (target == part->lend()) {
+			cerr << "xml2guidoupdater: unknown measure " << i->fNumber << " in part " << i->fPartID << endl;
+			return 0;
+		}
+		xmlreader r;
+		Sxmlelement measure = r.readfragment (i->fXML.c_str(), (*target)->getInputLineNumber());
+		if (!measure || (measure->getType() != k_measure)) {
+			cerr << "xml2guidoupdater: invalid measure " << i->fNumber << " in part " << i->fPartID << endl;
+			return 0;
+		}
+		parts.push_back (part);
+		targets.push_back (int(target - part->lbegin()));
+		measures.push_back (measure);
+	}
+
+	set<string> changed;
+	for (size_t i = 0; i < measures.size(); i++) {
+		parts[i]->replace (targets[i], measures[i]);
+		changed.insert (parts[i]->getAttributeValue("id"));
+	}
+
+	xml2guidovisitor v(fGenerateComments, fGenerateStem, fGenerateBars);
+	fGuido = v.convert(score, fParts, changed);
+	fParts = v.getPartsConversion();
+	return fGuido;
+}
+
+}
@@ -0,0 +1,96 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xml2guidoupdater__
+#define __xml2guidoupdater__
+
+#include <string>
+#include <vector>
+
+#include "exports.h"
+#include "guido.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xml2guidovisitor.h"
+
+namespace MusicXML2
+{
+
+/*!
+\ingroup visitors guido
+@{
+*/
+
+/*!
+\brief Incremental conversion of a score to the Guido format.
+
+	The updater keeps a parsed score and its guido conversion. Edited measures
+	are parsed alone and replace the corresponding measures in the score tree.
+	Only the parts that contain edited measures are converted again, the guido
+	sequences of the other parts are reused from the previous conversion.
+
+	Note that the update granularity is the part, not the measure: a part is converted
+	as a whole since the part conversion looks ahead for slurs and wedges ends and keeps
+	a state along the measures (voices, staves, ties, beams), thus it can't be restarted
+	in the middle of a part. Editing a single measure costs the conversion of its whole
+	part, and a single part score is fully converted again at each update: for such a
+	score, the only gain is that the unchanged measures are not parsed again.
+*/
+//______________________________________________________________________________
+class EXP xml2guidoupdater
+{
+	public:
+		/*!
+		\brief a measure change: the measure \c fNumber of the part \c fPartID is replaced by \c fXML
+
+			\c fXML is expected to be a complete 'measure' element.
+		*/
+		typedef struct {
+			std::string		fPartID;
+			std::string		fNumber;
+			std::string		fXML;
+		} measureChange;
+
+				 xml2guidoupdater(bool generateComments, bool generateStem, bool generateBar=true);
+		virtual ~xml2guidoupdater() {}
+
+		/*! \brief converts a score and keeps the parse and conversion state for further updates
+			\return the guido score or 0 when the score can't be converted
+		*/
+		Sguidoelement	convert (const SXMLFile& file);
+
+		/*! \brief applies changes to the current score and updates the guido score
+			\param changes a list of measures changes
+			\return the updated guido score or 0 in case of error (no previous conversion,
+			unknown part or measure, invalid measure). The current score is left unchanged in case of error.
+		*/
+		Sguidoelement	update  (const std::vector<measureChange>& changes);
+
+		SXMLFile		getFile () const		{ return fFile; }
+		Sguidoelement	getGuido () const		{ return fGuido; }
+
+	private:
+		bool			fGenerateComments, fGenerateStem, fGenerateBars;
+		SXMLFile		fFile;
+		Sguidoelement	fGuido;
+		partConversions	fParts;
+
+		Sxmlelement					findPart	(const Sxmlelement& score, const std::string& id) const;
+		ctree<xmlelement>::literator findMeasure (const Sxmlelement& part, const std::string& number) const;
+};
+
+/*! @} */
+
+} // namespace MusicXML2
+
+
+#endif
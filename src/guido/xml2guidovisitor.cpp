@@ -14,13 +14,16 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <string>
 
+#include "numbers.h"
 #include "partsummary.h"
+#include "range_xml_tree_browser.h"
 #include "rational.h"
-#include "xml_tree_browser.h"
+#include "static_tree_browser.h"
 #include "xml2guidovisitor.h"
 #include "xmlpart2guido.h"
 #include "tree_browser.h"
@@ -30,14 +33,13 @@ using namespace std;
 
 namespace MusicXML2
 {
-    int xml2guidovisitor::defaultGuidoStaffDistance = 0;
-    int xml2guidovisitor::defaultStaffDistance = 0;
-    
     //______________________________________________________________________________
     xml2guidovisitor::xml2guidovisitor(bool generateComments, bool generateStem, bool generateBar, int partNum) :
     fGenerateComments(generateComments), fGenerateStem(generateStem),
     fGenerateBars(generateBar), fGeneratePositions(true),
-    fCurrentStaffIndex(0), previousStaffHasLyrics(false), fCurrentAccoladeIndex(0), fPartNum(partNum)
+    fCurrentStaffIndex(0), fPrevious(0), fChanged(0), fHeaderFlushed(false),
+    previousStaffHasLyrics(false), fCurrentAccoladeIndex(0), fPartNum(partNum),
+    defaultStaffDistance(0), defaultGuidoStaffDistance(0)
     {
         timePositions.clear();
     }
@@ -47,13 +49,88 @@ namespace MusicXML2
     {
         Sguidoelement gmn;
         if (xml) {
-            tree_browser<xmlelement> browser(this);
+            fParts.clear();
+            // parts out of range are skipped at browse time, the measures range is handled at part level
+            static_tree_browser<xml2guidovisitor, range_xml_tree_browser> browser(this, scorerange(fRange.fFirstPart, fRange.fLastPart));
             browser.browse(*xml);
             gmn = current();
         }
         return gmn;
     }
     
+    //______________________________________________________________________________
+    // the score top level elements are browsed one by one so that unchanged parts
+    // can be skipped without visiting their content
+    //______________________________________________________________________________
+    Sguidoelement xml2guidovisitor::convert (const Sxmlelement& xml, const partConversions& previous, const set<string>& changed)
+    {
+        Sguidoelement gmn;
+        if (xml) {
+            fParts.clear();
+            fPrevious = &previous;
+            fChanged = &changed;
+            static_tree_browser<xml2guidovisitor> browser(this);
+            xml->acceptIn (*this);
+            for (ctree<xmlelement>::literator i = xml->lbegin(); i != xml->lend(); i++) {
+                if (((*i)->getType() == k_part) && reusePart(*i)) continue;
+                browser.browse(**i);
+            }
+            xml->acceptOut (*this);
+            fPrevious = 0;
+            fChanged = 0;
+            gmn = current();
+        }
+        return gmn;
+    }
+    
+    //______________________________________________________________________________
+    vector<int> xml2guidovisitor::visitedGroups () const
+    {
+        vector<int> groups;
+        for (map<int, partGroup>::const_iterator i = fPartGroups.begin(); i != fPartGroups.end(); i++)
+            if (i->second.visited) groups.push_back(i->first);
+        return groups;
+    }
+    
+    //______________________________________________________________________________
+    // a part conversion is reused when the part is unchanged and when the converter
+    // state is the same as in the previous conversion: the staff index, accolades,
+    // header and groups may differ when a previous part has changed its staves count
+    //______________________________________________________________________________
+    bool xml2guidovisitor::reusePart ( const Sxmlelement& part )
+    {
+        if (!fPrevious || !fChanged || fPartNum) return false;
+
+        string id = part->getAttributeValue("id");
+        if (fChanged->find(id) != fChanged->end()) return false;
+
+        for (partConversions::const_iterator p = fPrevious->begin(); p != fPrevious->end(); p++) {
+            if (p->fPartID != id) continue;
+            if ((p->fStaffIndexIn != fCurrentStaffIndex) || (p->fAccoladeIndexIn != fCurrentAccoladeIndex)
+                || (p->fHeaderFlushedIn != fHeaderFlushed) || (p->fGroupsIn != visitedGroups()))
+                return false;
+
+            for (vector<Sguidoelement>::const_iterator v = p->fVoices.begin(); v != p->fVoices.end(); v++) {
+                Sguidoelement seq = *v;
+                add (seq);
+            }
+            fCurrentStaffIndex = p->fStaffIndexOut;
+            fCurrentAccoladeIndex = p->fAccoladeIndexOut;
+            if (p->fHeaderFlushedOut && !fHeaderFlushed) {
+                fHeader.fTitle = (void*)0;
+                fHeader.fCreators.clear();
+                fHeaderFlushed = true;
+            }
+            for (vector<int>::const_iterator g = p->fGroupsOut.begin(); g != p->fGroupsOut.end(); g++)
+                fPartGroups[*g].visited = true;
+            if (p->fVoices.size()) fPartHeaders[id].visited = true;
+            previousStaffHasLyrics = p->fHasLyrics;
+            fParts.push_back (*p);
+            return true;
+        }
+        return false;
+    }
+    
     //______________________________________________________________________________
     // the score header contains information like title, author etc..
     // it must be written only once, at the beginning of the first guido voice
@@ -84,6 +161,7 @@ namespace MusicXML2
             }
         }
         header.fCreators.clear();
+        fHeaderFlushed = true;
     }
     
     //______________________________________________________________________________
@@ -139,13 +217,13 @@ namespace MusicXML2
             /// something was found. Generate Accolades and BarFormat if any
             int rangeStart = fCurrentStaffIndex ;
             int rangeEnd = rangeStart + (partGroupIt->guidoRangeStop - partGroupIt->guidoRangeStart);
-            std::stringstream rangeFixed;
+            numbuffer rangeFixed;
             rangeFixed << " range=\""<< rangeStart <<"-"<<rangeEnd<<"\"";
             
             if (partGroupIt->bracket)
             {
-                std::stringstream accolParams;
-                accolParams << "id=1, "<< rangeFixed.str();
+                numbuffer accolParams;
+                accolParams << "id=1, "<< rangeFixed.c_str();
                 
                 Sguidoelement tag3 = guidotag::create("accol");
                 tag3->add (guidoparam::create(accolParams.str(), false));
@@ -175,19 +253,19 @@ namespace MusicXML2
     
     void xml2guidovisitor::visitStart( S_defaults& elt)
     {
-        xml2guidovisitor::defaultStaffDistance = elt->getIntValue(k_staff_distance, 0);
+        defaultStaffDistance = elt->getIntValue(k_staff_distance, 0);
         
         // Convert to HS
         /// Guido's default staff-distance seems to be 8 or 80 tenths
         if (defaultStaffDistance > 0) {
-            float xmlDistance = xml2guidovisitor::defaultStaffDistance;
+            float xmlDistance = defaultStaffDistance;
             float HalfSpaceDistance = (xmlDistance / 10) * 2 ; // (pos/10)*2
             if (HalfSpaceDistance > 0.0) {
-                xml2guidovisitor::defaultGuidoStaffDistance = HalfSpaceDistance;
+                defaultGuidoStaffDistance = HalfSpaceDistance;
             }else
-                xml2guidovisitor::defaultGuidoStaffDistance = 0;
+                defaultGuidoStaffDistance = 0;
         }else {
-            xml2guidovisitor::defaultGuidoStaffDistance = 0;
+            defaultGuidoStaffDistance = 0;
         }
     }
     
@@ -202,7 +280,7 @@ namespace MusicXML2
     {
         // Filter out score-part here
         if (fPartNum != 0) {
-            std::stringstream s;
+            numbuffer s;
             s << "P"<<fPartNum;
             std::string thisPart = elt->getAttributeValue("id");
             if ( thisPart != s.str() ) {
@@ -210,8 +288,16 @@ namespace MusicXML2
             }
         }
         
+        partConversion state;
+        state.fPartID = elt->getAttributeValue("id");
+        state.fStaffIndexIn = fCurrentStaffIndex;
+        state.fAccoladeIndexIn = fCurrentAccoladeIndex;
+        state.fHeaderFlushedIn = fHeaderFlushed;
+        state.fGroupsIn = visitedGroups();
+
+        scorerange measures (1, 0, fRange.fFirstMeasure, fRange.fLastMeasure);
         partsummary ps;
-        xml_tree_browser browser(&ps);
+        static_tree_browser<partsummary, range_xml_tree_browser> browser(&ps, measures);
         browser.browse(*elt);
         
         smartlist<int>::ptr voices = ps.getVoices ();
@@ -239,6 +325,7 @@ namespace MusicXML2
             
             Sguidoelement seq = guidoseq::create();
             push (seq);
+            state.fVoices.push_back (seq);
             
             Sguidoelement tag = guidotag::create("staff");
             tag->add (guidoparam::create(fCurrentStaffIndex, false));
@@ -257,7 +344,7 @@ namespace MusicXML2
                 Sguidoelement tag2 = guidotag::create("staffFormat");
                 if (stafflines>0)
                 {
-                    stringstream staffstyle;
+                    numbuffer staffstyle;
                     staffstyle << "style=\"" << stafflines<<"-line\"";
                     tag2->add (guidoparam::create(staffstyle.str(),false));
                 }
@@ -273,9 +360,9 @@ namespace MusicXML2
             {
                 int rangeEnd = fCurrentStaffIndex + ps.countStaves() - 1;
 
-				stringstream accol;
+				numbuffer accol;
 				accol << "id=" << fCurrentAccoladeIndex << ", range=\"" << fCurrentStaffIndex << "-" << rangeEnd << "\"";
-				stringstream barformat;
+				numbuffer barformat;
 				barformat << "style= \"system\", range=\"" << fCurrentStaffIndex << "-" << rangeEnd << "\"";
 				
                 Sguidoelement tag3 = guidotag::create("accol");
@@ -294,7 +381,7 @@ namespace MusicXML2
                 // Otherwise there'll be no bar lines!!!
                 if (checkLonelyBarFormat(fCurrentStaffIndex))
                 {
-					stringstream barformat;
+					numbuffer barformat;
 					barformat << "style= \"system\", range=\"" << fCurrentStaffIndex << "\"";
                     Sguidoelement tag4 = guidotag::create("barFormat");
                     tag4->add (guidoparam::create(barformat.str(), false));
@@ -307,7 +394,7 @@ namespace MusicXML2
             //// Browse XML and convert
             xmlpart2guido pv(fGenerateComments, fGenerateStem, fGenerateBars);
             pv.generatePositions (fGeneratePositions);
-            xml_tree_browser browser(&pv);
+            static_tree_browser<xmlpart2guido, range_xml_tree_browser> browser(&pv, measures);
             pv.initialize(seq, targetStaff, fCurrentStaffIndex, targetVoice, notesOnly, currentTimeSign);
             pv.staffClefMap = staffClefMap;
             pv.timePositions = timePositions;
@@ -318,6 +405,17 @@ namespace MusicXML2
             staffClefMap = pv.staffClefMap;
             timePositions = pv.timePositions;
         }
+
+        state.fStaffIndexOut = fCurrentStaffIndex;
+        state.fAccoladeIndexOut = fCurrentAccoladeIndex;
+        state.fHeaderFlushedOut = fHeaderFlushed;
+        vector<int> groups = visitedGroups();
+        for (vector<int>::const_iterator g = groups.begin(); g != groups.end(); g++) {
+            if (find(state.fGroupsIn.begin(), state.fGroupsIn.end(), *g) == state.fGroupsIn.end())
+                state.fGroupsOut.push_back(*g);
+        }
+        state.fHasLyrics = previousStaffHasLyrics;
+        fParts.push_back (state);
     }
     
     //______________________________________________________________________________
@@ -326,7 +424,7 @@ namespace MusicXML2
         float posx = elt->getAttributeFloatValue("default-x", 0) + elt->getAttributeFloatValue("relative-x", 0);
         if (posx) {
             posx = (posx / 10) * 2;   // convert to half spaces
-            stringstream s;
+            numbuffer s;
             s << "dx=" << posx << "hs";
             tag->add (guidoparam::create(s.str(), false));
         }
@@ -334,7 +432,7 @@ namespace MusicXML2
         if (posy) {
             posy = (posy / 10) * 2;   // convert to half spaces
             posy += yoffset;		  // anchor point convertion (defaults to upper line in xml)
-            stringstream s;
+            numbuffer s;
             s << "dy=" << posy << "hs";
             tag->add (guidoparam::create(s.str(), false));
         }
@@ -355,7 +453,7 @@ namespace MusicXML2
         if (posx) {
             posx = (posx / 10) * 2;   // convert to half spaces
             posx += xoffset;
-            stringstream s;
+            numbuffer s;
             s << "dx=" << posx << "hs";
             tag->add (guidoparam::create(s.str(), false));
         }
@@ -363,7 +461,7 @@ namespace MusicXML2
         if (posy) {
             posy = (posy / 10) * 2;   // convert to half spaces
             posy += yoffset;		  // anchor point convertion (defaults to upper line in xml)
-            stringstream s;
+            numbuffer s;
             s << "dy=" << posy << "hs";
             tag->add (guidoparam::create(s.str(), false));
         }
@@ -386,7 +484,7 @@ namespace MusicXML2
             posy += yoffset;		  // anchor point convertion (defaults to upper line in xml)
             posy = posy * ymultiplier;
         if (posy) {
-            stringstream s;
+            numbuffer s;
             s << "dy=" << posy << "hs";
             tag->add (guidoparam::create(s.str(), false));
         }
@@ -400,7 +498,7 @@ namespace MusicXML2
         posx = (posx / 10) * 2;   // convert to half spaces
         posx += xoffset;          // anchor point convertion (defaults to upper line in xml)
         if (posx) {
-            stringstream s;
+            numbuffer s;
             s << "dx=" << posx << "hs";
             tag->add (guidoparam::create(s.str(), false));
         }
@@ -411,7 +509,7 @@ void xml2guidovisitor::addRelativeX(Sxmlelement elt, Sguidoelement& tag, float x
     posx = (posx / 10) * 2;   // convert to half spaces
     posx += xoffset;
     
-    stringstream s;
+    numbuffer s;
     s << "dx=" << posx << "hs";
     tag->add (guidoparam::create(s.str(), false));
     
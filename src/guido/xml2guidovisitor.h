@@ -16,13 +16,16 @@
 #include <ostream>
 #include <stack>
 #include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "exports.h"
 #include "guido.h"
 #include "typedefs.h"
 #include "visitor.h"
 #include "xml.h"
+#include "range_xml_tree_browser.h"
 #include "rational.h"
 
 
@@ -43,6 +46,26 @@ typedef struct {
 	std::vector<S_creator>	fCreators;
 } scoreHeader;
 
+//______________________________________________________________________________
+/*!
+\brief The conversion state of a part.
+
+	Records the converter state before and after a part conversion, together
+	with the guido sequences generated for the part. It allows to skip the
+	conversion of unchanged parts (see xml2guidoupdater).
+*/
+typedef struct {
+	std::string		fPartID;
+	int				fStaffIndexIn, fStaffIndexOut;			// the guido staff index before and after the part
+	int				fAccoladeIndexIn, fAccoladeIndexOut;	// the accolade index before and after the part
+	bool			fHeaderFlushedIn, fHeaderFlushedOut;	// the score header status before and after the part
+	std::vector<int>	fGroupsIn;							// the part groups visited before the part
+	std::vector<int>	fGroupsOut;							// the part groups visited by the part
+	bool			fHasLyrics;
+	std::vector<Sguidoelement>	fVoices;					// the guido sequences generated for the part
+} partConversion;
+typedef std::vector<partConversion> partConversions;
+
     /*
 typedef struct {
 	S_part_name		fPartName;
@@ -85,6 +108,15 @@ class EXP xml2guidovisitor :
 	void flushPartHeader ( partHeader& header );
     void flushPartGroup (std::string partID);
 
+	partConversions				fParts;			// the conversion state of the visited parts
+	const partConversions*		fPrevious;		// a previous conversion state, used to skip unchanged parts
+	const std::set<std::string>* fChanged;		// the parts that must be converted again
+	bool	fHeaderFlushed;
+	scorerange	fRange;		// the range of parts and measures to convert
+
+	std::vector<int> visitedGroups () const;
+	bool reusePart	 ( const Sxmlelement& part );
+
 	protected:
 
 		virtual void visitStart( S_score_partwise& elt);
@@ -102,7 +134,7 @@ class EXP xml2guidovisitor :
     
     int  fPartNum;  // 0 (default) to parse all score-parts. 1 for "P1" only, etc.
     
-    static int defaultStaffDistance;   // xml staff-distance value in defaults
+    int defaultStaffDistance;   // xml staff-distance value in defaults
     
     /// multimap containing <staff-num, measureNum, position, clef type>
     //std::multimap<int, std::pair< rational, string > > staffClefMap;
@@ -117,13 +149,33 @@ class EXP xml2guidovisitor :
 		virtual ~xml2guidovisitor() {}
 
 		Sguidoelement convert (const Sxmlelement& xml);
+		/*! \brief converts a score reusing the result of a previous conversion
+			\param xml the score to convert
+			\param previous the parts conversion state of a previous conversion of the score
+			\param changed the ids of the parts that have changed since the previous conversion
+			
+			Unchanged parts are not browsed: their previous guido sequences are reused as long as
+			the converter state at the beginning of the part is the same as in the previous conversion.
+		*/
+		Sguidoelement convert (const Sxmlelement& xml, const partConversions& previous, const std::set<std::string>& changed);
+
+		//! gives the conversion state of the parts visited by the last conversion
+		const partConversions& getPartsConversion () const	{ return fParts; }
 
 		// this is to control exact positionning of elements when information is present
 		// ie converts relative-x/-y into dx/dy attributes
 		void generatePositions (bool state)		{ fGeneratePositions = state; }
+
+		/*! \brief restricts the conversion to a range of parts and measures
+		
+			The attributes state (divisions, clefs, key, time, transposition) in effect at the beginning
+			of the measures range is restored at the beginning of each part. The range is ignored
+			by the incremental conversion.
+		*/
+		void setRange (const scorerange& range)	{ fRange = range; }
     
-    /// Shared default derived from MusicXML
-    static int defaultGuidoStaffDistance;  // the above converted to Guido value
+    /// Default derived from MusicXML
+    int defaultGuidoStaffDistance;  // the above converted to Guido value
 
     static void addPosition	 ( Sxmlelement elt, Sguidoelement& tag, float yoffset);
 	static void addPosition	 ( Sxmlelement elt, Sguidoelement& tag, float yoffset, float xoffset);
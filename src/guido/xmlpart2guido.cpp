@@ -18,12 +18,13 @@
 
 
 #include "conversions.h"
+#include "numbers.h"
 #include "partsummary.h"
 #include "rational.h"
 #include "xml2guidovisitor.h"
 #include "metronomevisitor.h"
 #include "xmlpart2guido.h"
-#include "xml_tree_browser.h"
+#include "static_tree_browser.h"
 
 using namespace std;
 
@@ -212,7 +213,7 @@ namespace MusicXML2
     void xmlpart2guido::visitStart ( S_backup& elt )
     {
         stackClean();	// closes pending chords, cue and grace
-        int duration = elt->getIntValue(k_duration, 0);
+        int duration = elt->getChildIntValue(k_duration, 0);
         if (duration) {
             // backup is supposed to be used only for moving between voices
             // thus we don't move the voice time (which is supposed to be 0)
@@ -223,9 +224,9 @@ namespace MusicXML2
     //______________________________________________________________________________
     void xmlpart2guido::visitStart ( S_forward& elt )
     {
-        bool scanElement = (elt->getIntValue(k_voice, 0) == fTargetVoice)
-        && (elt->getIntValue(k_staff, 0) == fTargetStaff);
-        int duration = elt->getIntValue(k_duration, 0);
+        bool scanElement = (elt->getChildIntValue(k_voice, 0) == fTargetVoice)
+        && (elt->getChildIntValue(k_staff, 0) == fTargetStaff);
+        int duration = elt->getChildIntValue(k_duration, 0);
         moveMeasureTime(duration, scanElement);
         if (!scanElement) return;
         
@@ -293,7 +294,7 @@ namespace MusicXML2
         fPendingPops = 0;
         fMeasureEmpty = true;
         if (fGenerateComments) {
-            stringstream s;
+            numbuffer s;
             s << "   (* meas. " << fMeasNum << " *) ";
             string comment="\n"+s.str();
             Sguidoelement elt = guidoelement ::create(comment);
@@ -324,7 +325,7 @@ namespace MusicXML2
                 int xmlStaffDistance = sLayout->getIntValue(k_staff_distance, 0);
                 Sguidoelement tag2 = guidotag::create("staffFormat");
                 float HalfSpaceDistance = ((float)(xmlStaffDistance) / 10) * 2 ;
-                stringstream s;
+                numbuffer s;
                 s << "distance="<< HalfSpaceDistance;
                 tag2->add (guidoparam::create(s.str().c_str(), false));
                 add (tag2);
@@ -364,11 +365,11 @@ namespace MusicXML2
     void xmlpart2guido::visitStart ( S_direction& elt )
     {
         // Parse Staff and Offset first
-        if (fNotesOnly || (elt->getIntValue(k_staff, 0) != fTargetStaff)) {
+        if (fNotesOnly || (elt->getChildIntValue(k_staff, 0) != fTargetStaff)) {
             fSkipDirection = true;
         }
         else {
-            fCurrentOffset = elt->getLongValue(k_offset, 0);
+            fCurrentOffset = elt->getChildLongValue(k_offset, 0);
         }
     }
     
@@ -404,7 +405,7 @@ namespace MusicXML2
             // FIXME: Researsal is a Direction and its x-pos is from the beginning of measure where in Guido it is from current graphical position!
             float markDx = xPosFromTimePos(elt->getAttributeFloatValue("default-x", 0), elt->getAttributeFloatValue("relative-x", 0));
             if (markDx != -999) {
-                stringstream s;
+                numbuffer s;
                 s << "dx=" << markDx ;
                 tag->add (guidoparam::create(s.str(), false));
             }
@@ -579,7 +580,7 @@ namespace MusicXML2
                                 
                                 // apply inherited Y-position
                                 if (commonDy != 0.0) {
-                                    stringstream s;
+                                    numbuffer s;
                                     s << "dy=" << commonDy << "hs";
                                     tag->add (guidoparam::create(s.str(), false));
                                 }
@@ -615,17 +616,17 @@ namespace MusicXML2
                                         }
                                         
                                         // apply inherited Y-position
-                                        stringstream s;
+                                        numbuffer s;
                                         s << "dy=" << commonDy << "hs";
                                         tag->add (guidoparam::create(s.str(), false));
                                         
                                         // Apply dx in case of consecutive dynamics (e.g. "sf ff")
                                         if (dynamicsDx != 0.0) {
-                                            stringstream s;
+                                            numbuffer s;
                                             s << "dx=" << dynamicsDx << "hs";
                                             tag->add (guidoparam::create(s.str(), false));
                                         }else if (intensDx != -999) {
-                                            stringstream s;
+                                            numbuffer s;
                                             s << "dx=" << intensDx ;
                                             tag->add (guidoparam::create(s.str(), false));
                                         }
@@ -647,7 +648,7 @@ namespace MusicXML2
                         case k_metronome:
                         {
                             metronomevisitor mv;
-                            xml_tree_browser browser(&mv);
+                            static_tree_browser<metronomevisitor> browser(&mv);
                             browser.browse(*elt);
                             
                             std::string tempoMetronome = parseMetronome(mv);
@@ -679,7 +680,7 @@ namespace MusicXML2
                                                                                     
                             // apply inherited Y-position
                             if (commonDy != 0.0) {
-                                stringstream s;
+                                numbuffer s;
                                 s << "dy=" << commonDy << "hs";
                                 tag->add (guidoparam::create(s.str(), false));
                             }
@@ -704,7 +705,7 @@ namespace MusicXML2
         // If composed tag, add here
         if (generateAfter) {
             // apply inherited Y-position
-            stringstream s;
+            numbuffer s;
             s << "dy=" << commonDy << "hs";
             tag->add (guidoparam::create(s.str(), false));
             /// Add Tag
@@ -800,7 +801,7 @@ void xmlpart2guido::visitStart ( S_wedge& elt )
         if (type == "diminuendo") {
             float spreadValue = elt->getAttributeFloatValue("spread", 15.0);
             if (spreadValue != 15.0) {
-                stringstream s;
+                numbuffer s;
                 s << "deltaY=" << (spreadValue/10)*2 << "hs";
                 tag->add (guidoparam::create(s.str(), false));
             }
@@ -835,7 +836,7 @@ void xmlpart2guido::visitStart ( S_wedge& elt )
                 nextevent = wedgeBegin;nextevent++;
                 while ( nextevent != wedgeEnd ) {
                     if (nextevent->getType() == k_note) {
-                        if (nextevent->hasSubElement(k_chord)) {
+                        if (nextevent->hasChild(k_chord)) {
                             // in chord, do not increment
                         }else {
                             numberOfNotesInWedge++;
@@ -864,7 +865,7 @@ void xmlpart2guido::visitStart ( S_wedge& elt )
                     if (posx1!=0.0) {
                         posx1 = (posx1 / 10) * 2;   // convert to half spaces
                         
-                        stringstream s;
+                        numbuffer s;
                         s << "dx1=" << posx1 << "hs";
                         tag->add (guidoparam::create(s.str(), false));
                     }
@@ -885,7 +886,7 @@ void xmlpart2guido::visitStart ( S_wedge& elt )
                 //// Add spreadvalue from the Crescendo Ending
                 float spreadValue = nextWedge->getAttributeFloatValue("spread", 15.0);
                 if (spreadValue != 15.0) {
-                    stringstream s;
+                    numbuffer s;
                     s << "deltaY=" << (spreadValue/10)*2 << "hs";
                     tag->add (guidoparam::create(s.str(), false));
                 }
@@ -897,7 +898,7 @@ void xmlpart2guido::visitStart ( S_wedge& elt )
             }
         }
         
-        stringstream s;
+        numbuffer s;
         s << "dy=" << xml2guidovisitor::getYposition(elt, 13, true) << "hs";
         tag->add (guidoparam::create(s.str(), false));
         
@@ -922,8 +923,8 @@ std::string xmlpart2guido::parseMetronome ( metronomevisitor &mv )
     }
     r.rationalise();
     
-    stringstream s;
-    s << "[" << (string)r << "] = " << mv.fPerMinute;
+    numbuffer s;
+    s << "[" << r << "] = " << mv.fPerMinute;
     return s.str();
 }
 
@@ -1417,7 +1418,7 @@ std::string xmlpart2guido::parseMetronome ( metronomevisitor &mv )
                 }
                 
                 
-                stringstream tagName;
+                numbuffer tagName;
                 tagName << "slurBegin" << ":"<< lastSlurInternalNumber;
                 Sguidoelement tag = guidotag::create(tagName.str());
                 string placement = (*i)->getAttributeValue("placement");
@@ -1450,7 +1451,7 @@ bool xmlpart2guido::isSlurClosing(S_slur elt) {
     while (nextnote != fCurrentPart->end()) {
         // looking for the next note on the target voice
         if ((nextnote->getType() == k_note)) {
-            int thisNoteVoice = nextnote->getIntValue(k_voice,0);
+            int thisNoteVoice = nextnote->getChildIntValue(k_voice,0);
             ctree<xmlelement>::iterator iter;
             iter = nextnote->find(k_notations);
             if (iter != nextnote->end())
@@ -1508,7 +1509,7 @@ bool xmlpart2guido::isSlurClosing(S_slur elt) {
                     continue;
                 }
                 
-                stringstream tagName;
+                numbuffer tagName;
                 tagName << "slurEnd" << ":"<< lastSlurInternalNumber;
                 Sguidoelement tag = guidotag::create(tagName.str());
                 add(tag);
@@ -1546,7 +1547,7 @@ std::vector< std::pair<int, int> >::const_iterator xmlpart2guido::findSlur ( con
 
         // Create beamBegin only if no beam is already opened. Groupings will be handled upon the initial openning.
         if ( (began != beams.end()) && (!fBeamOpened || fInGrace)){
-            stringstream tagName;
+            numbuffer tagName;
             int beamNumber = 1;
             if (fInGrace && fBeamOpened) {
                 beamNumber = 2;
@@ -1563,7 +1564,7 @@ std::vector< std::pair<int, int> >::const_iterator xmlpart2guido::findSlur ( con
                 ctree<xmlelement>::iterator nextnote = find(fCurrentMeasure->begin(), fCurrentMeasure->end(), elt);
                 nextnote.forward_up(); // forward one element
                 while (nextnote != fCurrentMeasure->end()) {
-                    if (( (nextnote->getType() == k_note) && (nextnote->getIntValue(k_voice,0) == fTargetVoice) )) {
+                    if (( (nextnote->getType() == k_note) && (nextnote->getChildIntValue(k_voice,0) == fTargetVoice) )) {
                         // Check if there is a beam end with a beam Continue, it can be a Grouping candidate!
                         if (nextnote->hasSubElement(k_beam, "end") && nextnote->hasSubElement(k_beam, "continue") ) {
                             //cerr << " \tNextNote with beam end, line:"<<nextnote->getInputLineNumber()<<" type="<<nextnote->getValue(k_type)<<endl;
@@ -1577,7 +1578,7 @@ std::vector< std::pair<int, int> >::const_iterator xmlpart2guido::findSlur ( con
                                     string postType = postnote->getValue(k_type);
                                     if (postType == endingType) {
                                         // We are in a grouping continuity!
-                                        stringstream tagName2;
+                                        numbuffer tagName2;
                                         tagName2 << "beamBegin" << ":"<< (beamNumber+1);
                                         tag = guidotag::create(tagName2.str());
                                         add (tag);
@@ -1619,7 +1620,7 @@ std::vector< std::pair<int, int> >::const_iterator xmlpart2guido::findSlur ( con
         bool withContinuity = (continuity != beams.end());
         
         if (ended && (!began) && !withContinuity && (fBeamOpened || fInGrace)) {
-            stringstream tagName;
+            numbuffer tagName;
             int beamNumber = 1;
             if (fInGrace && fBeamOpened) {
                 beamNumber = 2;
@@ -1633,7 +1634,7 @@ std::vector< std::pair<int, int> >::const_iterator xmlpart2guido::findSlur ( con
             
             // If there is a grouping, close it!
             if (fBeamGrouping) {
-                stringstream tagName2;
+                numbuffer tagName2;
                 tagName2 << "beamEnd" << ":"<<beamNumber+1;
                 tag = guidotag::create(tagName2.str());
                 add (tag);
@@ -1641,11 +1642,11 @@ std::vector< std::pair<int, int> >::const_iterator xmlpart2guido::findSlur ( con
             }
         }else if (withContinuity && fBeamGrouping && ended) {
             // This occurs only during a grouping continuity:
-            stringstream tagName;
+            numbuffer tagName;
             tagName << "beamEnd" << ":2";
             Sguidoelement tag = guidotag::create(tagName.str());
             add (tag);
-            stringstream tagName2;
+            numbuffer tagName2;
             tagName2 << "beamBegin" << ":2";
             tag = guidotag::create(tagName2.str());
             add (tag);
@@ -1715,7 +1716,7 @@ std::vector< std::pair<int, int> >::const_iterator xmlpart2guido::findSlur ( con
                 useDispNoteAttribute = true; // setback to True.. will become false if check doesn't pass!
                 while (nextnote != fCurrentMeasure->end()) {
                     // looking for the next note on the target voice
-                    if ((nextnote->getType() == k_note) && (nextnote->getIntValue(k_voice,0) == fTargetVoice)) {
+                    if ((nextnote->getType() == k_note) && (nextnote->getChildIntValue(k_voice,0) == fTargetVoice)) {
                         // Get note's Guido Duration
                         rational nextNoteDur = NoteType::type2rational(NoteType::xml(nextnote->getValue(k_type)));
                         if (nextNoteDur.getNumerator()==0)
@@ -2025,7 +2026,7 @@ std::vector< std::pair<int, int> >::const_iterator xmlpart2guido::findSlur ( con
         }
         if (note.fSnapPizzicato) {
             tag = guidotag::create("pizz");
-            stringstream s;
+            numbuffer s;
             s << "type=\"snap\"";
             tag->add (guidoparam::create(s.str(), false));
             push(tag);
@@ -2233,7 +2234,7 @@ void xmlpart2guido::checkPostArticulation ( const notevisitor& note )
                     if (nextnote != fCurrentMeasure->end()) nextnote++;    // advance one step
                     while (nextnote != fCurrentMeasure->end()) {
                         // looking for the next note on the target voice
-                        if ((nextnote->getType() == k_note) && (nextnote->getIntValue(k_voice,0) == fTargetVoice)) {
+                        if ((nextnote->getType() == k_note) && (nextnote->getChildIntValue(k_voice,0) == fTargetVoice)) {
                             ctree<xmlelement>::iterator iter;            // and when there is one
                             iter = nextnote->find(k_tremolo);
                             if (iter != nextnote->end() && (iter->getAttributeValue("type")=="stop") ) {
@@ -2242,7 +2243,7 @@ void xmlpart2guido::checkPostArticulation ( const notevisitor& note )
                                 if (chordStop.size())
                                     s<< "{";
                                 
-                                notevisitor nv;xml_tree_browser browser(&nv);
+                                notevisitor nv;static_tree_browser<notevisitor> browser(&nv);
                                 Sxmlelement note = *nextnote;
                                 browser.browse(*note);
                                 
@@ -2256,7 +2257,7 @@ void xmlpart2guido::checkPostArticulation ( const notevisitor& note )
                                 if (chordStop.size()) {
                                     for (vector<Sxmlelement>::const_iterator chordIter = chordStop.begin(); chordIter != chordStop.end(); chordIter++) {
                                         s<<",";
-                                        notevisitor nv;xml_tree_browser browser(&nv);
+                                        notevisitor nv;static_tree_browser<notevisitor> browser(&nv);
                                         Sxmlelement note = *chordIter;
                                         browser.browse(*note);
                                         int octave = nv.getOctave() - 3;            // octave offset between MusicXML and GUIDO is -3
@@ -2299,12 +2300,10 @@ void xmlpart2guido::checkPostArticulation ( const notevisitor& note )
         if (nextnote != fCurrentMeasure->end()) nextnote++;	// advance one step
         while (nextnote != fCurrentMeasure->end()) {
             // looking for the next note on the target voice
-            if ((nextnote->getType() == k_note) && (nextnote->getIntValue(k_voice,0) == fTargetVoice)) {
-                ctree<xmlelement>::iterator iter;			// and when there is one
-                iter = nextnote->find(k_chord);
-                if (iter != nextnote->end()) {
+            if ((nextnote->getType() == k_note) && (nextnote->getChildIntValue(k_voice,0) == fTargetVoice)) {
+                if (nextnote->hasChild(k_chord)) {			// and when there is one
                     notevisitor nv;
-                    xml_tree_browser browser(&nv);
+                    static_tree_browser<notevisitor> browser(&nv);
                     Sxmlelement note = *nextnote;
                     browser.browse(*note);
                     notevisitors.push_back(nv);
@@ -2325,10 +2324,8 @@ void xmlpart2guido::checkPostArticulation ( const notevisitor& note )
         if (nextnote != fCurrentMeasure->end()) nextnote++;    // advance one step
         while (nextnote != fCurrentMeasure->end()) {
             // looking for the next note on the target voice
-            if ((nextnote->getType() == k_note) && (nextnote->getIntValue(k_voice,0) == fTargetVoice)) {
-                ctree<xmlelement>::iterator iter;            // and when there is one
-                iter = nextnote->find(k_chord);
-                if (iter != nextnote->end())
+            if ((nextnote->getType() == k_note) && (nextnote->getChildIntValue(k_voice,0) == fTargetVoice)) {
+                if (nextnote->hasChild(k_chord))            // and when there is one
                     v.push_back(*nextnote);
                 else break;
             }
@@ -2384,10 +2381,10 @@ void xmlpart2guido::checkPostArticulation ( const notevisitor& note )
                 nextnote.forward_up(); // forward one element
                 while (nextnote != fCurrentMeasure->end()) {
                     // break if next element is a non-grace
-                    if (( (nextnote->getType() == k_note) && (nextnote->getIntValue(k_voice,0) == fTargetVoice) )
+                    if (( (nextnote->getType() == k_note) && (nextnote->getChildIntValue(k_voice,0) == fTargetVoice) )
                         || (nextnote->getType() == k_direction)){
                         if (nextnote->getType() == k_note) {
-                            if (nextnote->find(k_grace) != nextnote->end())
+                            if (nextnote->hasChild(k_grace))
                             {
                                 // Next note has a grace.. continue loop..
                                 nextnote.forward_up(); // forward one element
@@ -2425,9 +2422,8 @@ void xmlpart2guido::checkPostArticulation ( const notevisitor& note )
             ctree<xmlelement>::iterator nextnote = find(fCurrentMeasure->begin(), fCurrentMeasure->end(), nv.getSnote());
             nextnote++;	// advance one step
             while (nextnote != fCurrentMeasure->end()) {
-                if ((nextnote->getType() == k_note) && (nextnote->getIntValue(k_voice,0) == fTargetVoice)){
-                    ctree<xmlelement>::iterator iter = nextnote->find(k_grace);
-                    if (iter != nextnote->end())
+                if ((nextnote->getType() == k_note) && (nextnote->getChildIntValue(k_voice,0) == fTargetVoice)){
+                    if (nextnote->hasChild(k_grace))
                     {
                         // Next note has a grace.. do nothing.. we'll break anyway!
                     }else {
@@ -2452,7 +2448,7 @@ void xmlpart2guido::checkPostArticulation ( const notevisitor& note )
             // Determine Type ("upright" or "inverted")
             std::string fermataType = nv.fFermata->getAttributeValue("type");
             if (fermataType == "inverted") {
-                stringstream s;
+                numbuffer s;
                 s << "position=" << "\"below\"";
                 tag->add (guidoparam::create(s.str(), false));
                 
@@ -2664,7 +2660,7 @@ void xmlpart2guido::newChord(const deque<notevisitor>& nvs, rational posInMeasur
                     if (nv.x_default != *minXPos) {
                         int noteDx = ( (nv.x_default - *minXPos)/ 10 ) * 2;   // convert to half spaces
                         
-                        stringstream s;
+                        numbuffer s;
                         s << "dx=" << noteDx ;
                         noteFormatTag->add (guidoparam::create(s.str(), false));
                         noteFormat = true;
@@ -2715,7 +2711,7 @@ void xmlpart2guido::newChord(const deque<notevisitor>& nvs, rational posInMeasur
                     if (nv.x_default != *minXPos) {
                         int noteDx = ( (nv.x_default - *minXPos)/ 10 ) * 2;   // convert to half spaces
                         
-                        stringstream s;
+                        numbuffer s;
                         s << "dx=" << noteDx ;
                         noteFormatTag->add (guidoparam::create(s.str(), false));
                         push(noteFormatTag);
@@ -2754,7 +2750,7 @@ void xmlpart2guido::newChord(const deque<notevisitor>& nvs, rational posInMeasur
             if (restformatDy!=0.0)
             {
                 Sguidoelement restFormatTag = guidotag::create("restFormat");
-                stringstream s;
+                numbuffer s;
                 s << "dy=" << restformatDy;
                 restFormatTag->add (guidoparam::create(s.str(), false));
                 push(restFormatTag);
@@ -2950,7 +2946,7 @@ bool xmlpart2guido::findNextNote(ctree<xmlelement>::iterator& elt, ctree<xmlelem
     if (nextnotetmp != fCurrentMeasure->end()) nextnotetmp++;    // advance one step
     while (nextnotetmp != fCurrentMeasure->end()) {
         // looking for the next note on the target voice
-        if ((nextnotetmp->getType() == k_note) && (nextnotetmp->getIntValue(k_voice,0) == fTargetVoice)) {
+        if ((nextnotetmp->getType() == k_note) && (nextnotetmp->getChildIntValue(k_voice,0) == fTargetVoice)) {
             nextnote = nextnotetmp;
             return true;
         }
@@ -2974,7 +2970,7 @@ void xmlpart2guido::addPosYforNoteHead(const notevisitor& nv, Sxmlelement elt, S
     }
     float posy = xmlY - noteDistanceFromStaffTop + offset ;
     if (posy) {
-        stringstream s;
+        numbuffer s;
         s << "dy=" << posy << "hs";
         tag->add (guidoparam::create(s.str(), false));
     }
@@ -10,6 +10,7 @@
   research@grame.fr
 */
 
+#include <string.h>
 #include <vector>
 
 #include "libmusicxml.h"
@@ -32,6 +33,7 @@ EXP const char* musicxml2guidoVersionStr()    { return versions::xml2guidoVersio
 EXP TFactory factoryOpen  ()            { return new musicxmlfactory(); }
 EXP void  factoryClose (TFactory f)       { delete f; }
 EXP void  factoryPrint (TFactory f, ostream& out) { f->print(out); }
+EXP void  factorySortOnInsert (TFactory f, bool state) { f->setSortOnInsert(state); }
 
 
 //------------------------------------------------------------------------
@@ -131,6 +133,61 @@ EXP void    factoryAddElements  (TFactory f, TElement elt, TElement* subelts)
 }
 
 
+//------------------------------------------------------------------------
+// batch operations
+//------------------------------------------------------------------------
+typedef vector<pair<const TNoteDesc*, Sxmlelement> > __tiedNotes;
+
+static bool __samePitch (const TNoteDesc* a, const TNoteDesc* b)
+  { return !strcmp(a->step, b->step) && (a->alter == b->alter) && (a->octave == b->octave); }
+
+static void __notes (TFactory f, Sxmlelement measure, const TNoteDesc* notes, int count, __tiedNotes& ties)
+{
+  vector<Sxmlelement>& elts = measure->elements();
+  elts.reserve (elts.size() + count);
+  for (const TNoteDesc* d = notes; d < notes + count; d++) {
+    Sxmlelement note = d->step ? f->newnote (d->step, d->alter, d->octave, d->duration, d->type) : f->newrest (d->duration, d->type);
+    note->elements().reserve (note->elements().size() + d->dots + 3);
+    if (d->flags & kChordFlag)  f->add (note, f->element (k_chord));
+    for (int i = 0; i < d->dots; i++) f->add (note, f->element (k_dot));
+    if (d->voice)       f->add (note, f->element (k_voice, d->voice));
+    if (d->staff)       f->add (note, f->element (k_staff, d->staff));
+    if (d->step) {
+      for (__tiedNotes::iterator i = ties.begin(); i != ties.end(); i++) {
+        if (__samePitch (i->first, d)) {
+          f->tie (i->second, note);
+          ties.erase (i);
+          break;
+        }
+      }
+      if (d->flags & kTieFlag) ties.push_back (make_pair (d, note));
+    }
+    f->add (measure, note);
+  }
+}
+
+EXP void    factoryNotes  (TFactory f, TElement measure, const TNoteDesc* notes, int count)
+{
+  __tiedNotes ties;
+  __notes (f, measure, notes, count, ties);
+}
+
+EXP void    factoryMeasures (TFactory f, TElement part, const TMeasureDesc* measures, int count)
+{
+  __tiedNotes ties;
+  Sxmlelement p (part);
+  p->elements().reserve (p->elements().size() + count);
+  for (const TMeasureDesc* d = measures; d < measures + count; d++) {
+    Sxmlelement measure = (d->time || d->clef || d->key || d->division)
+      ? f->newmeasure (d->number, d->time, d->clef, d->line, d->key, d->division)
+      : f->newmeasure (d->number);
+    __notes (f, measure, d->notes, d->count, ties);
+    if (d->barstyle) f->add (measure, f->newbarline ("right", d->barstyle));
+    f->add (p, measure);
+  }
+}
+
+
 //------------------------------------------------------------------------
 // elements creation
 //------------------------------------------------------------------------
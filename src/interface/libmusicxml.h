@@ -111,6 +111,31 @@ EXP xmlErr      musicxmlstring2guido(const char *buff, bool generateBars, std::o
  */
 EXP xmlErr      musicxmlstring2guidoOnPart(const char * buffer, bool generateBars, int partFilter, std::ostream& out);
 
+/*!
+ \brief Converts a range of parts and measures of a MusicXML file to the Guido format.
+ 
+ Parts and measures are denoted by their position in the score, starting at 1 (the measures
+ \e number attribute is not used). A null last index denotes the end of the score or of the part.
+ Parts and measures out of the range are not visited but the attributes state (divisions, clefs, 
+ key, time, transposition) in effect at the beginning of the measures range is preserved.
+
+ \param file a file name
+ \param generateBars a boolean to force barlines generation
+ \param firstPart the first part to convert
+ \param lastPart the last part to convert (0 for the last part of the score)
+ \param firstMeasure the first measure to convert
+ \param lastMeasure the last measure to convert (0 for the last measure of the parts)
+ \param out the output stream
+ \return an error code (\c kNoErr when success)
+ */
+EXP xmlErr      musicxmlfile2guidoRange(const char *file, bool generateBars, int firstPart, int lastPart, int firstMeasure, int lastMeasure, std::ostream& out);
+
+/*!
+ \brief Converts a range of parts and measures of a MusicXML string to the Guido format.
+ \see musicxmlfile2guidoRange
+ */
+EXP xmlErr      musicxmlstring2guidoRange(const char *buff, bool generateBars, int firstPart, int lastPart, int firstMeasure, int lastMeasure, std::ostream& out);
+
 /*! @} */
 
 
@@ -251,6 +276,14 @@ EXP void    factoryClose (TFactory f);
 */
 EXP void    factoryPrint (TFactory f, std::ostream& out);
 
+/*!
+  \brief Sets the factory sort on insert mode.
+  \param f the MusicXML factory
+  \param state when true, the elements are inserted at their place according to the dtd
+  and the score needs not to be sorted when printed (which is faster for large scores).
+*/
+EXP void    factorySortOnInsert (TFactory f, bool state);
+
 
 /*!
   \brief Creates header information.
@@ -458,6 +491,65 @@ EXP TElement  factoryRest   (TFactory f, int duration, const char* type);
 EXP void    factoryChord  (TFactory f, TElement * notes);
 
 
+/*!
+  \brief The notes descriptors flags.
+  - kChordFlag: the note is an additional chord tone with the preceding note
+  - kTieFlag: the note is tied to the next note of the batch that has the same pitch
+*/
+enum { kChordFlag = 1, kTieFlag = 2 };
+
+/*!
+  \brief A note description for the batch operations.
+*/
+typedef struct {
+  const char* step;     ///< the pitch step using letters A through G, a null step describes a rest
+  float       alter;    ///< chromatic alteration in number of semitones (0 prevents the alter element creation)
+  int         octave;   ///< a number in 0 to 9, where 4 indicates the octave started by middle C
+  int         duration; ///< the sounding duration in divisions count (0 prevents the duration element creation)
+  const char* type;     ///< the graphic note type (a null pointer prevents the type element creation)
+  int         dots;     ///< the number of dots
+  int         voice;    ///< the voice number (0 prevents the voice element creation)
+  int         staff;    ///< the staff number (0 prevents the staff element creation)
+  int         flags;    ///< a combination of kChordFlag and kTieFlag
+} TNoteDesc;
+
+/*!
+  \brief A measure description for the batch operations.
+  The attributes fields have the semantic of factoryMeasureWithAttributes.
+*/
+typedef struct {
+  int               number;   ///< the required 'number' attribute
+  const char*       time;     ///< the time signature with the form "n/n" or null
+  const char*       clef;     ///< the clef sign or null
+  int               line;     ///< the clef line or 0
+  int               key;      ///< the key signature or 0
+  int               division; ///< the divisions or 0
+  const TNoteDesc*  notes;    ///< the measure notes
+  int               count;    ///< the count of notes
+  const char*       barstyle; ///< the style of a right barline (a null pointer prevents the barline creation)
+} TMeasureDesc;
+
+/*!
+  \brief Creates a set of notes and adds them to a measure.
+  \param f the MusicXML factory
+  \param measure the destination measure
+  \param notes an array of notes descriptions
+  \param count the count of notes
+  \note the notes are created in a single call, which is much more efficient than creating
+  the notes one by one with factoryNote and factoryAddElement.
+*/
+EXP void    factoryNotes  (TFactory f, TElement measure, const TNoteDesc* notes, int count);
+
+/*!
+  \brief Creates a set of measures and adds them to a part.
+  \param f the MusicXML factory
+  \param part the destination part
+  \param measures an array of measures descriptions
+  \param count the count of measures
+  \note the ties may span several measures.
+*/
+EXP void    factoryMeasures (TFactory f, TElement part, const TMeasureDesc* measures, int count);
+
 /*!
   \brief Creates an arbitrary MusicXML element.
   \param f the MusicXML factory
@@ -27,13 +27,14 @@ namespace MusicXML2
 {
 
 //_______________________________________________________________________________
-static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, ostream& out, const char* file)
+static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, ostream& out, const char* file, const scorerange& range=scorerange())
 {
 	Sxmlelement st = xmlfile->elements();
 	if (st) {
 		if (st->getName() == "score-timewise") return kUnsupported;
 		
 		xml2guidovisitor v(true, true, generateBars, partFilter);
+		v.setRange (range);
 		Sguidoelement gmn = v.convert(st);
 		if (file) {
 			out << "(*\n  gmn code converted from '" << file << "'"
@@ -89,6 +90,30 @@ EXP xmlErr musicxmlstring2guidoOnPart(const char * buffer, bool generateBars, in
 	}
 	return kInvalidFile;
 }
+
+//_______________________________________________________________________________
+EXP xmlErr musicxmlfile2guidoRange(const char *file, bool generateBars, int firstPart, int lastPart, int firstMeasure, int lastMeasure, ostream& out)
+{
+	xmlreader r;
+	SXMLFile xmlfile;
+	xmlfile = r.read(file);
+	if (xmlfile) {
+		return xml2guido(xmlfile, generateBars, 0, out, file, scorerange(firstPart, lastPart, firstMeasure, lastMeasure));
+	}
+	return kInvalidFile;
+}
+
+//_______________________________________________________________________________
+EXP xmlErr musicxmlstring2guidoRange(const char *buffer, bool generateBars, int firstPart, int lastPart, int firstMeasure, int lastMeasure, ostream& out)
+{
+	xmlreader r;
+	SXMLFile xmlfile;
+	xmlfile = r.readbuff(buffer);
+	if (xmlfile) {
+		return xml2guido(xmlfile, generateBars, 0, out, 0, scorerange(firstPart, lastPart, firstMeasure, lastMeasure));
+	}
+	return kInvalidFile;
+}
     
 
 }
@@ -20,63 +20,72 @@ namespace MusicXML2
 
 //--------------------------------------------------------------------------------
 // static declarations, used to provide conversion between strings and constants
+// the tables are constant data, they are searched linearly (they are short)
 //--------------------------------------------------------------------------------
-TrillStart::type TrillStart::fSNTbl[]		= { upper, main, below };
-string TrillStart::fSNStrings[]				= { "upper", "main", "below" };
-bimap<string, TrillStart::type> TrillStart::fSN2String(fSNStrings, fSNTbl, last);
+template <typename T> static const char* tostring (T d, const T* tbl, const char* const* strings, int n)
+{
+	for (int i = 0; i < n; i++)
+		if (tbl[i] == d) return strings[i];
+	return "";
+}
+
+template <typename T> static T fromstring (const string& str, const T* tbl, const char* const* strings, int n, T undef)
+{
+	for (int i = 0; i < n; i++)
+		if (str == strings[i]) return tbl[i];
+	return undef;
+}
+
+//--------------------------------------------------------------------------------
+const TrillStart::type TrillStart::fSNTbl[]	= { upper, main, below };
+const char* const TrillStart::fSNStrings[]	= { "upper", "main", "below" };
 
-const string TrillStart::xml (type d)					{ return fSN2String[d]; }
-TrillStart::type TrillStart::xml (const string str) 	{ return fSN2String[str]; }
+const string TrillStart::xml (type d)					{ return tostring (d, fSNTbl, fSNStrings, last); }
+TrillStart::type TrillStart::xml (const string str) 	{ return fromstring (str, fSNTbl, fSNStrings, last, undefined); }
 
 //--------------------------------------------------------------------------------
-TrillStep::type TrillStep::fTSTbl[]		= { whole, half, unison, none };
-string TrillStep::fTSStrings[]			= { "whole", "half", "unison", "none" };
-bimap<string, TrillStep::type> TrillStep::fTS2String(fTSStrings, fTSTbl, last);
+const TrillStep::type TrillStep::fTSTbl[]	= { whole, half, unison, none };
+const char* const TrillStep::fTSStrings[]	= { "whole", "half", "unison", "none" };
 
-const string TrillStep::xml (type d)				{ return fTS2String[d]; }
-TrillStep::type TrillStep::xml (const string str) 	{ return fTS2String[str]; }
+const string TrillStep::xml (type d)				{ return tostring (d, fTSTbl, fTSStrings, last); }
+TrillStep::type TrillStep::xml (const string str) 	{ return fromstring (str, fTSTbl, fTSStrings, last, undefined); }
 
 //--------------------------------------------------------------------------------
-FullCue::type FullCue::fFCTbl[]			= { full, cue };
-string FullCue::fFCStrings[]			= { "full", "cue" };
-bimap<string, FullCue::type> FullCue::fFC2String(fFCStrings, fFCTbl, last);
+const FullCue::type FullCue::fFCTbl[]	= { full, cue };
+const char* const FullCue::fFCStrings[]	= { "full", "cue" };
 
-const string FullCue::xml (type d) 				{ return fFC2String[d]; }
-FullCue::type FullCue::xml (const string str) 	{ return fFC2String[str]; }
+const string FullCue::xml (type d) 				{ return tostring (d, fFCTbl, fFCStrings, last); }
+FullCue::type FullCue::xml (const string str) 	{ return fromstring (str, fFCTbl, fFCStrings, last, undefined); }
 
 //--------------------------------------------------------------------------------
-YesNo::type YesNo::fYNTbl[]				= { yes, no };
-string YesNo::fYNStrings[]				= { "yes", "no" };
-bimap<string, YesNo::type> YesNo::fYN2String(fYNStrings, fYNTbl, last);
+const YesNo::type YesNo::fYNTbl[]	= { yes, no };
+const char* const YesNo::fYNStrings[]	= { "yes", "no" };
 
-const string YesNo::xml (type d) 			{ return fYN2String[d]; }
-YesNo::type YesNo::xml (const string str) 	{ return fYN2String[str]; }
+const string YesNo::xml (type d) 			{ return tostring (d, fYNTbl, fYNStrings, last); }
+YesNo::type YesNo::xml (const string str) 	{ return fromstring (str, fYNTbl, fYNStrings, last, undefined); }
 
 //--------------------------------------------------------------------------------
-StartStop::type StartStop::fStartStopTbl[]	= { start, stop, cont };
-string StartStop::fStartStopStrings[]		= { "start", "stop", "continue" };
-bimap<string, StartStop::type> StartStop::fStartStop2String(fStartStopStrings, fStartStopTbl, last);
+const StartStop::type StartStop::fStartStopTbl[]	= { start, stop, cont };
+const char* const StartStop::fStartStopStrings[]	= { "start", "stop", "continue" };
 
-const string StartStop::xml (type d) 				{ return fStartStop2String[d]; }
-StartStop::type StartStop::xml (const string str) 	{ return fStartStop2String[str]; }
+const string StartStop::xml (type d) 				{ return tostring (d, fStartStopTbl, fStartStopStrings, last); }
+StartStop::type StartStop::xml (const string str) 	{ return fromstring (str, fStartStopTbl, fStartStopStrings, last, undefined); }
 
 //--------------------------------------------------------------------------------
-LineType::type LineType::fLineTypeTbl[]		= { solid, dashed, dotted, wavy };
-string LineType::fLineTypeStrings[]			= { "solid", "dashed", "dotted", "wavy" };
-bimap<string, LineType::type> LineType::fLineType2String(fLineTypeStrings, fLineTypeTbl, last);
+const LineType::type LineType::fLineTypeTbl[]	= { solid, dashed, dotted, wavy };
+const char* const LineType::fLineTypeStrings[]	= { "solid", "dashed", "dotted", "wavy" };
 
-const string LineType::xml (type d) 			{ return fLineType2String[d]; }
-LineType::type LineType::xml (const string str) { return fLineType2String[str]; }
+const string LineType::xml (type d) 			{ return tostring (d, fLineTypeTbl, fLineTypeStrings, last); }
+LineType::type LineType::xml (const string str) { return fromstring (str, fLineTypeTbl, fLineTypeStrings, last, undefined); }
 
 //--------------------------------------------------------------------------------
-NoteType::type NoteType::fTypeTbl[]	= { t256th, t128th, t64th, t32nd, t16th, eighth, 
+const NoteType::type NoteType::fTypeTbl[]	= { t256th, t128th, t64th, t32nd, t16th, eighth, 
                                         quarter, half, whole, breve, tlong };
-string NoteType::fTypeStrings[]		= { "256th", "128th", "64th", "32nd", "16th", "eighth", 
+const char* const NoteType::fTypeStrings[]	= { "256th", "128th", "64th", "32nd", "16th", "eighth", 
                                         "quarter", "half", "whole", "breve", "longa" };
-bimap<string, NoteType::type> NoteType::fType2String(fTypeStrings, fTypeTbl, count);
 
-const string NoteType::xml (type d)  				{ return fType2String[d]; }
-NoteType::type NoteType::xml (const string str)  	{ return fType2String[str]; }
+const string NoteType::xml (type d)  				{ return tostring (d, fTypeTbl, fTypeStrings, count); }
+NoteType::type NoteType::xml (const string str)  	{ return fromstring (str, fTypeTbl, fTypeStrings, count, undefined); }
 rational NoteType::type2rational(type d) {
 	rational r, ratio(1,256);
 	int i = 1;
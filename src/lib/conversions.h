@@ -15,7 +15,6 @@
 
 #include "exports.h"
 #include "rational.h"
-#include "bimap.h"
 #include <string>
 
 #ifdef WIN32
@@ -40,9 +39,8 @@ class EXP TrillStart {
     static       type	xml (const string str);
 
     private:
-	static bimap<string, type> fSN2String;
-	static type 		fSNTbl[];
-	static string 		fSNStrings[];        
+	static const type		fSNTbl[];
+	static const char* const		fSNStrings[];        
 };
 
 /*!
@@ -58,9 +56,8 @@ class EXP TrillStep {
     static       type	xml (const string str);
 
     private:
-	static bimap<string, type> fTS2String;
-	static type 		fTSTbl[];
-	static string 		fTSStrings[];        
+	static const type		fTSTbl[];
+	static const char* const		fTSStrings[];        
 };
 
 /*!
@@ -76,9 +73,8 @@ class EXP FullCue {
     static       type	xml (const string str);
 
     private:
-	static bimap<string, type> fFC2String;
-	static type 		fFCTbl[];
-	static string 		fFCStrings[];        
+	static const type		fFCTbl[];
+	static const char* const		fFCStrings[];        
 };
 
 /*!
@@ -94,9 +90,8 @@ class EXP YesNo {
     static       type	xml (const string str);
 
     private:
-	static bimap<string, type> fYN2String;
-	static type 	fYNTbl[];
-	static string 	fYNStrings[];        
+	static const type	fYNTbl[];
+	static const char* const	fYNStrings[];        
 };
 
 /*!
@@ -112,9 +107,8 @@ class EXP StartStop {
     static       type	xml (const string str);
 
     private:
-	static bimap<string, type> fStartStop2String;
-	static type 	fStartStopTbl[];
-	static string 	fStartStopStrings[];        
+	static const type	fStartStopTbl[];
+	static const char* const	fStartStopStrings[];        
 };
 
 /*!
@@ -130,9 +124,8 @@ class EXP LineType {
     static       type	xml (const string str);
 
     private:
-	static bimap<string, type> fLineType2String;
-	static type 	fLineTypeTbl[];
-	static string 	fLineTypeStrings[];        
+	static const type	fLineTypeTbl[];
+	static const char* const	fLineTypeStrings[];        
 };
 
 /*!
@@ -158,9 +151,8 @@ class EXP NoteType {
     static       type	xml (const string str);
 
     private:
-	static bimap<string, type> fType2String;
-	static type 	fTypeTbl[];
-	static string 	fTypeStrings[];        
+	static const type	fTypeTbl[];
+	static const char* const	fTypeStrings[];        
 };
 
 } // namespace MusicXML2
@@ -14,9 +14,9 @@
 #define __ctree__
 
 #include <iostream>
-#include <stack>
 #include <vector>
 #include <iterator>
+#include <utility>
 
 #ifdef WIN32
 #pragma warning (disable : 4251)
@@ -28,94 +28,123 @@
 namespace MusicXML2 
 {
 
+template <typename T> class ctree;
+
 //______________________________________________________________________________
+/*!
+\brief a pre-order tree iterator
+
+	The iterator moves using the nodes parent pointer and index in parent:
+	it holds no state other than the root and the current node, thus copying
+	an iterator is cheap. It doesn't own the tree, which must remain alive
+	while the iterator is used.
+*/
 template <typename T> class EXP treeIterator : public std::iterator<std::input_iterator_tag, T>
 {
 	protected:
-		typedef typename std::vector<T>::iterator nodes_iterator;
-		typedef std::pair<nodes_iterator, T> state;
+		typedef typename T::element_type	node;	// T is a smart pointer type
+		typedef ctree<node>					tree;
+
+		tree*	fRoot;
+		node*	fCurrent;			// 0 at end
 
-		std::stack<state>	fStack;
-		T					fRootElement;
-		nodes_iterator		fCurrentIterator;
+		static node* cast (tree* t)	{ return static_cast<node*>(t); }
+
+		// moves to the next sibling of n or of its closest ancestor below the root
+		void up (tree* n) {
+			while (n && (n != fRoot)) {
+				tree* parent = n->fParent;
+				int i = n->getIndex();
+				if (!parent || (i < 0)) break;
+				const typename tree::branchs& elts = parent->elements();
+				if (size_t(i + 1) < elts.size()) {
+					fCurrent = elts[i + 1];
+					return;
+				}
+				n = parent;
+			}
+			fCurrent = 0;
+		}
 
 	public:
-				 treeIterator() {}
-				 treeIterator(const T& t, bool end=false) {
-					 fRootElement = t;
-					 if (end) fCurrentIterator = t->elements().end();
-					 else forward_down (t);
+				 treeIterator() : fRoot(0), fCurrent(0) {}
+				 treeIterator(const T& t, bool end=false) : fRoot(t), fCurrent(0) {
+					 if (!end) forward_down (t);
 				 }
-				 treeIterator(const treeIterator& a)  { *this = a; }
 		virtual ~treeIterator() {}
 		
-		T operator  *() const	{ return *fCurrentIterator; }
-		T operator ->() const	{ return *fCurrentIterator; } 
+		T operator  *() const	{ return fCurrent; }
+		T operator ->() const	{ return fCurrent; }
 		
 		//________________________________________________________________________
-		T getParent() const		{ return fStack.size() ? fStack.top().second : fRootElement; }
+		T getParent() const		{ return cast((fCurrent && fCurrent->fParent) ? fCurrent->fParent : fRoot); }
 		
 		//________________________________________________________________________
 		// current element has sub-elements: go down to sub-elements first			
 		virtual void forward_down(const T& t) {
-			fCurrentIterator = t->elements().begin();
-			if (fCurrentIterator != t->elements().end())
-				fStack.push( make_pair(fCurrentIterator+1, t));
+			fCurrent = t->size() ? (node*)t->elements()[0] : 0;
 		}
 
 		//________________________________________________________________________
-		// current element is empty: go up to parent element and possibly down to neighbor element
-		void forward_up() {
-			while (fStack.size()) {
-				state s = fStack.top();
-				fStack.pop();
-
-				fCurrentIterator = s.first;
-				if (fCurrentIterator != s.second->elements().end()) {
-					fStack.push( make_pair(fCurrentIterator+1, s.second));
-					return;
-				}
-			}
-		}
+		// skips the current element sub-elements: go to the next element at the same level or above
+		void forward_up()		{ if (fCurrent) up (fCurrent); }
 		
 		//________________________________________________________________________
 		// move the iterator forward
 		void forward() {
-			if ((*fCurrentIterator)->size()) forward_down(*fCurrentIterator);
-			else forward_up();
+			if (fCurrent->size()) fCurrent = fCurrent->elements()[0];
+			else up (fCurrent);
 		}
 		treeIterator& operator ++()		{ forward(); return *this; }
 		treeIterator& operator ++(int)	{ forward(); return *this; }
 
 		//________________________________________________________________________
+		// removes the current element, the iterator moves to the next element at the same level or above
 		treeIterator& erase() {
-			T parent = getParent();
-			fCurrentIterator = parent->elements().erase(fCurrentIterator);
-			if (fStack.size()) fStack.pop();
-			if (fCurrentIterator != parent->elements().end()) {
-				fStack.push( make_pair(fCurrentIterator+1, parent));
-			}
-			else forward_up();
+			tree* parent = fCurrent->fParent;
+			int i = fCurrent->getIndex();
+			if (!parent || (i < 0)) { fCurrent = 0; return *this; }
+			parent->remove (i);
+			if (size_t(i) < parent->elements().size()) fCurrent = parent->elements()[i];
+			else up (parent);
 			return *this; 
 		}
 
 		//________________________________________________________________________
+		// inserts an element before the current one, the iterator points to the new element
 		treeIterator& insert(const T& value) {
-			T parent = getParent();
-			fCurrentIterator = parent->elements().insert(fCurrentIterator, value);
-			if (fStack.size()) fStack.pop();
-			fStack.push( make_pair(fCurrentIterator+1, parent));
+			tree* parent = fCurrent ? fCurrent->fParent : fRoot;
+			int i = fCurrent ? fCurrent->getIndex() : parent->size();
+			parent->insertAt (i, value);
+			fCurrent = parent->elements()[i];
 			return *this;
 		}
 
 		//________________________________________________________________________
 		bool operator ==(const treeIterator& i) const		{ 
-			// we check that the iterators have the same parent (due to iterator compatibility issue with visual c++)
-			return getParent() == i.getParent() ?  ( fCurrentIterator==i.fCurrentIterator ) : false;
+			return (fCurrent == i.fCurrent) && (fCurrent || (fRoot == i.fRoot));
 		}
 		bool operator !=(const treeIterator& i) const		{ return !(*this == i); }
 };
 
+/*!
+\brief a deferred loader of a tree node sub elements
+
+	A loader is attached to a node whose sub elements are not built yet.
+	It is called and released the first time the node sub elements are accessed.
+*/
+//______________________________________________________________________________
+template <typename T> class EXP ctreeloader : virtual public smartable
+{
+	public:
+		//! builds the sub elements of \c node
+		virtual void load (T& node) = 0;
+
+	protected:
+				 ctreeloader() {}
+		virtual ~ctreeloader() {}
+};
+
 /*!
 \brief a simple tree representation
 */
@@ -130,26 +159,114 @@ template <typename T> class EXP ctree : virtual public smartable
 
 		static treePtr new_tree() { ctree<T>* o = new ctree<T>; assert(o!=0); return o; }
 		
-		branchs& elements()						{ return fElements; }		
-		const branchs& elements() const			{ return fElements; }		
-		virtual void push (const treePtr& t)	{ fElements.push_back(t); }
-		virtual int  size  () const				{ return int(fElements.size()); }
-		virtual bool empty () const				{ return fElements.size()==0; }
+		typedef SMARTP<ctreeloader<T> >		loaderPtr;	///< the deferred sub elements loader type
+
+		/*! \brief the node sub elements
+
+			A node has a single parent, used by the tree iterator: a node can't be a sub element
+			of two nodes, thus the tree methods add a copy of a node that is still a sub element
+			of another node (i.e. nodes are not shared between trees anymore).
+			The sub elements should be modified using the tree methods (push, insertAt, erase,
+			replace), which maintain the parent links and call modified(). When the vector is
+			modified directly (e.g. to reorder the sub elements), reordered() must be called:
+			otherwise the parent links are only repaired by getIndex at the cost of a linear
+			search in the siblings, and the changes are not notified.
+			Note that the deferred sub elements are built on first access, even using the const
+			version: a tree is safely read by several threads only once frozen (see TXMLFile::freeze).
+		*/
+		branchs& elements()						{ if (fLoader) load(); return fElements; }
+		const branchs& elements() const			{ if (fLoader) const_cast<ctree*>(this)->load(); return fElements; }
+		virtual void push (const treePtr& t)	{ branchs& elts = elements(); elts.push_back(adopt (t, int(elts.size()))); modified(); }
+		virtual void push (treePtr&& t)			{
+			branchs& elts = elements();
+			if (attached (t)) t = t->clone();
+			t->setParent (this, int(elts.size()));
+			elts.push_back(std::move(t));
+			modified();
+		}
+		//! adds a newly allocated node, the smart pointer is built in place
+		void emplace (T* t)						{ branchs& elts = elements(); t->setParent (this, int(elts.size())); elts.emplace_back(t); modified(); }
+		//! inserts a node before the sub element at index i
+		void insertAt (int i, const treePtr& t) {
+			branchs& elts = elements();
+			elts.insert (elts.begin() + i, adopt (t, i));
+			reindex (i);
+			modified();
+		}
+		//! replaces the sub element at index i, the previous sub element is detached
+		void replace (int i, const treePtr& t)	{
+			branchs& elts = elements();
+			if (elts[i] == t) return;
+			if (elts[i]->fParent == this) elts[i]->setParent (0, -1);
+			elts[i] = adopt (t, i);
+			modified();
+		}
+		//! updates the parent links after the sub elements have been reordered from index i using the elements() vector
+		void reordered (int i=0)				{ reindex (i); modified(); }
+		virtual int  size  () const				{ return int(elements().size()); }
+		virtual bool empty () const				{ return elements().size()==0; }
+
+		//! defers the sub elements building until their first access
+		void setLoader (const loaderPtr& loader)	{ fLoader = loader; }
+		//! returns false when the sub elements are not built yet
+		bool loaded () const						{ return fLoader == 0; }
 
 		iterator begin()			{ treePtr start=dynamic_cast<T*>(this); return iterator(start); }
 		iterator end()				{ treePtr start=dynamic_cast<T*>(this); return iterator(start, true); }
 		iterator erase(iterator i)	{ return i.erase(); }
 		iterator insert(iterator before, const treePtr& value)	{ return before.insert(value); }
 		
-		literator lbegin() { return fElements.begin(); }
-		literator lend()   { return fElements.end(); }
+		literator lbegin() { return elements().begin(); }
+		literator lend()   { return elements().end(); }
+
+		//! the node parent (not owned), 0 for a root node
+		T*		getParent () const		{ return static_cast<T*>(fParent); }
+		//! the node index in its parent sub elements, -1 for a root node
+		int		getIndex () const {
+			if (!fParent) return -1;
+			const branchs& elts = fParent->fElements;
+			// the index is a hint: the sub elements may have been reordered using the elements() vector
+			if ((fIndex >= 0) && (size_t(fIndex) < elts.size()) && (elts[fIndex] == this)) return fIndex;
+			for (size_t i = 0; i < elts.size(); i++)
+				if (elts[i] == this) return fIndex = int(i);
+			return -1;
+		}
 
 	protected:
-				 ctree() {}
-		virtual ~ctree() {}
+				 ctree() : fParent(0), fIndex(-1) {}
+		// the sub elements that may survive the node don't refer to it anymore
+		virtual ~ctree() {
+			for (size_t i = 0; i < fElements.size(); i++)
+				if (fElements[i]->fParent == this) fElements[i]->setParent (0, -1);
+		}
+
+		//! called when the node sub elements are added or removed
+		virtual void modified ()	{}
 
 	private:
-		branchs	 fElements;
+		friend class treeIterator<treePtr>;
+
+		branchs	 	fElements;
+		loaderPtr	fLoader;
+		ctree*		fParent;		// the parent node, not owned
+		mutable int	fIndex;			// the node index in the parent sub elements
+
+		void setParent (ctree* parent, int index)	{ fParent = parent; fIndex = index; }
+		// a node that is still a sub element of another node is copied (see elements())
+		static bool attached (const treePtr& t)		{ return t->fParent && (t->getIndex() >= 0); }
+		treePtr adopt (const treePtr& t, int index)	{ treePtr n = attached (t) ? treePtr(t->clone()) : t; n->setParent (this, index); return n; }
+		void reindex (size_t from) {
+			for (size_t i = from; i < fElements.size(); i++) fElements[i]->setParent (this, int(i));
+		}
+		void remove (int i) {
+			branchs& elts = elements();
+			elts[i]->setParent (0, -1);
+			elts.erase (elts.begin() + i);
+			reindex (i);
+			modified();
+		}
+		// the loader is released before loading to prevent recursive calls
+		void load()	{ loaderPtr loader = fLoader; fLoader = loaderPtr(); loader->load(*dynamic_cast<T*>(this)); }
 };
 
 
@@ -0,0 +1,293 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <limits.h>
+#include <locale.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "numbers.h"
+#include "rational.h"
+
+namespace MusicXML2
+{
+
+// powers of ten that are exactly represented as doubles
+static const double kPow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+								1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+static const char kDigits[] =
+	"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+	"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+static inline bool isSpace (char c)		{ return (c == ' ') || ((c >= '\t') && (c <= '\r')); }
+static inline bool isDigit (char c)		{ return (c >= '0') && (c <= '9'); }
+
+//______________________________________________________________________________
+// the locale decimal point is replaced by '.' (or conversely) in the
+// text given to or produced by the C library
+//______________________________________________________________________________
+static const char* decimalPoint ()
+{
+	const char* dp = localeconv()->decimal_point;
+	return (dp && *dp) ? dp : ".";
+}
+
+static void toDot (char* buff)
+{
+	const char* dp = decimalPoint();
+	if ((dp[0] == '.') && !dp[1]) return;
+	char* ptr = strstr (buff, dp);
+	if (ptr) {
+		size_t n = strlen (dp);
+		*ptr = '.';
+		if (n > 1) memmove (ptr + 1, ptr + n, strlen (ptr + n) + 1);
+	}
+}
+
+//______________________________________________________________________________
+// formatting
+//______________________________________________________________________________
+char* formatUInt (unsigned long value, char* buff)
+{
+	char tmp[kMaxNumberSize];
+	char* ptr = tmp + kMaxNumberSize;
+	while (value >= 100) {
+		const char* d = kDigits + (value % 100) * 2;
+		value /= 100;
+		*--ptr = d[1];
+		*--ptr = d[0];
+	}
+	if (value >= 10) {
+		const char* d = kDigits + value * 2;
+		*--ptr = d[1];
+		*--ptr = d[0];
+	}
+	else *--ptr = char('0' + value);
+	size_t n = size_t(tmp + kMaxNumberSize - ptr);
+	memcpy (buff, ptr, n);
+	buff[n] = 0;
+	return buff + n;
+}
+
+char* formatInt (long value, char* buff)
+{
+	if (value >= 0) return formatUInt ((unsigned long)value, buff);
+	*buff++ = '-';
+	return formatUInt (0UL - (unsigned long)value, buff);
+}
+
+char* formatRational (long num, long denom, char* buff)
+{
+	buff = formatInt (num, buff);
+	*buff++ = '/';
+	return formatInt (denom, buff);
+}
+
+//______________________________________________________________________________
+// %g with 6 significant digits: the value is written in fixed notation when
+// its decimal exponent (after rounding) is in [-4, 6[, which is the common case.
+// For values that are exactly represented as floats, the scaled value
+// (at most 24 + 31 bits) is exact and thus correctly rounded by rint.
+// The other values are written by the C library.
+char* formatFloat (double value, char* buff)
+{
+	double a = fabs(value);
+	if ((a >= 1e-4) && (a < 1e6) && (double(float(value)) == value)) {
+		int e = 5;
+		while ((e > 0) && (a < kPow10[e])) e--;
+		if (a < 1) {
+			e = -1;
+			while (a * kPow10[-e] < 1) e--;
+		}
+		double r = rint (a * kPow10[5 - e]);
+		if (r >= 1e6) { r /= 10; e++; }
+		if (e < 6) {
+			char digits[8];
+			formatUInt ((unsigned long)r, digits);		// exactly 6 digits
+			int n = 6;
+			while (digits[n-1] == '0') n--;			// trailing zeros are removed
+			char* ptr = buff;
+			if (value < 0) *ptr++ = '-';
+			if (e < 0) {
+				*ptr++ = '0';
+				*ptr++ = '.';
+				for (int i = -1; i > e; i--) *ptr++ = '0';
+				memcpy (ptr, digits, n);
+				ptr += n;
+			}
+			else {
+				memcpy (ptr, digits, e + 1);
+				ptr += e + 1;
+				if (n > e + 1) {
+					*ptr++ = '.';
+					memcpy (ptr, digits + e + 1, n - e - 1);
+					ptr += n - e - 1;
+				}
+			}
+			*ptr = 0;
+			return ptr;
+		}
+	}
+	else if ((value == 0) && !signbit(value)) {
+		buff[0] = '0';
+		buff[1] = 0;
+		return buff + 1;
+	}
+	snprintf (buff, kMaxNumberSize, "%.6g", value);
+	toDot (buff);
+	return buff + strlen(buff);
+}
+
+//______________________________________________________________________________
+// parsing
+//______________________________________________________________________________
+const char* parseInt (const char* str, long& value, bool* overflow)
+{
+	const char* ptr = str;
+	while (isSpace(*ptr)) ptr++;
+	bool neg = (*ptr == '-');
+	if (neg || (*ptr == '+')) ptr++;
+	if (overflow) *overflow = false;
+	if (!isDigit(*ptr)) { value = 0; return str; }
+
+	const unsigned long limit = neg ? 0UL - (unsigned long)LONG_MIN : (unsigned long)LONG_MAX;
+	unsigned long v = 0;
+	bool over = false;
+	while (isDigit(*ptr)) {
+		unsigned long d = (unsigned long)(*ptr++ - '0');
+		if (!over && (v <= (limit - d) / 10)) v = v * 10 + d;
+		else over = true;
+	}
+	if (over) {
+		if (overflow) *overflow = true;
+		value = neg ? LONG_MIN : LONG_MAX;
+	}
+	else value = neg ? long(0UL - v) : long(v);
+	return ptr;
+}
+
+//______________________________________________________________________________
+// decimal numbers with at most 19 significant digits and a small exponent are
+// converted exactly using a single multiplication or division (both operands are
+// exact doubles thus the result is correctly rounded, like strtod)
+const char* parseFloat (const char* str, double& value)
+{
+	const char* ptr = str;
+	while (isSpace(*ptr)) ptr++;
+	bool neg = (*ptr == '-');
+	if (neg || (*ptr == '+')) ptr++;
+
+	bool fallback = !(isDigit(*ptr) || ((*ptr == '.') && isDigit(ptr[1])))	// inf, nan
+					|| ((ptr[0] == '0') && ((ptr[1] == 'x') || (ptr[1] == 'X')));	// hexadecimal
+	if (!fallback) {
+		unsigned long long m = 0;
+		int ndigits = 0, exp10 = 0;
+		while (*ptr == '0') ptr++;
+		for (; isDigit(*ptr); ptr++) {
+			if (ndigits < 19) { m = m * 10 + unsigned(*ptr - '0'); ndigits++; }
+			else exp10++;
+		}
+		if (*ptr == '.') {
+			ptr++;
+			if (!m) for (; *ptr == '0'; ptr++) exp10--;
+			for (; isDigit(*ptr); ptr++) {
+				if (ndigits < 19) { m = m * 10 + unsigned(*ptr - '0'); ndigits++; exp10--; }
+			}
+		}
+		if ((*ptr == 'e') || (*ptr == 'E')) {
+			const char* e = ptr + 1;
+			bool eneg = (*e == '-');
+			if (eneg || (*e == '+')) e++;
+			if (isDigit(*e)) {
+				int x = 0;
+				for (; isDigit(*e); e++) if (x < 10000) x = x * 10 + (*e - '0');
+				exp10 += eneg ? -x : x;
+				ptr = e;
+			}
+		}
+		if (!m) { value = neg ? -0.0 : 0.0; return ptr; }
+		if ((m < (1ULL << 53)) && (exp10 >= -22) && (exp10 <= 22)) {
+			double v = double(m);
+			v = (exp10 < 0) ? v / kPow10[-exp10] : v * kPow10[exp10];
+			value = neg ? -v : v;
+			return ptr;
+		}
+	}
+
+	// the remaining cases are handled by strtod, using the locale decimal point
+	char* end;
+	const char* dp = decimalPoint();
+	if ((dp[0] == '.') && !dp[1]) {
+		value = strtod (str, &end);
+		return end;
+	}
+	char tmp[256];
+	char* out = tmp;
+	const char* in = str;
+	while (*in && (out < tmp + sizeof(tmp) - 8)) {
+		if (*in == '.') {
+			for (const char* d = dp; *d; ) *out++ = *d++;
+			in++;
+		}
+		else *out++ = *in++;
+	}
+	*out = 0;
+	value = strtod (tmp, &end);
+	size_t n = 0;											// maps the end of the number back to str
+	for (const char* t = tmp; t < end; n++) t += (str[n] == '.') ? strlen(dp) : 1;
+	return str + n;
+}
+
+//______________________________________________________________________________
+const char* parseRational (const char* str, long& num, long& denom)
+{
+	const char* ptr = parseInt (str, num);
+	denom = 1;
+	if (ptr == str) return str;
+	const char* next = ptr;
+	while (isSpace(*next)) next++;
+	if (*next == '/') {
+		const char* end = parseInt (next + 1, denom);
+		if (end != next + 1) ptr = end;
+		else denom = 1;
+	}
+	return ptr;
+}
+
+//______________________________________________________________________________
+// numbuffer
+//______________________________________________________________________________
+numbuffer& numbuffer::operator << (const char* str)
+{
+	char* end = fBuff + kSize - 1;
+	while (*str && (fPtr < end)) *fPtr++ = *str++;
+	*fPtr = 0;
+	return *this;
+}
+
+numbuffer& numbuffer::operator << (const rational& r)
+{
+	if (room()) fPtr = formatInt (r.getNumerator(), fPtr);
+	*this << '/';
+	if (room()) fPtr = formatInt (r.getDenominator(), fPtr);
+	return *this;
+}
+
+}
@@ -0,0 +1,96 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __numbers__
+#define __numbers__
+
+#include <string>
+
+#include "exports.h"
+
+class rational;
+
+namespace MusicXML2
+{
+
+/*!
+\addtogroup MusicXML
+@{
+*/
+
+/*
+	Numbers to and from text conversions.
+
+	The conversions operate on char buffers: they don't allocate and they
+	don't depend on the current locale (the decimal point is always '.').
+	The output is the same as the default output of the standard streams
+	i.e. floating point values are written using the %g format with 6
+	significant digits.
+*/
+
+//! the size required by the format functions to write any number
+enum { kMaxNumberSize = 32 };
+
+//! writes a value to buff (which must be at least kMaxNumberSize long), returns a pointer to the end of the written text
+EXP char*	formatInt		(long value, char* buff);
+EXP char*	formatUInt		(unsigned long value, char* buff);
+EXP char*	formatFloat		(double value, char* buff);
+//! writes a rational as "num/denom", buff must be at least 2 * kMaxNumberSize long
+EXP char*	formatRational	(long num, long denom, char* buff);
+
+/*! parses a number at the beginning of a string
+	Leading white spaces are skipped, the functions return a pointer to the first
+	char following the number or str when no number is found.
+	\c overflow is set to true when an integer is out of the long range.
+*/
+EXP const char*	parseInt		(const char* str, long& value, bool* overflow=0);
+EXP const char*	parseFloat		(const char* str, double& value);
+//! parses a rational "num[/denom]", the denominator is 1 when not specified
+EXP const char*	parseRational	(const char* str, long& num, long& denom);
+
+//______________________________________________________________________________
+/*!
+\brief A fixed size text buffer to build short strings made of numbers.
+
+	numbuffer is intended to replace the string streams used to build
+	parameters like "dx=12.5hs": the text is truncated when it exceeds the buffer size.
+*/
+class EXP numbuffer {
+	enum { kSize = 4 * kMaxNumberSize };
+	char	fBuff[kSize];
+	char*	fPtr;
+
+	bool	room () const	{ return (fPtr - fBuff) < (kSize - kMaxNumberSize); }
+
+	public:
+				 numbuffer() : fPtr(fBuff) { *fPtr = 0; }
+
+		numbuffer& operator << (const char* str);
+		numbuffer& operator << (char c)				{ if (room()) { *fPtr++ = c; *fPtr = 0; } return *this; }
+		numbuffer& operator << (int value)			{ if (room()) fPtr = formatInt (value, fPtr); return *this; }
+		numbuffer& operator << (long value)			{ if (room()) fPtr = formatInt (value, fPtr); return *this; }
+		numbuffer& operator << (unsigned int value)	{ if (room()) fPtr = formatUInt (value, fPtr); return *this; }
+		numbuffer& operator << (unsigned long value){ if (room()) fPtr = formatUInt (value, fPtr); return *this; }
+		numbuffer& operator << (float value)		{ if (room()) fPtr = formatFloat (value, fPtr); return *this; }
+		numbuffer& operator << (double value)		{ if (room()) fPtr = formatFloat (value, fPtr); return *this; }
+		numbuffer& operator << (const rational& r);
+
+		const char*	c_str () const		{ return fBuff; }
+		size_t		size () const		{ return size_t(fPtr - fBuff); }
+		std::string	str () const		{ return std::string (fBuff, size()); }
+};
+
+/*! @} */
+
+}
+
+#endif
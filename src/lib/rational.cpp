@@ -11,7 +11,8 @@
 */
 
 #include "rational.h"
-#include <sstream>
+#include "numbers.h"
+#include <iostream>
 #include <cmath>
 #include <stdlib.h>
 #include <string.h>
@@ -19,13 +20,7 @@
 //______________________________________________________________________________
 rational::rational (const string &str)
 {
-  const char *cstr;
-  cstr = str.c_str();
-  const char *denom;
-  denom = strstr(cstr,"/");
-  if (denom) ++denom;
-  fNumerator = atol(cstr);
-  if (denom) fDenominator = atol(denom);
+  MusicXML2::parseRational (str.c_str(), fNumerator, fDenominator);
 }
 
 rational::rational(long int num, long int denom) : fNumerator(num), fDenominator(denom)
@@ -180,9 +175,8 @@ float rational::toFloat() const
 //______________________________________________________________________________
 string rational::toString () const
 {
-  ostringstream res;
-  res << fNumerator << "/" << fDenominator;
-  return res.str ();
+  char buff[2 * MusicXML2::kMaxNumberSize];
+  return string (buff, MusicXML2::formatRational (fNumerator, fDenominator, buff));
 }
 
 rational::operator string () const		{ return toString (); }
@@ -13,6 +13,7 @@
 #ifndef __smartpointer__
 #define __smartpointer__
 
+#include <atomic>
 #include <cassert>
 #include "exports.h"
 
@@ -28,20 +29,33 @@ namespace MusicXML2
 */
 class EXP smartable {
 	private:
-		unsigned 	refCount;		
+		std::atomic<unsigned>	refCount;
+		bool					fShared;
+
+		unsigned	increment ()	{ if (fShared) return refCount.fetch_add(1, std::memory_order_relaxed) + 1;
+									  unsigned n = refCount.load(std::memory_order_relaxed) + 1; refCount.store(n, std::memory_order_relaxed); return n; }
+		unsigned	decrement ()	{ if (fShared) return refCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+									  unsigned n = refCount.load(std::memory_order_relaxed) - 1; refCount.store(n, std::memory_order_relaxed); return n; }
 	public:
 		//! gives the reference count of the object
-		unsigned refs() const         { return refCount; }
+		unsigned refs() const         { return refCount.load(std::memory_order_relaxed); }
 		//! addReference increments the ref count and checks for refCount overflow
-		void addReference()           { refCount++; assert(refCount != 0); }
+		void addReference()           { unsigned n = increment(); assert(n != 0); (void)n; }
 		//! removeReference delete the object when refCount is zero		
-		void removeReference()		  { if (--refCount == 0) delete this; }
+		void removeReference()		  { if (decrement() == 0) delete this; }
+
+		/*! \brief switches the reference counting to atomic updates
+			A shared object may be referenced from several threads. The state must be
+			changed while the object is used by a single thread.
+		*/
+		void setShared (bool state)   { fShared = state; }
+		bool shared () const          { return fShared; }
 		
 	protected:
-		smartable() : refCount(0) {}
-		smartable(const smartable&): refCount(0) {}
+		smartable() : refCount(0), fShared(false) {}
+		smartable(const smartable&): refCount(0), fShared(false) {}
 		//! destructor checks for non-zero refCount
-		virtual ~smartable()    { assert (refCount == 0); }
+		virtual ~smartable()    { assert (refs() == 0); }
 		smartable& operator=(const smartable&) { return *this; }
 };
 
@@ -59,8 +73,12 @@ template<class T> class SMARTP {
 	private:
 		//! the actual pointer to the class
 		T* fSmartPtr;
+		template<class T2> friend class SMARTP;
 
 	public:
+		//! the pointed type
+		typedef T element_type;
+
 		//! an empty constructor - points to null
 		SMARTP()	: fSmartPtr(0) {}
 		//! build a smart pointer from a class pointer
@@ -70,6 +88,11 @@ template<class T> class SMARTP {
 		SMARTP(const SMARTP<T2>& ptr) : fSmartPtr((T*)ptr) { if (fSmartPtr) fSmartPtr->addReference(); }
 		//! build a smart pointer from another smart pointer reference
 		SMARTP(const SMARTP& ptr) : fSmartPtr((T*)ptr)     { if (fSmartPtr) fSmartPtr->addReference(); }
+		//! move a smart pointer: the reference is transferred, the ref count is unchanged
+		SMARTP(SMARTP&& ptr) noexcept : fSmartPtr(ptr.fSmartPtr)	{ ptr.fSmartPtr = 0; }
+		//! move a convertible smart pointer
+		template<class T2>
+		SMARTP(SMARTP<T2>&& ptr) noexcept : fSmartPtr((T*)ptr.fSmartPtr)	{ ptr.fSmartPtr = 0; }
 
 		//! the smart pointer destructor: simply removes one reference count
 		~SMARTP()  { if (fSmartPtr) fSmartPtr->removeReference(); }
@@ -110,12 +133,22 @@ template<class T> class SMARTP {
 		}
 		//! operator = to support inherited class reference
 		SMARTP& operator=(const SMARTP<T>& p_)                { return operator=((T *) p_); }
+		//! move assignment: the reference is transferred
+		SMARTP& operator=(SMARTP<T>&& p_) noexcept {
+			if (this != &p_) {
+				T* old = fSmartPtr;
+				fSmartPtr = p_.fSmartPtr;
+				p_.fSmartPtr = 0;
+				if (old != 0) old->removeReference();
+			}
+			return *this;
+		}
 		//! dynamic cast support
 		template<class T2> SMARTP& cast(T2* p_)               { return operator=(dynamic_cast<T*>(p_)); }
 		//! dynamic cast support
 		template<class T2> SMARTP& cast(const SMARTP<T2>& p_) { return operator=(dynamic_cast<T*>(p_)); }
 		//! operator < (require by VC6 for maps)
-		bool operator < (const SMARTP<T>& p_) const			  { return (void*)this < (void*)p_; }
+		bool operator < (const SMARTP<T>& p_) const			  { return (void*)fSmartPtr < (void*)p_; }
 };
 
 }
@@ -17,6 +17,7 @@
 #include "basevisitor.h"
 #include "browser.h"
 #include "ctree.h"
+#include "tree_walker.h"
 
 namespace MusicXML2 
 {
@@ -29,6 +30,8 @@ template <typename T> class EXP tree_browser : public browser<T>
 
 		virtual void enter (T& t)		{ t.acceptIn(*fVisitor); }
 		virtual void leave (T& t)		{ t.acceptOut(*fVisitor); }
+		//! gives a chance to browse a node and its content differently: returns true when done
+		virtual bool intercept (T& t)	{ return false; }
 
 	public:
 		typedef typename ctree<T>::treePtr treePtr;
@@ -38,11 +41,12 @@ template <typename T> class EXP tree_browser : public browser<T>
 
 		virtual void set (basevisitor* v)	{  fVisitor = v; }
 		virtual void browse (T& t) {
-			enter(t);
-			typename ctree<T>::literator iter;
-			for (iter = t.lbegin(); iter != t.lend(); iter++)
-				browse(**iter);
-			leave(t);
+			tree_walker<T> walker(t);
+			for (typename tree_walker<T>::event e = walker.next(); e.node; e = walker.next()) {
+				if (e.phase == tree_walker<T>::kLeave) leave (*e.node);
+				else if (intercept (*e.node)) walker.skip();
+				else enter (*e.node);
+			}
 		}
 };
 
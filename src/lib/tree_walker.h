@@ -0,0 +1,101 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __tree_walker__
+#define __tree_walker__
+
+#include <vector>
+
+#include "exports.h"
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+/*!
+\brief a non recursive tree traversal that delivers enter and leave events on demand
+
+	Each call to next() gives the next event: the entry in a node or the exit
+	from a node, in document order. The traversal state is an explicit stack,
+	thus the walk may be suspended and resumed at any time (e.g. to interleave
+	the walk of several parts) and its depth is not limited by the call stack.
+	\code
+		tree_walker<xmlelement> w(*elt);
+		for (tree_walker<xmlelement>::event e = w.next(); e.node; e = w.next()) {
+			if (e.phase == tree_walker<xmlelement>::kEnter) ...
+		}
+	\endcode
+	The tree must not be modified while walked.
+*/
+template <typename T> class EXP tree_walker
+{
+	public:
+		enum { kEnter, kLeave };
+		typedef struct { T* node; int phase; } event;		//!< a null node denotes the end of the walk
+
+				 tree_walker() : fRoot(0), fMaxDepth(0) {}
+				 tree_walker(T& root) : fRoot(&root), fMaxDepth(0) {}
+		virtual ~tree_walker() {}
+
+		//! restarts the walk from a new root
+		void	reset (T& root)		{ fRoot = &root; fStack.clear(); }
+
+		//! gives the next event
+		event	next () {
+			event e = { 0, kLeave };
+			if (fRoot) {						// the walk starts
+				e.node = fRoot;
+				e.phase = kEnter;
+				fStack.push_back (frame(fRoot));
+				fRoot = 0;
+				return e;
+			}
+			while (fStack.size()) {
+				frame& f = fStack.back();
+				if (f.next < f.node->elements().size()) {
+					T* child = f.node->elements()[f.next++];
+					if (fMaxDepth && (fStack.size() >= fMaxDepth)) continue;	// too deep: ignored
+					fStack.push_back (frame(child));
+					e.node = child;
+					e.phase = kEnter;
+					return e;
+				}
+				e.node = f.node;
+				fStack.pop_back();
+				break;
+			}
+			return e;
+		}
+
+		//! skips the content and the leave event of the node that has just been entered
+		void	skip ()				{ if (fStack.size()) fStack.pop_back(); }
+		//! the count of nodes currently entered
+		size_t	depth () const		{ return fStack.size(); }
+		bool	done () const		{ return !fRoot && fStack.empty(); }
+
+		//! limits the walk depth: the nodes that are deeper are ignored (0 for no limit)
+		void	setMaxDepth (size_t depth)	{ fMaxDepth = depth; }
+
+	private:
+		struct frame {
+			T*		node;
+			size_t	next;		// the next child index
+			frame(T* n) : node(n), next(0) {}
+		};
+		T*					fRoot;		// the root, until it is entered
+		std::vector<frame>	fStack;
+		size_t				fMaxDepth;
+};
+
+}
+
+#endif
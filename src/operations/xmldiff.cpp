@@ -0,0 +1,162 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <map>
+
+#include "elements.h"
+#include "xmldiff.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+// the maximum size of the alignment table, larger regions are paired by position
+enum { kMaxAlignment = 4 * 1024 * 1024 };
+
+static inline bool same (const Sxmlelement& e1, const Sxmlelement& e2)	{ return e1->hash() == e2->hash(); }
+
+//______________________________________________________________________________
+void xmldiff::report (int type, const string& part, int i1, int i2, const Sxmlelement& e1, const Sxmlelement& e2)
+{
+	change c;
+	c.type = type;
+	c.part = part;
+	c.index1 = i1;
+	c.index2 = i2;
+	c.elt1 = e1;
+	c.elt2 = e2;
+	fChanges.push_back (c);
+}
+
+//______________________________________________________________________________
+// pairs the elements of two unmatched regions: the common length is reported
+// as modified, the remaining elements as deleted or inserted
+void xmldiff::pair (const string& part, const vector<Sxmlelement>& v1, size_t b1, size_t e1,
+										const vector<Sxmlelement>& v2, size_t b2, size_t e2)
+{
+	while ((b1 < e1) && (b2 < e2)) {
+		if (!same (v1[b1], v2[b2]))
+			report (kModified, part, int(b1), int(b2), v1[b1], v2[b2]);
+		b1++; b2++;
+	}
+	for (; b1 < e1; b1++) report (kDeleted, part, int(b1), -1, v1[b1], 0);
+	for (; b2 < e2; b2++) report (kInserted, part, -1, int(b2), 0, v2[b2]);
+}
+
+//______________________________________________________________________________
+// the common prefix and suffix are skipped, the remaining regions are aligned
+// using a longest common subsequence when they are small enough
+void xmldiff::align (const string& part, const vector<Sxmlelement>& v1, const vector<Sxmlelement>& v2)
+{
+	size_t b = 0, e1 = v1.size(), e2 = v2.size();
+	while ((b < e1) && (b < e2) && same (v1[b], v2[b])) b++;
+	while ((e1 > b) && (e2 > b) && same (v1[e1-1], v2[e2-1])) { e1--; e2--; }
+
+	size_t n = e1 - b, m = e2 - b;
+	if (!n || !m || (n * m > kMaxAlignment)) {
+		pair (part, v1, b, e1, v2, b, e2);
+		return;
+	}
+
+	// lcs[i][j] is the lcs length of the regions suffixes starting at b+i and b+j
+	// it can't exceed min(n, m) that is less than 2048 due to the table size limit
+	size_t w = m + 1;
+	vector<unsigned short> lcs ((n + 1) * w, 0);
+	for (size_t i = n; i-- > 0; ) {
+		for (size_t j = m; j-- > 0; ) {
+			if (same (v1[b+i], v2[b+j]))	lcs[i*w + j] = lcs[(i+1)*w + j+1] + 1;
+			else							lcs[i*w + j] = max (lcs[(i+1)*w + j], lcs[i*w + j+1]);
+		}
+	}
+
+	size_t i = 0, j = 0, i0 = 0, j0 = 0;
+	while ((i < n) && (j < m)) {
+		if (same (v1[b+i], v2[b+j])) {
+			pair (part, v1, b+i0, b+i, v2, b+j0, b+j);
+			i0 = ++i;
+			j0 = ++j;
+		}
+		else if (lcs[(i+1)*w + j] >= lcs[i*w + j+1]) i++;
+		else j++;
+	}
+	pair (part, v1, b+i0, e1, v2, b+j0, e2);
+}
+
+//______________________________________________________________________________
+void xmldiff::parts (const Sxmlelement& s1, const Sxmlelement& s2)
+{
+	vector<Sxmlelement> header1, header2, parts1, parts2;
+	for (ctree<xmlelement>::literator i = s1->lbegin(); i != s1->lend(); i++)
+		((*i)->getType() == k_part ? parts1 : header1).push_back (*i);
+	for (ctree<xmlelement>::literator i = s2->lbegin(); i != s2->lend(); i++)
+		((*i)->getType() == k_part ? parts2 : header2).push_back (*i);
+	align ("", header1, header2);
+
+	map<string, size_t> ids;
+	for (size_t i = 0; i < parts2.size(); i++)
+		ids.insert (make_pair (parts2[i]->getAttributeValue("id"), i));
+	vector<bool> matched (parts2.size(), false);
+	for (size_t i = 0; i < parts1.size(); i++) {
+		const Sxmlelement& p1 = parts1[i];
+		string id = p1->getAttributeValue("id");
+		map<string, size_t>::const_iterator j = ids.find (id);
+		if ((j == ids.end()) || matched[j->second]) {
+			report (kDeleted, id, int(i), -1, p1, 0);
+			continue;
+		}
+		matched[j->second] = true;
+		const Sxmlelement& p2 = parts2[j->second];
+		if (!same (p1, p2)) align (id, p1->elements(), p2->elements());
+	}
+	for (size_t i = 0; i < parts2.size(); i++) {
+		if (!matched[i]) report (kInserted, parts2[i]->getAttributeValue("id"), -1, int(i), 0, parts2[i]);
+	}
+}
+
+//______________________________________________________________________________
+bool xmldiff::diff (const Sxmlelement& score1, const Sxmlelement& score2)
+{
+	size_t changes = fChanges.size();
+	if (!score1 || !score2) {
+		if (score1) report (kDeleted, "", 0, -1, score1, 0);
+		else if (score2) report (kInserted, "", -1, 0, 0, score2);
+	}
+	else if (same (score1, score2)) return true;
+	else if ((score1->getType() == k_score_partwise) && (score2->getType() == k_score_partwise))
+		parts (score1, score2);
+	else if (score1->getType() == score2->getType())
+		align ("", score1->elements(), score2->elements());
+	else report (kModified, "", 0, 0, score1, score2);
+	return fChanges.size() == changes;
+}
+
+//______________________________________________________________________________
+void xmldiff::print (ostream& out) const
+{
+	static const char* types[] = { "modified", "inserted", "deleted" };
+	for (size_t i = 0; i < fChanges.size(); i++) {
+		const change& c = fChanges[i];
+		const Sxmlelement& elt = c.elt1 ? c.elt1 : c.elt2;
+		if (c.part.size()) out << "part " << c.part << ": ";
+		out << types[c.type] << " " << elt->getName();
+		string number = elt->getAttributeValue("number");
+		if (number.size()) out << " " << number;
+		out << " [" << c.index1 << ", " << c.index2 << "]" << endl;
+	}
+}
+
+}
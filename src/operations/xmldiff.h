@@ -0,0 +1,92 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmldiff__
+#define __xmldiff__
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "exports.h"
+#include "smartpointer.h"
+#include "xml.h"
+
+namespace MusicXML2
+{
+
+/*!
+\addtogroup MusicXML
+@{
+*/
+
+//______________________________________________________________________________
+/*!
+\brief Computes the differences between two scores at the measures level.
+
+	The parts of partwise scores are matched by id and their measures are aligned
+	using the subtrees hashes (see xmlelement::hash): the identical measures are
+	matched without being browsed, thus comparing two versions of a score costs
+	mainly the browse of the modified measures. The elements of the score header
+	(work, identification, part-list...) are aligned the same way.
+	Other documents (e.g. timewise scores) are compared at their root children level.
+
+	The measures between two identical ones are paired and reported as modified,
+	the remaining ones are reported as inserted or deleted.
+	The subtrees equality relies on 64 bits hashes: it is exact in practice but
+	remains probabilistic.
+*/
+class EXP xmldiff : public smartable
+{
+	public:
+		enum changetype { kModified, kInserted, kDeleted };
+		struct change {
+			int				type;		//!< the change type (see changetype)
+			std::string		part;		//!< the part id, empty for the header or for non partwise scores
+			int				index1;		//!< the element index in the first score, -1 for an inserted element
+			int				index2;		//!< the element index in the second score, -1 for a deleted element
+			Sxmlelement		elt1;		//!< the element in the first score, null for an inserted element
+			Sxmlelement		elt2;		//!< the element in the second score, null for a deleted element
+		};
+
+	private:
+		std::vector<change>	fChanges;
+
+		void	report	(int type, const std::string& part, int i1, int i2, const Sxmlelement& e1, const Sxmlelement& e2);
+		void	align	(const std::string& part, const std::vector<Sxmlelement>& v1, const std::vector<Sxmlelement>& v2);
+		void	pair	(const std::string& part, const std::vector<Sxmlelement>& v1, size_t b1, size_t e1,
+											  const std::vector<Sxmlelement>& v2, size_t b2, size_t e2);
+		void	parts	(const Sxmlelement& s1, const Sxmlelement& s2);
+
+	protected:
+				 xmldiff() {}
+		virtual ~xmldiff() {}
+
+	public:
+		static SMARTP<xmldiff> create()	{ xmldiff* o = new xmldiff; assert(o!=0); return o; }
+
+		//! compares two scores, returns true when they are identical
+		bool	diff (const Sxmlelement& score1, const Sxmlelement& score2);
+
+		//! clears the changes
+		void	reset ()								{ fChanges.clear(); }
+		const std::vector<change>& changes() const	{ return fChanges; }
+		//! prints the changes, one per line
+		void	print (std::ostream& out) const;
+};
+typedef SMARTP<xmldiff> Sxmldiff;
+
+/*! @} */
+
+}
+
+#endif
@@ -0,0 +1,585 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+/*
+	The fast scanner follows the xml.l tokens and the xml.y grammar:
+	flex picks the longest match and the first listed rule for equal lengths,
+	bison calls the actions without lookahead (all the action states are
+	consistent), thus libmxmllineno at a callback is the line at the end of
+	the last token of the rule. The comments below refer to the xml.l tokens.
+*/
+
+#include <string.h>
+#include <string>
+
+#include "fastxml.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define FASTXML_X86
+# define FASTXML_AVX2
+# define FASTXML_TARGET(t)	__attribute__((target(t)))
+# include <immintrin.h>
+#elif defined(_M_X64)
+# define FASTXML_X86
+# define FASTXML_TARGET(t)
+# include <emmintrin.h>
+# include <intrin.h>
+#endif
+
+using namespace std;
+
+// libmxmllineno is defined by the flex scanner
+extern int libmxmllineno;
+
+#define MAXLEN	1024	// the size of the xml.y names and values buffers
+#define VLEN	256		// the size of the xml.y version buffer
+#define MAXDEPTH 256	// far below the bison stack limit
+
+//______________________________________________________________________________
+// scan functions: they operate on [p, e[ and return e when nothing is found
+//______________________________________________________________________________
+typedef const char* (*findfunction)	 (const char* p, const char* e, char c);
+typedef const char* (*findanyfunction) (const char* p, const char* e, const char* set);	// a 5 chars set
+typedef const char* (*skipfunction)	 (const char* p, const char* e);					// skips [ \t\n\r]
+typedef int			(*countfunction) (const char* p, const char* e, char c);
+
+typedef struct {
+	findfunction	find;
+	findanyfunction	findany;
+	skipfunction	skipspaces;
+	countfunction	count;
+} scanfunctions;
+
+static inline bool isS (char c)	{ return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r'); }
+
+//______________________________________________________________________________
+// scalar implementation
+static const char* scalarFind (const char* p, const char* e, char c)
+{
+	while ((p < e) && (*p != c)) p++;
+	return p;
+}
+
+static const char* scalarFindAny (const char* p, const char* e, const char* set)
+{
+	for (; p < e; p++) {
+		char c = *p;
+		if ((c == set[0]) || (c == set[1]) || (c == set[2]) || (c == set[3]) || (c == set[4])) break;
+	}
+	return p;
+}
+
+static const char* scalarSkipSpaces (const char* p, const char* e)
+{
+	while ((p < e) && isS(*p)) p++;
+	return p;
+}
+
+static int scalarCount (const char* p, const char* e, char c)
+{
+	int n = 0;
+	for (; p < e; p++) if (*p == c) n++;
+	return n;
+}
+
+#ifdef FASTXML_X86
+//______________________________________________________________________________
+static inline int firstbit (unsigned int mask)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward (&index, mask);
+	return int(index);
+#else
+	return __builtin_ctz (mask);
+#endif
+}
+
+static inline int bitcount (unsigned int mask)
+{
+#ifdef _MSC_VER
+	int n = 0;
+	for (; mask; mask &= mask - 1) n++;
+	return n;
+#else
+	return __builtin_popcount (mask);
+#endif
+}
+
+//______________________________________________________________________________
+// SSE2 implementation: 16 bytes at a time
+FASTXML_TARGET("sse2") static const char* sse2Find (const char* p, const char* e, char c)
+{
+	__m128i v = _mm_set1_epi8 (c);
+	for (; p + 16 <= e; p += 16) {
+		int mask = _mm_movemask_epi8 (_mm_cmpeq_epi8 (_mm_loadu_si128 ((const __m128i*)p), v));
+		if (mask) return p + firstbit (mask);
+	}
+	return scalarFind (p, e, c);
+}
+
+FASTXML_TARGET("sse2") static const char* sse2FindAny (const char* p, const char* e, const char* set)
+{
+	__m128i v0 = _mm_set1_epi8 (set[0]), v1 = _mm_set1_epi8 (set[1]), v2 = _mm_set1_epi8 (set[2]);
+	__m128i v3 = _mm_set1_epi8 (set[3]), v4 = _mm_set1_epi8 (set[4]);
+	for (; p + 16 <= e; p += 16) {
+		__m128i b = _mm_loadu_si128 ((const __m128i*)p);
+		__m128i r = _mm_or_si128 (_mm_or_si128 (_mm_cmpeq_epi8 (b, v0), _mm_cmpeq_epi8 (b, v1)),
+								  _mm_or_si128 (_mm_cmpeq_epi8 (b, v2), _mm_cmpeq_epi8 (b, v3)));
+		int mask = _mm_movemask_epi8 (_mm_or_si128 (r, _mm_cmpeq_epi8 (b, v4)));
+		if (mask) return p + firstbit (mask);
+	}
+	return scalarFindAny (p, e, set);
+}
+
+FASTXML_TARGET("sse2") static const char* sse2SkipSpaces (const char* p, const char* e)
+{
+	__m128i sp = _mm_set1_epi8 (' '), tab = _mm_set1_epi8 ('\t'), nl = _mm_set1_epi8 ('\n'), cr = _mm_set1_epi8 ('\r');
+	for (; p + 16 <= e; p += 16) {
+		__m128i b = _mm_loadu_si128 ((const __m128i*)p);
+		__m128i r = _mm_or_si128 (_mm_or_si128 (_mm_cmpeq_epi8 (b, sp), _mm_cmpeq_epi8 (b, tab)),
+								  _mm_or_si128 (_mm_cmpeq_epi8 (b, nl), _mm_cmpeq_epi8 (b, cr)));
+		unsigned int mask = ~_mm_movemask_epi8 (r) & 0xffff;
+		if (mask) return p + firstbit (mask);
+	}
+	return scalarSkipSpaces (p, e);
+}
+
+FASTXML_TARGET("sse2") static int sse2Count (const char* p, const char* e, char c)
+{
+	__m128i v = _mm_set1_epi8 (c);
+	int n = 0;
+	for (; p + 16 <= e; p += 16)
+		n += bitcount (_mm_movemask_epi8 (_mm_cmpeq_epi8 (_mm_loadu_si128 ((const __m128i*)p), v)));
+	return n + scalarCount (p, e, c);
+}
+#endif
+
+#ifdef FASTXML_AVX2
+//______________________________________________________________________________
+// AVX2 implementation: 32 bytes at a time
+// the tails are scalar to avoid the AVX/SSE transition penalties
+FASTXML_TARGET("avx2") static const char* avx2Find (const char* p, const char* e, char c)
+{
+	__m256i v = _mm256_set1_epi8 (c);
+	for (; p + 32 <= e; p += 32) {
+		unsigned int mask = _mm256_movemask_epi8 (_mm256_cmpeq_epi8 (_mm256_loadu_si256 ((const __m256i*)p), v));
+		if (mask) return p + firstbit (mask);
+	}
+	return scalarFind (p, e, c);
+}
+
+FASTXML_TARGET("avx2") static const char* avx2FindAny (const char* p, const char* e, const char* set)
+{
+	__m256i v0 = _mm256_set1_epi8 (set[0]), v1 = _mm256_set1_epi8 (set[1]), v2 = _mm256_set1_epi8 (set[2]);
+	__m256i v3 = _mm256_set1_epi8 (set[3]), v4 = _mm256_set1_epi8 (set[4]);
+	for (; p + 32 <= e; p += 32) {
+		__m256i b = _mm256_loadu_si256 ((const __m256i*)p);
+		__m256i r = _mm256_or_si256 (_mm256_or_si256 (_mm256_cmpeq_epi8 (b, v0), _mm256_cmpeq_epi8 (b, v1)),
+									 _mm256_or_si256 (_mm256_cmpeq_epi8 (b, v2), _mm256_cmpeq_epi8 (b, v3)));
+		unsigned int mask = _mm256_movemask_epi8 (_mm256_or_si256 (r, _mm256_cmpeq_epi8 (b, v4)));
+		if (mask) return p + firstbit (mask);
+	}
+	return scalarFindAny (p, e, set);
+}
+
+FASTXML_TARGET("avx2") static const char* avx2SkipSpaces (const char* p, const char* e)
+{
+	__m256i sp = _mm256_set1_epi8 (' '), tab = _mm256_set1_epi8 ('\t'), nl = _mm256_set1_epi8 ('\n'), cr = _mm256_set1_epi8 ('\r');
+	for (; p + 32 <= e; p += 32) {
+		__m256i b = _mm256_loadu_si256 ((const __m256i*)p);
+		__m256i r = _mm256_or_si256 (_mm256_or_si256 (_mm256_cmpeq_epi8 (b, sp), _mm256_cmpeq_epi8 (b, tab)),
+									 _mm256_or_si256 (_mm256_cmpeq_epi8 (b, nl), _mm256_cmpeq_epi8 (b, cr)));
+		unsigned int mask = ~(unsigned int)_mm256_movemask_epi8 (r);
+		if (mask) return p + firstbit (mask);
+	}
+	return scalarSkipSpaces (p, e);
+}
+
+FASTXML_TARGET("avx2") static int avx2Count (const char* p, const char* e, char c)
+{
+	__m256i v = _mm256_set1_epi8 (c);
+	int n = 0;
+	for (; p + 32 <= e; p += 32)
+		n += bitcount (_mm256_movemask_epi8 (_mm256_cmpeq_epi8 (_mm256_loadu_si256 ((const __m256i*)p), v)));
+	return n + scalarCount (p, e, c);
+}
+#endif
+
+//______________________________________________________________________________
+static scanfunctions gScan = { 0, 0, 0, 0 };
+
+static int cpuLevel ()
+{
+#if defined(FASTXML_AVX2)
+	__builtin_cpu_init ();
+	if (__builtin_cpu_supports ("avx2")) return kAVX2Scan;
+	if (__builtin_cpu_supports ("sse2")) return kSSE2Scan;
+	return kScalarScan;
+#elif defined(FASTXML_X86)
+	return kSSE2Scan;
+#else
+	return kScalarScan;
+#endif
+}
+
+int fastxmlscanlevel (int level)
+{
+	int cpu = cpuLevel();
+	if (level > cpu) level = cpu;
+	switch (level) {
+#ifdef FASTXML_AVX2
+		case kAVX2Scan: {
+			scanfunctions f = { avx2Find, avx2FindAny, avx2SkipSpaces, avx2Count };
+			gScan = f;
+			break;
+		}
+#endif
+#ifdef FASTXML_X86
+		case kSSE2Scan: {
+			scanfunctions f = { sse2Find, sse2FindAny, sse2SkipSpaces, sse2Count };
+			gScan = f;
+			break;
+		}
+#endif
+		default: {
+			scanfunctions f = { scalarFind, scalarFindAny, scalarSkipSpaces, scalarCount };
+			gScan = f;
+			level = kScalarScan;
+		}
+	}
+	return level;
+}
+
+// the scan functions are selected at load time, so that concurrent parsers don't race on their initialization
+static int gScanLevel = fastxmlscanlevel (kAVX2Scan);
+
+//______________________________________________________________________________
+// the parser
+//______________________________________________________________________________
+static inline bool isFirstChar (char c)	{ return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_'); }
+static inline bool isNameChar (char c)	{ return isFirstChar(c) || ((c >= '0') && (c <= '9')) || (c == '-') || (c == '.') || (c == ':'); }
+static inline bool isSpace (char c)		{ return (c == ' ') || (c == '\t'); }
+
+class fastparser
+{
+	const char*	fPtr;
+	const char*	fEnd;
+	int			fLine;
+	int*		fLineRef;			// where the line number is maintained for the reader
+	int			fDepth;
+	reader*		fReader;
+	string		fName, fValue;		// buffers reused across tokens
+
+	// moves forward and counts the lines
+	void	advance (const char* to)	{ fLine += gScan.count (fPtr, to, '\n'); fPtr = to; }
+	bool	at (const char* str) const	{ size_t n = strlen(str); return (size_t(fEnd - fPtr) >= n) && !memcmp (fPtr, str, n); }
+	bool	keyword (const char* str)	{ size_t n = strlen(str); if (!at(str) || ((fPtr + n < fEnd) && isNameChar(fPtr[n]))) return false; fPtr += n; return true; }
+	void	setline () const			{ *fLineRef = fLine; }
+	void	skipspace ()				{ while ((fPtr < fEnd) && isSpace(*fPtr)) fPtr++; }
+	bool	S ()						{ const char* p = gScan.skipspaces (fPtr, fEnd); if (p == fPtr) return false; advance (p); return true; }
+	bool	EQ ()						{ skipspace(); if ((fPtr >= fEnd) || (*fPtr != '=')) return false; fPtr++; skipspace(); return true; }
+	bool	GT ()						{ skipspace(); if ((fPtr >= fEnd) || (*fPtr != '>')) return false; fPtr++; return true; }
+
+	bool	name (string& dst);
+	bool	quoted (string& dst, size_t maxlen);
+	bool	yesno () const;
+	bool	xmldecl ();
+	bool	doctype ();
+	bool	comment ();
+	bool	pi ();
+	bool	element ();
+	bool	content ();
+	bool	endtag ();
+
+	public:
+		fastparser (const char* buffer, size_t size, reader* r, int* lineno)
+			: fPtr(buffer), fEnd(buffer + size), fLine(*lineno), fLineRef(lineno), fDepth(0), fReader(r) {}
+
+		bool parse ();
+		bool parseelement ();
+};
+
+//______________________________________________________________________________
+// NAME: {firstchar}{namechar}*
+bool fastparser::name (string& dst)
+{
+	const char* p = fPtr;
+	if ((p >= fEnd) || !isFirstChar(*p)) return false;
+	while ((p < fEnd) && isNameChar(*p)) p++;
+	if (size_t(p - fPtr) >= MAXLEN) return false;
+	dst.assign (fPtr, p);
+	fPtr = p;
+	return true;
+}
+
+//______________________________________________________________________________
+// QUOTEDSTR: {quote}{valchar}*{quote} (mismatched quotes are accepted), the value is unquoted
+bool fastparser::quoted (string& dst, size_t maxlen)
+{
+	if ((fPtr >= fEnd) || ((*fPtr != '"') && (*fPtr != '\''))) return false;
+	const char* p = gScan.findany (fPtr + 1, fEnd, "\"'<>&");
+	if ((p >= fEnd) || ((*p != '"') && (*p != '\''))) return false;
+	if (size_t(p - fPtr - 1) >= maxlen) return false;
+	dst.assign (fPtr + 1, p);
+	advance (p + 1);
+	return true;
+}
+
+//______________________________________________________________________________
+// checks for the YES and NO tokens of the xml declaration that take precedence over QUOTEDSTR
+bool fastparser::yesno () const
+{
+	if ((fPtr >= fEnd) || ((*fPtr != '"') && (*fPtr != '\''))) return false;
+	const char* p = fPtr + 1;
+	size_t n = 0;
+	if ((fEnd - p >= 3) && !memcmp (p, "yes", 3)) n = 3;
+	else if ((fEnd - p >= 2) && !memcmp (p, "no", 2)) n = 2;
+	return n && (p + n < fEnd) && ((p[n] == '"') || (p[n] == '\''));
+}
+
+//______________________________________________________________________________
+// XMLDECL versiondec decl ENDXMLDECL
+bool fastparser::xmldecl ()
+{
+	string version, encoding;
+	int standalone = -1;
+
+	fPtr += 5;									// "<?xml"
+	if (!S() || !keyword("version") || !EQ() || yesno() || !quoted (version, VLEN)) return false;
+	int decl = 0;
+	while (true) {
+		const char* p = fPtr;
+		skipspace();
+		if (at("?>")) { fPtr += 2; break; }		// {space}*"?>"
+		fPtr = p;
+		if (!S()) return false;
+		if ((decl == 0) && keyword("encoding")) {
+			if (!EQ() || yesno() || !quoted (encoding, MAXLEN)) return false;
+			decl = 1;
+		}
+		else if ((decl < 2) && keyword("standalone")) {
+			if (!EQ() || !yesno()) return false;
+			standalone = (fPtr[1] == 'y') ? 1 : 0;
+			fPtr += standalone ? 5 : 4;
+			decl = 2;
+		}
+		else return false;
+	}
+	setline();
+	return fReader->xmlDecl (version.c_str(), encoding.c_str(), standalone);
+}
+
+//______________________________________________________________________________
+// DOCTYPE SPACE startname SPACE id GT
+bool fastparser::doctype ()
+{
+	string start, pub, sys;
+	bool status;
+
+	fPtr += 9;									// "<!DOCTYPE"
+	if (!S() || !name (start) || (start == "PUBLIC") || (start == "SYSTEM") || !S()) return false;
+	if (keyword ("PUBLIC")) {
+		if (!S() || !quoted (pub, MAXLEN) || !S() || !quoted (sys, MAXLEN)) return false;
+		status = true;
+	}
+	else if (keyword ("SYSTEM")) {
+		if (!S() || !quoted (sys, MAXLEN)) return false;
+		status = false;
+	}
+	else return false;
+	setline();
+	if (!fReader->docType (start.c_str(), status, pub.c_str(), sys.c_str())) return false;
+	return GT();
+}
+
+//______________________________________________________________________________
+// {S}*"<!--" COMMENT "-->" where COMMENT is ([^-]|"-"[^-])*
+// the comment body ends at the first "--" that must be the end of the comment
+bool fastparser::comment ()
+{
+	const char* body = fPtr + 4;
+	const char* p = body;
+	while (true) {
+		p = gScan.find (p, fEnd, '-');
+		if (p + 1 >= fEnd) return false;
+		if (p[1] == '-') break;
+		p += 2;									// "-"[^-]
+	}
+	if ((p + 2 >= fEnd) || (p[2] != '>')) return false;
+	fPtr = body;
+	advance (p);
+	if (p > body) {								// no COMMENT token for empty comments
+		setline();
+		fReader->newComment (string(body, p).c_str());
+	}
+	fPtr = p + 3;
+	return true;
+}
+
+//______________________________________________________________________________
+// {S}*"<?" then <PISECT>.*"?>" : the processing instruction extends
+// to the last "?>" of the line and it includes the "?>"
+bool fastparser::pi ()
+{
+	const char* text = fPtr + 2;
+	const char* eol = gScan.find (text, fEnd, '\n');
+	const char* end = 0;
+	for (const char* p = text; (p = gScan.find (p, eol, '?')) < eol; p++) {
+		if ((p + 1 < eol) && (p[1] == '>')) end = p + 2;
+	}
+	if (!end) return false;
+	fPtr = end;
+	setline();
+	fReader->newProcessingInstruction (string(text, end).c_str());
+	return true;
+}
+
+//______________________________________________________________________________
+// eltstart data eltstop | emptyelt, fPtr is on the '<' followed by a name
+bool fastparser::element ()
+{
+	if (++fDepth > MAXDEPTH) return false;
+	fPtr++;
+	if (!name (fName)) return false;
+	setline();
+	if (!fReader->newElement (fName.c_str())) return false;
+	string elt = fName;
+
+	while (true) {
+		const char* p = fPtr;
+		skipspace();
+		if (fPtr >= fEnd) return false;
+		if (*fPtr == '>') {						// GT: {space}*">"
+			fPtr++;
+			return content();
+		}
+		if (at("/>")) {							// ENDXMLE: {space}*"/>"
+			fPtr += 2;
+			setline();
+			fDepth--;
+			return fReader->endElement (elt.c_str());
+		}
+		// SPACE attribute: a newline before GT or ENDXMLE is a syntax error
+		fPtr = p;
+		if (!S()) return false;
+		if (!name (fName) || !EQ() || !quoted (fValue, MAXLEN)) return false;
+		setline();
+		if (!fReader->newAttribute (fName.c_str(), fValue.c_str())) return false;
+	}
+}
+
+//______________________________________________________________________________
+// data: empty | cdata | elements, followed by eltstop
+bool fastparser::content ()
+{
+	bool children = false;
+	while (true) {
+		const char* lt = gScan.find (fPtr, fEnd, '<');
+		if (lt >= fEnd) return false;
+		const char* p = gScan.skipspaces (fPtr, lt);
+		if (p < lt) {
+			// DATA: {anychar}+ in DATASECT, mixed content is a syntax error
+			// GT and ENDXMLE take precedence over DATA for equal lengths
+			if (children || (lt + 1 >= fEnd) || (lt[1] != '/')) return false;
+			const char* q = fPtr;
+			while (isSpace(*q)) q++;
+			if ((*q == '>') && (q + 1 == lt)) return false;
+			if ((*q == '/') && (q + 2 == lt) && (q[1] == '>')) return false;
+			fValue.assign (fPtr, lt);
+			advance (lt);
+			setline();
+			fReader->setValue (fValue.c_str());
+			return endtag();
+		}
+		// spaces are part of the next token
+		advance (lt);
+		if (at("</"))		return endtag();
+		if (at("<!--"))		{ if (!comment()) return false; }
+		else if (at("<?"))	{ if (at("<?xml") || !pi()) return false; }
+		else if ((fPtr + 1 < fEnd) && isFirstChar(fPtr[1])) { if (!element()) return false; }
+		else return false;
+		children = true;
+	}
+}
+
+//______________________________________________________________________________
+// ENDXMLS endname GT
+bool fastparser::endtag ()
+{
+	fPtr += 2;
+	if (!name (fName)) return false;
+	setline();
+	if (!fReader->endElement (fName.c_str())) return false;
+	fDepth--;
+	return GT();
+}
+
+//______________________________________________________________________________
+// document: prolog element misc
+bool fastparser::parse ()
+{
+	advance (gScan.skipspaces (fPtr, fEnd));
+	if (at("<?xml") && !xmldecl()) return false;
+
+	bool doc = false;
+	while (true) {
+		advance (gScan.skipspaces (fPtr, fEnd));
+		if (at("<!--")) {
+			if (!comment()) return false;
+		}
+		else if (!doc && at("<!DOCTYPE")) {
+			if (!doctype()) return false;
+			doc = true;
+		}
+		else break;
+	}
+	if (!doc || (fPtr + 1 >= fEnd) || (*fPtr != '<') || !isFirstChar(fPtr[1])) return false;
+	if (!element()) return false;
+
+	// misc: an optional SPACE
+	const char* p = gScan.skipspaces (fPtr, fEnd);
+	if (p != fEnd) return false;
+	advance (p);
+	setline();
+	return true;
+}
+
+//______________________________________________________________________________
+// a single element without prolog, surrounded by optional spaces
+bool fastparser::parseelement ()
+{
+	advance (gScan.skipspaces (fPtr, fEnd));
+	if ((fPtr + 1 >= fEnd) || (*fPtr != '<') || !isFirstChar(fPtr[1])) return false;
+	if (!element()) return false;
+	const char* p = gScan.skipspaces (fPtr, fEnd);
+	if (p != fEnd) return false;
+	advance (p);
+	setline();
+	return true;
+}
+
+//______________________________________________________________________________
+bool fastreadbuffer (const char * buffer, size_t size, reader * r)
+{
+	if (!buffer || !r || memchr (buffer, 0, size)) return false;
+	fastparser parser (buffer, size, r, &libmxmllineno);
+	return parser.parse();
+}
+
+//______________________________________________________________________________
+bool fastreadelement (const char * buffer, size_t size, reader * r, int * lineno)
+{
+	if (!buffer || !r || !lineno || memchr (buffer, 0, size)) return false;
+	fastparser parser (buffer, size, r, lineno);
+	return parser.parseelement();
+}
@@ -0,0 +1,56 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __fastxml__
+#define __fastxml__
+
+#include <stddef.h>
+#include "reader.h"
+
+/*
+	A hand-written fast path for the flex/bison parser.
+
+	The fast scanner covers the subset of the xml.l/xml.y language used by
+	common documents and it calls the reader exactly as the flex/bison parser
+	does (same callbacks, same values, same libmxmllineno at each callback).
+	Structural chars are located using SSE2 or AVX2 when available.
+
+	The fast scanner never reports errors: when it meets anything outside of
+	its subset (including syntax errors and reader failures), it gives up and
+	returns false. The caller is then expected to reset the reader state and
+	to parse the document again using the flex/bison parser, so that the
+	result and error messages are unchanged.
+*/
+
+enum { kScalarScan, kSSE2Scan, kAVX2Scan };
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! parses a buffer of a given size, returns false when the document is not handled by the fast path
+bool	fastreadbuffer (const char * buffer, size_t size, reader * r);
+
+/*! parses a single element (no xml declaration nor doctype).
+	The line number is maintained in \c lineno instead of libmxmllineno: it can be used
+	concurrently provided that the readers and the line numbers are distinct.
+*/
+bool	fastreadelement (const char * buffer, size_t size, reader * r, int * lineno);
+
+//! selects the scan implementation, the level is bounded by the cpu support. Returns the selected level.
+int		fastxmlscanlevel (int level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
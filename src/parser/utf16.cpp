@@ -0,0 +1,110 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include "utf16.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+# define UTF16_SSE2
+# include <emmintrin.h>
+#endif
+
+#define REPLACEMENT	0xfffd
+
+//______________________________________________________________________________
+int utf16bom (const char * buffer, size_t size)
+{
+	if (!buffer || (size < 2)) return kNoBOM;
+	const unsigned char* b = (const unsigned char*)buffer;
+	if ((b[0] == 0xff) && (b[1] == 0xfe)) return kUTF16LE;
+	if ((b[0] == 0xfe) && (b[1] == 0xff)) return kUTF16BE;
+	return kNoBOM;
+}
+
+//______________________________________________________________________________
+static inline char* utf8 (unsigned int c, char* dst)
+{
+	if (c < 0x80) *dst++ = char(c);
+	else if (c < 0x800) {
+		*dst++ = char(0xc0 | (c >> 6));
+		*dst++ = char(0x80 | (c & 0x3f));
+	}
+	else if (c < 0x10000) {
+		*dst++ = char(0xe0 | (c >> 12));
+		*dst++ = char(0x80 | ((c >> 6) & 0x3f));
+		*dst++ = char(0x80 | (c & 0x3f));
+	}
+	else {
+		*dst++ = char(0xf0 | (c >> 18));
+		*dst++ = char(0x80 | ((c >> 12) & 0x3f));
+		*dst++ = char(0x80 | ((c >> 6) & 0x3f));
+		*dst++ = char(0x80 | (c & 0x3f));
+	}
+	return dst;
+}
+
+//______________________________________________________________________________
+size_t utf16toutf8 (const char * src, size_t size, int bigendian, char * dst, size_t * consumed, int last)
+{
+	const unsigned char* p = (const unsigned char*)src;
+	const unsigned char* end = p + (size & ~size_t(1));
+	const int hi = bigendian ? 0 : 1;
+	const int lo = 1 - hi;
+	char* out = dst;
+
+	while (p < end) {
+#ifdef UTF16_SSE2
+		// ascii runs are transcoded 8 chars at a time
+		while (p + 16 <= end) {
+			__m128i v = _mm_loadu_si128 ((const __m128i*)p);
+			if (bigendian) v = _mm_or_si128 (_mm_srli_epi16 (v, 8), _mm_slli_epi16 (v, 8));
+			if (_mm_movemask_epi8 (_mm_cmpeq_epi16 (_mm_and_si128 (v, _mm_set1_epi16 (short(0xff80))), _mm_setzero_si128())) != 0xffff)
+				break;
+			_mm_storel_epi64 ((__m128i*)out, _mm_packus_epi16 (v, v));
+			out += 8;
+			p += 16;
+		}
+		if (p >= end) break;
+#endif
+		unsigned int c = (unsigned int)(p[hi] << 8) | p[lo];
+		if (c < 0x80) {							// ascii runs are the common case
+			*out++ = char(c);
+			p += 2;
+			continue;
+		}
+		if ((c >= 0xd800) && (c < 0xdc00)) {	// high surrogate
+			if (p + 4 > end) {
+				if (!last) break;				// the low surrogate is expected in the next block
+				c = REPLACEMENT;
+				p += 2;
+			}
+			else {
+				unsigned int c2 = (unsigned int)(p[2+hi] << 8) | p[2+lo];
+				if ((c2 >= 0xdc00) && (c2 < 0xe000)) {
+					c = 0x10000 + ((c - 0xd800) << 10) + (c2 - 0xdc00);
+					p += 4;
+				}
+				else {							// unpaired high surrogate
+					c = REPLACEMENT;
+					p += 2;
+				}
+			}
+		}
+		else {
+			if ((c >= 0xdc00) && (c < 0xe000)) c = REPLACEMENT;	// unpaired low surrogate
+			p += 2;
+		}
+		out = utf8 (c, out);
+	}
+	if (last) p = (const unsigned char*)src + size;		// a trailing odd byte is dropped
+	if (consumed) *consumed = size_t(p - (const unsigned char*)src);
+	return size_t(out - dst);
+}
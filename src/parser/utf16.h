@@ -0,0 +1,52 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __utf16__
+#define __utf16__
+
+#include <stddef.h>
+
+/*
+	UTF-16 to UTF-8 block transcoding.
+
+	UTF-16 documents are detected using their byte order mark and they are
+	transcoded to UTF-8 by blocks before being scanned. Surrogate pairs are
+	converted to 4 bytes sequences, unpaired surrogates are replaced by
+	U+FFFD (the replacement character).
+*/
+
+enum { kNoBOM, kUTF16LE, kUTF16BE };
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! checks the byte order mark of a buffer, returns kUTF16LE, kUTF16BE or kNoBOM
+int		utf16bom (const char * buffer, size_t size);
+
+/*! transcodes a UTF-16 block to UTF-8
+	\param src the UTF-16 text (without byte order mark)
+	\param size the text size in bytes
+	\param bigendian the text byte order
+	\param dst the destination buffer, it must be at least (size / 2) * 3 bytes long
+	\param consumed on output, the number of bytes transcoded: a trailing odd byte or a
+		trailing high surrogate are left for the next block, unless \c last is true
+	\param last true for the last block of the text
+	\return the number of bytes written to dst
+*/
+size_t	utf16toutf8 (const char * src, size_t size, int bigendian, char * dst, size_t * consumed, int last);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
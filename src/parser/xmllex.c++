@@ -767,52 +767,59 @@ char *libmxmltext;
 
 #include "xmlparse.hpp"
 #include <stdio.h>
+#include <string.h>
+#include "utf16.h"
 
 #define YY_NO_UNISTD_H
 
 extern int libmxmllval;
 
-static int utf16 = 0;
-static int bigendian = 1;
+static int utf16 = kNoBOM;		// the input encoding, detected using the byte order mark
 static int start = 1;
+static char ibuff[8192];		// the UTF-16 input block
+static size_t isize = 0;
+static char obuff[12288];		// the UTF-8 transcoded block
+static size_t osize = 0, opos = 0;
 
-static int wgetc(FILE * fd) {
-	int c = getc(fd);
+// reads the input by blocks: UTF-16 input is transcoded to UTF-8
+static size_t wfread (void * buf, size_t size, size_t nmemb, FILE * fd) {
+	char * ptr = (char *)buf;
+	size_t max = size * nmemb;
 	if (start) {
-		if (c == 0xff) {
-			utf16 = 1; bigendian = 0;
-			getc(fd); c = getc(fd);
-		}
-		else if (c == 0xfe) {
-			utf16 = 1; bigendian = 1;
-			getc(fd); c = getc(fd);
-		}
 		start = 0;
+		isize = fread (ibuff, 1, 2, fd);
+		utf16 = utf16bom (ibuff, isize);
+		if (utf16 == kNoBOM) {			// the first bytes are regular input
+			memcpy (obuff, ibuff, isize);
+			osize = isize;
+			opos = 0;
+		}
+		isize = 0;
 	}
-	if (utf16) {
-		if (bigendian) c = getc(fd);
-		else getc(fd);
+	while ((opos == osize) && utf16) {
+		size_t n = fread (ibuff + isize, 1, sizeof(ibuff) - isize, fd);
+		isize += n;
+		size_t consumed;
+		osize = utf16toutf8 (ibuff, isize, utf16 == kUTF16BE, obuff, &consumed, n == 0);
+		opos = 0;
+		isize -= consumed;
+		memmove (ibuff, ibuff + consumed, isize);
+		if (n == 0) break;
 	}
-
-	return c;
-}
-
-static size_t wfread (void * buf, size_t size, size_t nmemb, FILE * fd) {
-	char * ptr = (char *)buf;
-	size_t n=0;
-	while (nmemb--) {
-		*ptr++ = wgetc(fd);
-		if (feof(fd) || ferror(fd) ) break;
-		n++;
+	if (opos < osize) {
+		size_t n = (osize - opos < max) ? osize - opos : max;
+		memcpy (ptr, obuff + opos, n);
+		opos += n;
+		return n;
 	}
-	return n;
+	return utf16 ? 0 : fread (ptr, 1, max, fd);
 }
 		 
 void lexinit(FILE* fd) {
-	utf16 = 0;
-	bigendian = 1;
+	utf16 = kNoBOM;
 	start = 1;
-	libmxmlrestart(fd);
+	isize = osize = opos = 0;
+	yyrestart(fd);
 }
 		 
 void lexend() {
@@ -821,7 +828,6 @@ void lexend() {
 	}
 }
 
-#define getc	wgetc
 #define fread	wfread
 #define register		// to get rid of the -Wdeprecated-register
 
@@ -1851,7 +1851,7 @@ bool readfile (const char * file, reader * r)
 		return false;
 	}
 	init(r);
-	libmxmlrestart(fd);
+	lexinit(fd);
 	libmxmlin = fd;
  	int ret = yyparse();
  	fclose (fd);
@@ -1863,7 +1863,7 @@ bool readstream (FILE * fd, reader * r)
 {
 	if (!fd) return false;
 	init(r);
-	libmxmlrestart(fd);
+	lexinit(fd);
 	libmxmlin = fd;
  	int ret = yyparse();
 	BEGIN(INITIAL);
@@ -25,41 +25,31 @@ namespace MusicXML2
 //______________________________________________________________________________
 void clonevisitor::copyAttributes (const Sxmlelement& src, Sxmlelement& dst )
 {
-	vector<Sxmlattribute> attr = src->attributes();
+	const vector<Sxmlattribute>& attr = src->attributes();
 	vector<Sxmlattribute>::const_iterator iter;
-	for (iter=attr.begin(); iter != attr.end(); iter++) {
-		Sxmlattribute attrcopy = xmlattribute::create();
-		attrcopy->setName( (*iter)->getName());
-		attrcopy->setValue( (*iter)->getValue());
-		dst->add( attrcopy );
-	}
+	for (iter=attr.begin(); iter != attr.end(); iter++)
+		dst->add( (*iter)->clone() );
 }
 
 //______________________________________________________________________________
 Sxmlelement clonevisitor::copy (const Sxmlelement& src)
 {
-	Sxmlelement copy = xmlelement::create(src->getInputLineNumber());
-	if (copy) {
-		copy->setName( src->getName());
-		copy->setValue( src->getValue());
-		copyAttributes (src, copy);
-	}
-	return copy;
+	return src->copy();
 }
 
 //______________________________________________________________________________
 void clonevisitor::visitStart ( Sxmlelement& elt )
 {
 	if (!fClone) return;
-	Sxmlelement copy = xmlelement::create(elt->getInputLineNumber());
-	copy->setName( elt->getName());
-	copy->setValue( elt->getValue());
-	copyAttributes (elt, copy);
+	Sxmlelement copy = elt->copy();
 	fLastCopy = copy;
 	if (fStack.empty())
 		fStack.push(copy);
 	else fStack.top()->push(copy);
-	if (!elt->empty()) fStack.push(copy);
+	if (!elt->empty()) {
+		copy->elements().reserve (elt->elements().size());
+		fStack.push(copy);
+	}
 }
 
 //______________________________________________________________________________
@@ -27,6 +27,9 @@ namespace MusicXML2
 
 /*!
 \brief A visitor that clones a musicxml tree
+
+	The copies keep the elements types (see xmlelement::copy).
+	Note that a plain copy of a tree is more efficiently made using xmlelement::clone.
 */
 class EXP clonevisitor : 
 	public visitor<Sxmlelement>
@@ -196,7 +196,7 @@ void notevisitor::print (ostream& out) const
         fLyricsDy += 8;		  // anchor point convertion (defaults to upper line in xml)
         
         /// Get content information:
-        fSyllabic = elt->getValue(k_syllabic);
+        fSyllabic = elt->getChildValue(k_syllabic);
         
         /// Browse inside and take into account elision which translates to "~"
         auto lyrText = elt->find(k_text);
@@ -217,10 +217,10 @@ void notevisitor::visitStart ( S_note& elt )
 	fInNote = true;
 	reset();
 	fDynamics = elt->getAttributeLongValue("dynamics", kUndefinedDynamics);
-    fAccidental = elt->getValue(k_accidental);
+    ctree<xmlelement>::literator accidental = elt->findChild(k_accidental);
+    fAccidental = (accidental != elt->lend()) ? (*accidental)->getValue() : "";
     if (!fAccidental.empty()) {
-        auto accidental = elt->find(k_accidental);
-        fCautionary = accidental->getAttributeValue("cautionary");
+        fCautionary = (*accidental)->getAttributeValue("cautionary");
     }
     
     fThisSNote = elt;
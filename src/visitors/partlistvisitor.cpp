@@ -10,6 +10,7 @@
 
 #include "partlistvisitor.h"
 
+#include "numbers.h"
 #include "rational.h"
 #include "xml_tree_browser.h"
 #include "tree_browser.h"
@@ -66,7 +67,7 @@ namespace MusicXML2
         std::vector<int>::iterator rangeEnd = std::max_element(staves.begin(), staves.end());
         std::vector<int>::iterator rangeBegin = std::min_element(staves.begin(), staves.begin());
         
-        stringstream rangeStream;
+        numbuffer rangeStream;
         rangeStream << "\"" << (*rangeBegin) << "-" << (*rangeEnd) << "\"";
         pGroup.guidoRange = rangeStream.str();
         pGroup.guidoRangeStart = *rangeBegin ;
@@ -105,20 +106,20 @@ namespace MusicXML2
         {
             int groupIndex = fPartGroupIncrementer;
             fPartGroups[groupIndex].xmlGroupNumber = partGroupNumber;
-            if (elt->getValue(k_group_symbol)=="bracket")
+            if (elt->getChildValue(k_group_symbol)=="bracket")
             {
                 fPartGroups[groupIndex].bracket = true;
             } else
                 fPartGroups[groupIndex].bracket = false;
             
-            if (elt->getValue(k_group_barline)=="yes")
+            if (elt->getChildValue(k_group_barline)=="yes")
             {
                 fPartGroups[groupIndex].barlineGrouping = true;
             } else
                 fPartGroups[groupIndex].barlineGrouping = false;
             
             // Add optional names
-            fPartGroups[groupIndex].fGroupName = elt->getValue(k_group_name);
+            fPartGroups[groupIndex].fGroupName = elt->getChildValue(k_group_name);
             fPartGroups[groupIndex].visited = false;
             
             fCurrentPartGroupIndex.push_back(groupIndex);
@@ -152,8 +153,8 @@ namespace MusicXML2
         part2staffmap[PartID] = staffCreatorCounter;
         staffCreatorCounter++;
         
-        fPartHeaders[PartID].fPartName = elt->getValue(k_part_name);
-        fPartHeaders[PartID].fPartNameAbbr = elt->getValue(k_part_abbreviation);
+        fPartHeaders[PartID].fPartName = elt->getChildValue(k_part_name);
+        fPartHeaders[PartID].fPartNameAbbr = elt->getChildValue(k_part_abbreviation);
         
         // add groupings if any
         if (fCurrentPartGroupIndex.size())
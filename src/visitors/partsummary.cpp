@@ -14,6 +14,8 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <algorithm>
+
 #include "partsummary.h"
 
 using namespace std;
@@ -176,5 +178,24 @@ int partsummary::getVoiceNotes (int staffid, int voiceid) const
 	return count;
 }
 
+//________________________________________________________________________
+void partsummary::merge (const partsummary& other)
+{
+	fStavesCount = max (fStavesCount, other.fStavesCount);
+	for (map<int, int>::const_iterator i = other.fStaves.begin(); i != other.fStaves.end(); i++)
+		fStaves[i->first] += i->second;
+	for (map<int, int>::const_iterator i = other.fVoices.begin(); i != other.fVoices.end(); i++)
+		fVoices[i->first] += i->second;
+	for (map<int, map<int, int> >::const_iterator i = other.fStaffVoices.begin(); i != other.fStaffVoices.end(); i++) {
+		map<int, int>& voices = fStaffVoices[i->first];
+		for (map<int, int>::const_iterator v = i->second.begin(); v != i->second.end(); v++)
+			voices[v->first] += v->second;
+	}
+	for (map<int, int>::const_iterator i = other.fStaffDistances.begin(); i != other.fStaffDistances.end(); i++) {
+		map<int, int>::iterator d = fStaffDistances.find (i->first);
+		if (d == fStaffDistances.end()) fStaffDistances.insert (*i);
+		else if (d->second < i->second) d->second = i->second;
+	}
+}
 
 } // namespace
@@ -69,6 +69,9 @@ class EXP partsummary :
 		int getVoiceNotes (int voiceid) const;
 		//! returns the count of notes on a voice and a staff
 		int getVoiceNotes (int staffid, int voiceid) const;
+
+		//! adds the summary of another part of the score (see parallel_tree_browser)
+		void merge (const partsummary& other);
     // staff distance from S_print
     std::map<int, int> fStaffDistances;
 		
@@ -88,6 +88,30 @@ void unrolled_clonevisitor::visitEnd  ( S_key& elt)		{ if (fKeyCopy) end( elt );
 void unrolled_clonevisitor::visitEnd  ( S_clef& elt)	{ if (fClefCopy) end( elt ); else clone(true); }
 void unrolled_clonevisitor::visitEnd  ( S_time& elt)	{ if (fTimeCopy) end( elt ); else clone(true); }
 
+//______________________________________________________________________________
+// the notes content is not modified by the unrolling: in shared mode,
+// the note subtree is not browsed but shared with the source note
+void unrolled_clonevisitor::visitStart( S_note& elt)
+{
+	if (!fShared || !fClone || fStack.empty()) {
+		start(elt);
+		return;
+	}
+	lastCopy() = elt->clone(true);
+	fStack.top()->push(lastCopy());
+	fSharing = true;
+	clone(false);
+}
+
+void unrolled_clonevisitor::visitEnd( S_note& elt)
+{
+	if (fSharing) {
+		fSharing = false;
+		clone(true);
+	}
+	else end(elt);
+}
+
 //______________________________________________________________________________
 void unrolled_clonevisitor::visitStart( S_sound& elt)
 {
@@ -28,6 +28,12 @@ namespace MusicXML2
 //______________________________________________________________________________
 /*!
 \brief A visitor that creates an "unrolled" version of a score.
+
+	In shared mode, the notes of the unrolled score are shared copies of the
+	source notes (see xmlelement::clone): their sub elements are copied when
+	first accessed, thus the repeated measures cost little memory until they
+	are browsed. The notes are shared only when the source score is frozen
+	(see TXMLFile::freeze), which must then stay frozen while the copy is in use.
 */
 class EXP unrolled_clonevisitor : public clonevisitor,
 	public visitor<S_measure>,
@@ -37,18 +43,21 @@ class EXP unrolled_clonevisitor : public clonevisitor,
 	public visitor<S_ending>,
 	public visitor<S_repeat>,
 	public visitor<S_part>,
-	public visitor<S_sound>
+	public visitor<S_sound>,
+	public visitor<S_note>
 {
 	S_key	fCurrentKey;	bool fKeyCopy;
 	S_clef	fCurrentClef;	bool fClefCopy;
 	S_time	fCurrentTime;	bool fTimeCopy;
 	long fMeasureNum;
+	bool fShared;			// shares the notes subtrees
+	bool fSharing;			// true while browsing a shared note
 	
 	protected:
 		virtual void start (Sxmlelement elt)	{ clonevisitor::visitStart(elt); }
 		virtual void end (Sxmlelement elt)		{ clonevisitor::visitEnd(elt); }
 	public:
-				 unrolled_clonevisitor() : fMeasureNum(1) {}
+				 unrolled_clonevisitor(bool shared=false) : fMeasureNum(1), fShared(shared), fSharing(false) {}
 		virtual ~unrolled_clonevisitor() {}
 
 		virtual void visitStart( S_measure& elt);
@@ -57,6 +66,7 @@ class EXP unrolled_clonevisitor : public clonevisitor,
 		virtual void visitStart( S_key& elt);
 		virtual void visitStart( S_clef& elt);
 		virtual void visitStart( S_time& elt);
+		virtual void visitStart( S_note& elt);
 
 		virtual void visitEnd  ( S_measure& elt)	{ end( elt ); }
 		virtual void visitEnd  ( S_part& elt)		{ end( elt ); }
@@ -64,6 +74,7 @@ class EXP unrolled_clonevisitor : public clonevisitor,
 		virtual void visitEnd  ( S_key& elt);
 		virtual void visitEnd  ( S_clef& elt);
 		virtual void visitEnd  ( S_time& elt);
+		virtual void visitEnd  ( S_note& elt);
 
 		virtual void visitStart( S_ending& elt)		{}		// don't copy
 		virtual void visitStart( S_repeat& elt)		{}		// don't copy
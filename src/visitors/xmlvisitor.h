@@ -33,7 +33,7 @@ class xmlendl {
 	private:
 		int fIndent;
 	public:
-				 xmlendl() : fIndent(0) {}
+				 xmlendl(int indent=0) : fIndent(indent) {}
 		virtual ~xmlendl() {}
 
 		//! increase the indentation
@@ -55,7 +55,7 @@ class xmlvisitor :
 	xmlendl			fendl;
 
     public:
-				 xmlvisitor(std::ostream& stream) : fOut(stream) {}
+				 xmlvisitor(std::ostream& stream, int indent=0) : fOut(stream), fendl(indent) {}
 		virtual ~xmlvisitor() {}
 
 		virtual void visitStart ( Sxmlelement& elt);